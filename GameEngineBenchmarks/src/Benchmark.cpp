@@ -0,0 +1,11 @@
+#include "Benchmark.hpp"
+
+#include <iostream>
+
+namespace GameEngine {
+    bool reportCheck(const char *label, const bool isCorrect) {
+        std::cout << label << ": " << (isCorrect ? "correct" : "INCORRECT") << "\n";
+
+        return isCorrect;
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace GameEngine {
+    // xorshift64, seeded per benchmark so runs are reproducible.
+    class BenchmarkRandom {
+    public:
+        explicit BenchmarkRandom(const uint64_t seed = 1) : m_state{seed != 0 ? seed : 1} {}
+
+        uint64_t next() {
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 7;
+            m_state ^= m_state << 17;
+
+            return m_state;
+        }
+
+        // Uniform in [minimum, maximum).
+        float nextFloat(const float minimum, const float maximum) {
+            return minimum + (maximum - minimum) * static_cast<float>(next() >> 40) / static_cast<float>(1u << 24);
+        }
+
+        size_t nextIndex(const size_t count) {
+            return static_cast<size_t>(next() % count);
+        }
+
+    private:
+        uint64_t m_state;
+    };
+
+    class BenchmarkStopwatch {
+    public:
+        BenchmarkStopwatch() : m_begin{std::chrono::steady_clock::now()} {}
+
+        void restart() { m_begin = std::chrono::steady_clock::now(); }
+
+        double getMilliseconds() const {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_begin).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point m_begin;
+    };
+
+    // Average milliseconds of function over iterationsCount runs; prepare runs untimed before each.
+    template<typename Prepare, typename Function>
+    double measureAverageMilliseconds(const unsigned int iterationsCount, Prepare &&prepare, Function &&function) {
+        double milliseconds = 0.0;
+
+        for (unsigned int iteration = 0; iteration < iterationsCount; ++iteration) {
+            prepare();
+
+            const BenchmarkStopwatch stopwatch;
+            function();
+            milliseconds += stopwatch.getMilliseconds();
+        }
+
+        return iterationsCount > 0 ? milliseconds / iterationsCount : 0.0;
+    }
+
+    // Prints "label: correct" or "label: INCORRECT" and returns isCorrect.
+    bool reportCheck(const char *label, const bool isCorrect);
+
+    // A benchmark prints its timings, checks its output against a reference and returns 0 when
+    // the output is correct.
+    struct Benchmark {
+        const char *name;
+        // Null when the benchmark takes no argument.
+        const char *argumentName;
+        size_t defaultArgument;
+        int (*run)(const size_t argument);
+    };
+
+    int runRenderQueueBenchmark(const size_t keysCount);
+    int runCullingBenchmark(const size_t objectsCount);
+    int runRegistryBenchmark(const size_t entitiesCount);
+    int runTransformHierarchyBenchmark(const size_t nodesCount);
+    int runJobSystemBenchmark(const size_t jobsCount);
+    int runLogBenchmark(const size_t messagesCount);
+    int runProfilerBenchmark(const size_t scopesCount);
+    int runTextureStreamerBenchmark(const size_t texturesCount);
+    int runProceduralImageBenchmark(const size_t iterationsCount);
+    int runTextureAtlasPackerBenchmark(const size_t rectsCount);
+    int runGpuProfilerTest(const size_t);
+    int runIndirectCommandsTest(const size_t);
+}
+
+#endif
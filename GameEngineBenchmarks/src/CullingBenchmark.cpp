@@ -0,0 +1,95 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Math/Culling.hpp"
+
+#include "glm/ext/matrix_clip_space.hpp"
+#include "glm/ext/matrix_transform.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace GameEngine {
+    // Culls random boxes and spheres scattered around a perspective camera, average
+    // milliseconds per pass for the SIMD and scalar kernels. The SIMD kernels must produce
+    // exactly the scalar index lists.
+    int runCullingBenchmark(const size_t objectsCount) {
+        constexpr unsigned int iterationsCount = 10;
+        BenchmarkRandom random;
+        std::vector<float> centers[3];
+        std::vector<float> extents(objectsCount);
+        std::vector<float> minimums[3];
+        std::vector<float> maximums[3];
+
+        for (size_t axis = 0; axis < 3; ++axis) {
+            centers[axis].resize(objectsCount);
+            minimums[axis].resize(objectsCount);
+            maximums[axis].resize(objectsCount);
+        }
+
+        for (size_t i = 0; i < objectsCount; ++i) {
+            extents[i] = random.nextFloat(0.1f, 2.1f);
+
+            for (size_t axis = 0; axis < 3; ++axis) {
+                centers[axis][i] = random.nextFloat(-200.0f, 200.0f);
+                minimums[axis][i] = centers[axis][i] - extents[i];
+                maximums[axis][i] = centers[axis][i] + extents[i];
+            }
+        }
+
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(1.0f, 0.2f, 0.3f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const Frustum frustum = Frustum::fromMatrix(projection * view);
+
+        BoundingBoxes boxes;
+        boxes.minX = minimums[0].data();
+        boxes.minY = minimums[1].data();
+        boxes.minZ = minimums[2].data();
+        boxes.maxX = maximums[0].data();
+        boxes.maxY = maximums[1].data();
+        boxes.maxZ = maximums[2].data();
+        boxes.count = objectsCount;
+
+        BoundingSpheres spheres;
+        spheres.centerX = centers[0].data();
+        spheres.centerY = centers[1].data();
+        spheres.centerZ = centers[2].data();
+        spheres.radius = extents.data();
+        spheres.count = objectsCount;
+
+        std::vector<uint32_t> visibleIndices(objectsCount);
+        std::vector<uint32_t> referenceIndices(objectsCount);
+        size_t visibleCount = 0;
+        size_t referenceCount = 0;
+        const auto noPreparation = []() {};
+
+        const double boxesMilliseconds = measureAverageMilliseconds(iterationsCount, noPreparation, [&]() {
+            visibleCount = cullBoxes(frustum, boxes, visibleIndices.data());
+        });
+        const double boxesScalarMilliseconds = measureAverageMilliseconds(iterationsCount, noPreparation, [&]() {
+            referenceCount = cullBoxesScalar(frustum, boxes, referenceIndices.data());
+        });
+        const size_t visibleBoxesCount = visibleCount;
+        bool isMatching = visibleCount == referenceCount &&
+                          std::equal(visibleIndices.begin(), visibleIndices.begin() + referenceCount,
+                                     referenceIndices.begin());
+
+        const double spheresMilliseconds = measureAverageMilliseconds(iterationsCount, noPreparation, [&]() {
+            visibleCount = cullSpheres(frustum, spheres, visibleIndices.data());
+        });
+        const double spheresScalarMilliseconds = measureAverageMilliseconds(iterationsCount, noPreparation, [&]() {
+            referenceCount = cullSpheresScalar(frustum, spheres, referenceIndices.data());
+        });
+        isMatching = isMatching && visibleCount == referenceCount &&
+                     std::equal(visibleIndices.begin(), visibleIndices.begin() + referenceCount,
+                                referenceIndices.begin());
+
+        std::cout << "Culling " << objectsCount << " objects, ms per pass (SIMD / scalar):\n"
+                  << "Boxes: " << boxesMilliseconds << " / " << boxesScalarMilliseconds << ", "
+                  << visibleBoxesCount << " visible\n"
+                  << "Spheres: " << spheresMilliseconds << " / " << spheresScalarMilliseconds << ", "
+                  << visibleCount << " visible\n";
+
+        return reportCheck("SIMD culling against the scalar reference", isMatching) ? 0 : 1;
+    }
+}
@@ -0,0 +1,118 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Rendering/OpenGL/GpuProfiler.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace GameEngine {
+    namespace {
+        // A query becomes available once the mock GPU has completed up to its serial.
+        namespace MockQueries {
+            struct Query {
+                uint64_t timestamp = 0;
+                uint64_t serial = 0;
+            };
+
+            std::vector<Query> s_queries;
+            uint64_t s_clock = 0;
+            uint64_t s_serial = 0;
+            uint64_t s_completedSerial = 0;
+
+            void createQueries(unsigned int, const int count, unsigned int *ids) {
+                for (int i = 0; i < count; ++i) {
+                    s_queries.emplace_back();
+                    ids[i] = static_cast<unsigned int>(s_queries.size());
+                }
+            }
+
+            void deleteQueries(int, const unsigned int*) {
+                s_queries.clear();
+            }
+
+            void queryCounter(const unsigned int id, unsigned int) {
+                s_queries[id - 1].timestamp = s_clock;
+                s_queries[id - 1].serial = ++s_serial;
+            }
+
+            void getQueryObjectiv(const unsigned int id, unsigned int, int *value) {
+                *value = s_queries[id - 1].serial <= s_completedSerial ? 1 : 0;
+            }
+
+            void getQueryObjectui64v(const unsigned int id, unsigned int, uint64_t *value) {
+                *value = s_queries[id - 1].timestamp;
+            }
+        }
+    }
+
+    // Drives a GpuProfiler through the mock query table, completing frames on demand.
+    int runGpuProfilerTest(const size_t) {
+        constexpr uint64_t s_millisecond = 1000000;
+
+        GpuQueryFunctions functions;
+        functions.createQueries = MockQueries::createQueries;
+        functions.deleteQueries = MockQueries::deleteQueries;
+        functions.queryCounter = MockQueries::queryCounter;
+        functions.getQueryObjectiv = MockQueries::getQueryObjectiv;
+        functions.getQueryObjectui64v = MockQueries::getQueryObjectui64v;
+
+        GpuProfiler profiler(functions);
+
+        // Frame 0: Frame { Outer { Inner } } taking 6, 4 and 2 ms.
+        profiler.beginFrame();
+        MockQueries::s_clock += s_millisecond;
+        const int32_t outer = profiler.beginScope("Outer");
+        MockQueries::s_clock += s_millisecond;
+        const int32_t inner = profiler.beginScope("Inner");
+        MockQueries::s_clock += 2 * s_millisecond;
+        profiler.endScope(inner);
+        MockQueries::s_clock += s_millisecond;
+        profiler.endScope(outer);
+        MockQueries::s_clock += s_millisecond;
+        profiler.endFrame();
+
+        const uint64_t firstFrameSerial = MockQueries::s_serial;
+
+        // Frame 1 begins while frame 0 is still in flight, so nothing can be collected yet.
+        profiler.beginFrame();
+        bool isPendingCorrect = profiler.getLatestTimings().empty();
+        profiler.endFrame();
+
+        // Only frame 0 completes; frame 1 must stay pending instead of blocking or being read early.
+        MockQueries::s_completedSerial = firstFrameSerial;
+        profiler.beginFrame();
+        profiler.endFrame();
+
+        const std::vector<GpuProfiler::Timing> &timings = profiler.getLatestTimings();
+        isPendingCorrect = isPendingCorrect && profiler.getLatestFrameIndex() == 0;
+        const bool isNestingCorrect = timings.size() == 3 &&
+            timings[0].depth == 0 && timings[0].milliseconds == 6.0 &&
+            timings[1].depth == 1 && timings[1].milliseconds == 4.0 &&
+            timings[2].depth == 2 && timings[2].milliseconds == 2.0 &&
+            profiler.getLatestFrameMilliseconds() == 6.0;
+
+        // With the GPU stalled, cycling through every slot overwrites the still pending frames 1 and 2.
+        for (size_t i = 0; i < GpuProfiler::s_framesInFlight; ++i) {
+            profiler.beginFrame();
+            profiler.endFrame();
+        }
+
+        const size_t droppedFramesCount = profiler.getDroppedFramesCount();
+        const uint64_t lastFrameIndex = GpuProfiler::s_framesInFlight + 2;
+
+        // Once the GPU catches up, the newest surviving frame is reported.
+        MockQueries::s_completedSerial = MockQueries::s_serial;
+        profiler.beginFrame();
+        profiler.endFrame();
+
+        const bool isDroppedCorrect = droppedFramesCount == 2 && profiler.getLatestFrameIndex() == lastFrameIndex;
+
+        std::cout << "GPU profiler against mock queries:\n";
+
+        const bool isCorrect = reportCheck("Nested scopes", isNestingCorrect) &
+                               reportCheck("Pending frames", isPendingCorrect) &
+                               reportCheck("Dropped frames", isDroppedCorrect);
+
+        return isCorrect ? 0 : 1;
+    }
+}
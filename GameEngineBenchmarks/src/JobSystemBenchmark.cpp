@@ -0,0 +1,120 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace GameEngine {
+    namespace {
+        // Every job of a burst that overflows one worker's deque must run exactly once.
+        bool checkBurst() {
+            // More jobs than one worker can queue, so the burst also covers the inline fallback.
+            std::vector<std::atomic<uint32_t>> runsCounts(JobSystem::s_jobsPerWorker * 2 + 1);
+            JobCounter burstCounter;
+
+            for (size_t i = 0; i < runsCounts.size(); ++i) {
+                JobSystem::run([](void *data, const size_t index, const size_t) {
+                        static_cast<std::atomic<uint32_t>*>(data)[index].fetch_add(1, std::memory_order_relaxed);
+                    },
+                    runsCounts.data(), burstCounter, nullptr, i, i + 1);
+            }
+
+            JobSystem::wait(burstCounter);
+
+            return std::all_of(runsCounts.begin(), runsCounts.end(),
+                [](const std::atomic<uint32_t> &runsCount) { return runsCount.load() == 1; });
+        }
+
+        // Every dependent job must run after its dependency.
+        bool checkDependencies() {
+            // The dependent job is queued last, so on a LIFO deque it is taken first.
+            constexpr size_t dependenciesCount = 256;
+            std::vector<JobCounter> dependencyCounters(dependenciesCount);
+            std::vector<std::atomic<uint32_t>> stages(dependenciesCount);
+            std::atomic<uint32_t> orderErrorsCount{0};
+            JobCounter dependentsCounter;
+
+            struct DependencyData {
+                std::atomic<uint32_t> *stages;
+                std::atomic<uint32_t> *orderErrorsCount;
+            } dependencyData{ stages.data(), &orderErrorsCount };
+
+            for (size_t i = 0; i < dependenciesCount; ++i) {
+                JobSystem::run([](void *data, const size_t index, const size_t) {
+                        static_cast<DependencyData*>(data)->stages[index].store(1, std::memory_order_relaxed);
+                    },
+                    &dependencyData, dependencyCounters[i], nullptr, i, i + 1);
+                JobSystem::run([](void *data, const size_t index, const size_t) {
+                        DependencyData &dependency = *static_cast<DependencyData*>(data);
+
+                        if (dependency.stages[index].load(std::memory_order_relaxed) != 1) {
+                            dependency.orderErrorsCount->fetch_add(1);
+                        }
+                    },
+                    &dependencyData, dependentsCounter, &dependencyCounters[i], i, i + 1);
+            }
+
+            JobSystem::wait(dependentsCounter);
+
+            return orderErrorsCount.load() == 0;
+        }
+    }
+
+    // Scheduling overhead of jobsCount empty jobs and the time of a parallelFor over
+    // jobsCount items, once per workers count from 1 to the hardware concurrency.
+    int runJobSystemBenchmark(const size_t jobsCount) {
+        constexpr size_t iterationsPerItem = 64;
+        const size_t maxWorkersCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        std::vector<float> values(jobsCount);
+        bool isCorrect = true;
+
+        std::cout << "Scheduling " << jobsCount << " jobs on 1.." << maxWorkersCount << " workers:\n";
+
+        for (size_t workersCount = 1; workersCount <= maxWorkersCount; ++workersCount) {
+            if (!JobSystem::init(workersCount)) {
+                return 1;
+            }
+
+            isCorrect = checkBurst() && checkDependencies() && isCorrect;
+
+            JobCounter emptyCounter;
+            BenchmarkStopwatch stopwatch;
+
+            for (size_t i = 0; i < jobsCount; ++i) {
+                JobSystem::run([](void*, const size_t, const size_t) {}, nullptr, emptyCounter);
+            }
+
+            JobSystem::wait(emptyCounter);
+
+            const double nanosecondsPerEmptyJob = stopwatch.getMilliseconds() * 1000000.0 /
+                                                  static_cast<double>(jobsCount);
+
+            stopwatch.restart();
+
+            JobSystem::parallelFor(values.size(), [&values](const size_t rangeBegin, const size_t rangeEnd) {
+                for (size_t i = rangeBegin; i < rangeEnd; ++i) {
+                    float value = static_cast<float>(i);
+
+                    for (size_t j = 0; j < iterationsPerItem; ++j) {
+                        value = value * 0.999f + 1.0f;
+                    }
+
+                    values[i] = value;
+                }
+            });
+
+            const double parallelForMilliseconds = stopwatch.getMilliseconds();
+
+            JobSystem::shutdown();
+
+            std::cout << workersCount << " workers: " << nanosecondsPerEmptyJob << " ns per empty job, parallelFor "
+                      << parallelForMilliseconds << " ms\n";
+        }
+
+        return reportCheck("Overflowing burst and job dependencies", isCorrect) ? 0 : 1;
+    }
+}
@@ -0,0 +1,69 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Log.hpp"
+
+#include "spdlog/sinks/basic_file_sink.h"
+
+#include <iostream>
+#include <memory>
+
+namespace GameEngine {
+    // Average caller-side nanoseconds per logging call in each mode. The loggers are
+    // reinitialized for every mode and write to log_benchmark.log.
+    int runLogBenchmark(const size_t messagesCount) {
+        const char *filePath = "log_benchmark.log";
+        bool isInitialized = true;
+
+        const auto measure = [messagesCount, &isInitialized](const LogConfig &config, auto &&logMessage) {
+            Log::shutdown();
+            isInitialized = Log::init(config) && isInitialized;
+
+            const BenchmarkStopwatch stopwatch;
+
+            for (size_t i = 0; i < messagesCount; ++i) {
+                logMessage(i);
+            }
+
+            return stopwatch.getMilliseconds() * 1000000.0 / static_cast<double>(messagesCount);
+        };
+
+        const auto logInfo = [](const size_t i) {
+            GAME_ENGINE_LOG(LogSubsystem::Core, spdlog::level::info, "Benchmark message {0} at {1}", i, 0.5f);
+        };
+
+        LogConfig config;
+        config.sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(filePath, true);
+
+        config.asynchronous = false;
+        const double synchronousNanoseconds = measure(config, logInfo);
+
+        config.asynchronous = true;
+        config.blockOnOverflow = false;
+        const double asynchronousNanoseconds = measure(config, logInfo);
+        const size_t asynchronousDroppedCount = Log::getDroppedMessagesCount();
+
+        config.blockOnOverflow = true;
+        const double asynchronousBlockingNanoseconds = measure(config, logInfo);
+
+        const double filteredNanoseconds = measure(config, [](const size_t i) {
+            GAME_ENGINE_LOG(LogSubsystem::Core, spdlog::level::debug, "Benchmark message {0} at {1}", i, 0.5f);
+        });
+
+        const double rateLimitedNanoseconds = measure(config, [](const size_t i) {
+            GAME_ENGINE_LOG_RATE_LIMITED(LogSubsystem::Core, spdlog::level::info, 1000,
+                                         "Benchmark message {0} at {1}", i, 0.5f);
+        });
+
+        Log::shutdown();
+
+        std::cout << "Logging " << messagesCount << " messages to " << filePath << ", ns per call:\n"
+                  << "Synchronous: " << synchronousNanoseconds << "\n"
+                  << "Asynchronous, overrun oldest: " << asynchronousNanoseconds << ", "
+                  << asynchronousDroppedCount << " dropped\n"
+                  << "Asynchronous, blocking: " << asynchronousBlockingNanoseconds << "\n"
+                  << "Filtered by the runtime level: " << filteredNanoseconds << "\n"
+                  << "Rate limited: " << rateLimitedNanoseconds << "\n";
+
+        return reportCheck("Logger initialization in every mode", isInitialized) ? 0 : 1;
+    }
+}
@@ -0,0 +1,139 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+#include "GameEngineCore/Rendering/Headless/HeadlessContext.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StreamingBuffer.hpp"
+#include "GameEngineCore/Rendering/ProceduralImage.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace GameEngine {
+    namespace {
+        // The generators App used before ProceduralImage: column-major loops over the whole
+        // image for every circle.
+        void referenceCircle(unsigned char *data, const unsigned int width, const unsigned int height,
+                             const unsigned int centerX, const unsigned int centerY, const unsigned int radius,
+                             const unsigned char red, const unsigned char green, const unsigned char blue) {
+            for (unsigned int x = 0; x < width; ++x) {
+                for (unsigned int y = 0; y < height; ++y) {
+                    if ((x - centerX) * (x - centerX) + (y - centerY) * (y - centerY) < radius * radius) {
+                        data[3 * (x + width * y) + 0] = red;
+                        data[3 * (x + width * y) + 1] = green;
+                        data[3 * (x + width * y) + 2] = blue;
+                    }
+                }
+            }
+        }
+
+        void referenceSmile(unsigned char *data, const unsigned int width, const unsigned int height) {
+            for (unsigned int x = 0; x < width; ++x) {
+                for (unsigned int y = 0; y < height; ++y) {
+                    data[3 * (x + width * y) + 0] = 200;
+                    data[3 * (x + width * y) + 1] = 191;
+                    data[3 * (x + width * y) + 2] = 231;
+                }
+            }
+
+            referenceCircle(data, width, height, width * 0.5, height * 0.5, width * 0.4, 255, 255, 0);
+            referenceCircle(data, width, height, width * 0.5, height * 0.4, width * 0.2, 0, 0, 0);
+            referenceCircle(data, width, height, width * 0.5, height * 0.45, width * 0.2, 255, 255, 0);
+            referenceCircle(data, width, height, width * 0.35, height * 0.6, width * 0.07, 255, 0, 255);
+            referenceCircle(data, width, height, width * 0.65, height * 0.6, width * 0.07, 0, 0, 255);
+        }
+
+        void referenceQuads(unsigned char *data, const unsigned int width, const unsigned int height) {
+            for (unsigned int x = 0; x < width; ++x) {
+                for (unsigned int y = 0; y < height; ++y) {
+                    const unsigned char value =
+                        (x < width / 2 && y < height / 2) || (x >= width / 2 && y >= height / 2) ? 0 : 255;
+
+                    data[3 * (x + width * y) + 0] = value;
+                    data[3 * (x + width * y) + 1] = value;
+                    data[3 * (x + width * y) + 2] = value;
+                }
+            }
+        }
+    }
+
+    // Times the demo textures against the reference generators, rendered on one thread, on
+    // the JobSystem and straight into a mapped StreamingBuffer of the null backend. Both
+    // renders must match the reference byte for byte.
+    int runProceduralImageBenchmark(const size_t iterationsCount) {
+        constexpr unsigned int channelsCount = 3;
+        constexpr unsigned int size = 1000;
+        const size_t imageBytes = size_t{size} * size * channelsCount;
+        const unsigned int iterations = static_cast<unsigned int>(iterationsCount);
+        const auto noPreparation = []() {};
+
+        if (!RendererOpenGL::initHeadless(RenderBackend::Null)) {
+            return 1;
+        }
+
+        JobSystem::init();
+
+        std::vector<unsigned char> referencePixels(imageBytes * 2);
+        std::vector<unsigned char> pixels(imageBytes * 2);
+
+        ProceduralImage smile;
+        ProceduralImage quads;
+        buildSmileImage(smile, size, size);
+        buildQuadsImage(quads, size, size);
+
+        const ImageView smileView{ pixels.data(), size, size, channelsCount };
+        const ImageView quadsView{ pixels.data() + imageBytes, size, size, channelsCount };
+
+        const double referenceMilliseconds = measureAverageMilliseconds(iterations, noPreparation, [&]() {
+            referenceSmile(referencePixels.data(), size, size);
+            referenceQuads(referencePixels.data() + imageBytes, size, size);
+        });
+
+        const double singleThreadMilliseconds = measureAverageMilliseconds(iterations, noPreparation, [&]() {
+            smile.renderRows(smileView, 0, size);
+            quads.renderRows(quadsView, 0, size);
+        });
+
+        bool isMatching = referencePixels == pixels;
+        std::fill(pixels.begin(), pixels.end(), static_cast<unsigned char>(0));
+
+        const double parallelMilliseconds = measureAverageMilliseconds(iterations, noPreparation, [&]() {
+            smile.render(smileView);
+            quads.render(quadsView);
+        });
+
+        isMatching = isMatching && referencePixels == pixels;
+
+        double mappedMilliseconds = 0.0;
+
+        {
+            StreamingBuffer uploadBuffer(imageBytes * 2);
+
+            mappedMilliseconds = measureAverageMilliseconds(iterations, noPreparation, [&]() {
+                uploadBuffer.beginFrame();
+
+                const StreamingBuffer::Allocation allocation = uploadBuffer.allocate(imageBytes * 2);
+
+                if (allocation.isValid()) {
+                    unsigned char *mapped = static_cast<unsigned char*>(allocation.data);
+
+                    smile.render({ mapped, size, size, channelsCount });
+                    quads.render({ mapped + imageBytes, size, size, channelsCount });
+                }
+
+                uploadBuffer.endFrame();
+            });
+        }
+
+        std::cout << "Procedural textures " << size << "x" << size << " on " << JobSystem::getWorkersCount()
+                  << " workers, ms per smile + quads pair:\n"
+                  << "Reference: " << referenceMilliseconds << ", single thread: " << singleThreadMilliseconds
+                  << ", parallel: " << parallelMilliseconds << ", mapped buffer: " << mappedMilliseconds << "\n";
+
+        JobSystem::shutdown();
+        HeadlessContext::shutdown();
+
+        return reportCheck("Single-thread and parallel renders against the reference", isMatching) ? 0 : 1;
+    }
+}
@@ -0,0 +1,79 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace GameEngine {
+    // Cost of scopesCount empty PROFILE_SCOPEs, recorded and with the profiler disabled at run
+    // time, next to the two timestamps a scope takes. Scopes are timed in frames that fit the
+    // thread's record buffer, and every recorded scope must show up in the frame tree.
+    int runProfilerBenchmark(const size_t scopesCount) {
+#if defined(GAME_ENGINE_PROFILING)
+        constexpr size_t scopesPerFrame = Profiler::s_threadBufferCapacity / 2;
+        constexpr double targetNanoseconds = 50.0;
+        double enabledMilliseconds = 0.0;
+        double disabledMilliseconds = 0.0;
+        bool isCorrect = true;
+
+        Profiler::init();
+
+        const BenchmarkStopwatch timestampsStopwatch;
+
+        for (size_t i = 0; i < scopesCount; ++i) {
+            static_cast<void>(Profiler::getTimestamp());
+            static_cast<void>(Profiler::getTimestamp());
+        }
+
+        const double timestampsMilliseconds = timestampsStopwatch.getMilliseconds();
+
+        for (size_t first = 0; first < scopesCount; first += scopesPerFrame) {
+            const size_t count = std::min(scopesPerFrame, scopesCount - first);
+            BenchmarkStopwatch stopwatch;
+
+            for (size_t i = 0; i < count; ++i) {
+                PROFILE_SCOPE("Empty");
+            }
+
+            enabledMilliseconds += stopwatch.getMilliseconds();
+            Profiler::endFrame();
+
+            const std::vector<ProfileNode> &nodes = Profiler::getFrameNodes();
+            isCorrect = isCorrect && nodes.size() == 1 && nodes[0].callsCount == count;
+
+            Profiler::setEnabled(false);
+            stopwatch.restart();
+
+            for (size_t i = 0; i < count; ++i) {
+                PROFILE_SCOPE("Disabled");
+            }
+
+            disabledMilliseconds += stopwatch.getMilliseconds();
+            Profiler::setEnabled(true);
+            Profiler::endFrame();
+
+            isCorrect = isCorrect && Profiler::getFrameNodes().empty();
+        }
+
+        isCorrect = isCorrect && Profiler::getDroppedRecordsCount() == 0;
+        Profiler::shutdown();
+
+        const double scopes = static_cast<double>(scopesCount);
+
+        std::cout << "Empty PROFILE_SCOPE, " << scopesCount << " scopes:\n"
+                  << "Recorded: " << enabledMilliseconds * 1000000.0 / scopes << " ns per scope (target "
+                  << targetNanoseconds << " ns), disabled: " << disabledMilliseconds * 1000000.0 / scopes
+                  << " ns per scope, two timestamps alone: " << timestampsMilliseconds * 1000000.0 / scopes
+                  << " ns\n";
+
+        return reportCheck("Every recorded scope in the frame tree", isCorrect) ? 0 : 1;
+#else
+        (void)scopesCount;
+        std::cout << "PROFILE_SCOPE is compiled out, configure with GAME_ENGINE_PROFILING=ON\n";
+
+        return 0;
+#endif
+    }
+}
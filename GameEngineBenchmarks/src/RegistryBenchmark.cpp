@@ -0,0 +1,122 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/ECS/CommandBuffer.hpp"
+#include "GameEngineCore/ECS/Registry.hpp"
+
+#include "glm/vec3.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace GameEngine {
+    namespace {
+        struct BenchmarkPosition {
+            glm::vec3 value{0.0f};
+        };
+
+        struct BenchmarkVelocity {
+            glm::vec3 value{1.0f};
+        };
+
+        struct BenchmarkHealth {
+            float value = 100.0f;
+        };
+
+        struct BenchmarkTag {
+            uint32_t value = 0;
+        };
+    }
+
+    // Milliseconds to create, fill and destroy entitiesCount entities, and per pass for views
+    // over entities that have 2, 3 and 4 components. Every view must visit each entity once
+    // and a command buffer must recreate them all, while destroyed entities take no components.
+    int runRegistryBenchmark(const size_t entitiesCount) {
+        constexpr unsigned int iterationsCount = 10;
+        const auto noPreparation = []() {};
+        Registry registry;
+        std::vector<Entity> entities(entitiesCount);
+
+        BenchmarkStopwatch stopwatch;
+        registry.createEntities(entities.data(), entitiesCount);
+        const double createMilliseconds = stopwatch.getMilliseconds();
+
+        stopwatch.restart();
+        registry.reserve<BenchmarkPosition>(entitiesCount);
+        registry.reserve<BenchmarkVelocity>(entitiesCount);
+        registry.reserve<BenchmarkHealth>(entitiesCount);
+        registry.reserve<BenchmarkTag>(entitiesCount);
+
+        for (const Entity entity : entities) {
+            registry.addComponent<BenchmarkPosition>(entity);
+            registry.addComponent<BenchmarkVelocity>(entity);
+            registry.addComponent<BenchmarkHealth>(entity);
+            registry.addComponent<BenchmarkTag>(entity, entity.index);
+        }
+
+        const double addComponentsMilliseconds = stopwatch.getMilliseconds();
+        size_t visitsCount = 0;
+
+        const double view2Milliseconds = measureAverageMilliseconds(iterationsCount, noPreparation, [&]() {
+            registry.view<BenchmarkPosition, BenchmarkVelocity>().each(
+                [&visitsCount](const Entity, BenchmarkPosition &position, const BenchmarkVelocity &velocity) {
+                    position.value += velocity.value * 0.016f;
+                    ++visitsCount;
+                });
+        });
+
+        const double view3Milliseconds = measureAverageMilliseconds(iterationsCount, noPreparation, [&]() {
+            registry.view<BenchmarkPosition, BenchmarkVelocity, BenchmarkHealth>().each(
+                [&visitsCount](const Entity, BenchmarkPosition &position, const BenchmarkVelocity &velocity,
+                               BenchmarkHealth &health) {
+                    position.value += velocity.value * 0.016f;
+                    health.value -= 0.01f;
+                    ++visitsCount;
+                });
+        });
+
+        const double view4Milliseconds = measureAverageMilliseconds(iterationsCount, noPreparation, [&]() {
+            registry.view<BenchmarkPosition, BenchmarkVelocity, BenchmarkHealth, BenchmarkTag>().each(
+                [&visitsCount](const Entity entity, BenchmarkPosition &position, const BenchmarkVelocity &velocity,
+                               BenchmarkHealth &health, const BenchmarkTag &tag) {
+                    position.value += velocity.value * 0.016f;
+                    health.value -= 0.01f;
+                    visitsCount += tag.value == entity.index ? 1 : 0;
+                });
+        });
+
+        bool isCorrect = visitsCount == entitiesCount * iterationsCount * 3;
+
+        stopwatch.restart();
+        registry.destroyEntities(entities.data(), entitiesCount);
+        const double destroyMilliseconds = stopwatch.getMilliseconds();
+        isCorrect = isCorrect && registry.getEntitiesCount() == 0 &&
+                    registry.addComponent<BenchmarkTag>(entities[0]) == nullptr;
+
+        // Recreate everything through a command buffer, as worker threads would record it.
+        CommandBuffer commands(entitiesCount * (sizeof(BenchmarkPosition) + sizeof(BenchmarkTag) + 16));
+        stopwatch.restart();
+
+        for (size_t i = 0; i < entitiesCount; ++i) {
+            const Entity entity = commands.createEntity();
+            commands.addComponent<BenchmarkPosition>(entity);
+            commands.addComponent<BenchmarkTag>(entity, static_cast<uint32_t>(i));
+        }
+
+        commands.execute(registry);
+        const double commandBufferMilliseconds = stopwatch.getMilliseconds();
+
+        size_t recreatedCount = 0;
+        registry.view<BenchmarkPosition, BenchmarkTag>().each(
+            [&recreatedCount](const Entity, const BenchmarkPosition&, const BenchmarkTag&) { ++recreatedCount; });
+        isCorrect = isCorrect && recreatedCount == entitiesCount && registry.getEntitiesCount() == entitiesCount;
+
+        std::cout << "ECS with " << entitiesCount << " entities, ms:\n"
+                  << "Create: " << createMilliseconds << ", add 4 components: " << addComponentsMilliseconds
+                  << ", destroy: " << destroyMilliseconds << "\n"
+                  << "View over 2 / 3 / 4 components: " << view2Milliseconds << " / " << view3Milliseconds
+                  << " / " << view4Milliseconds << "\n"
+                  << "Command buffer create + 2 components: " << commandBufferMilliseconds << "\n";
+
+        return reportCheck("Views and command buffer playback", isCorrect) ? 0 : 1;
+    }
+}
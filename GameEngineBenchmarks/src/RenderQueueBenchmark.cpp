@@ -0,0 +1,63 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Rendering/RenderQueue.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace GameEngine {
+    // Average time to sort random keys with RenderQueue::radixSort and, for reference,
+    // std::stable_sort. Both must produce the same order.
+    int runRenderQueueBenchmark(const size_t keysCount) {
+        constexpr unsigned int iterationsCount = 10;
+        BenchmarkRandom random;
+        std::vector<uint64_t> sourceKeys(keysCount);
+
+        for (uint64_t &key : sourceKeys) {
+            key = random.next();
+        }
+
+        std::vector<uint64_t> keys(keysCount);
+        std::vector<uint32_t> indices(keysCount);
+        std::vector<uint64_t> scratchKeys(keysCount);
+        std::vector<uint32_t> scratchIndices(keysCount);
+
+        const double radixSortMilliseconds = measureAverageMilliseconds(iterationsCount,
+            [&]() {
+                keys = sourceKeys;
+                std::iota(indices.begin(), indices.end(), 0u);
+            },
+            [&]() {
+                RenderQueue::radixSort(keys.data(), indices.data(), scratchKeys.data(), scratchIndices.data(),
+                                       keysCount);
+            });
+
+        std::vector<uint32_t> referenceIndices(keysCount);
+
+        const double stdSortMilliseconds = measureAverageMilliseconds(iterationsCount,
+            [&]() {
+                std::iota(referenceIndices.begin(), referenceIndices.end(), 0u);
+            },
+            [&]() {
+                std::stable_sort(referenceIndices.begin(), referenceIndices.end(),
+                                 [&sourceKeys](const uint32_t left, const uint32_t right) {
+                                     return sourceKeys[left] < sourceKeys[right];
+                                 });
+            });
+
+        bool isMatching = indices == referenceIndices;
+
+        for (size_t i = 0; i < keysCount && isMatching; ++i) {
+            isMatching = keys[i] == sourceKeys[referenceIndices[i]];
+        }
+
+        std::cout << "Sorting " << keysCount << " draw keys, average of " << iterationsCount << " runs:\n"
+                  << "Radix sort: " << radixSortMilliseconds << " ms ("
+                  << static_cast<double>(keysCount) * 1000.0 / std::max(radixSortMilliseconds, 1e-6)
+                  << " keys/s), std::stable_sort: " << stdSortMilliseconds << " ms\n";
+
+        return reportCheck("Radix sort order against std::stable_sort", isMatching) ? 0 : 1;
+    }
+}
@@ -0,0 +1,83 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Rendering/OpenGL/StaticGeometryBatch.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace GameEngine {
+    // Checks StaticGeometryBatch::buildIndirectCommands and validateIndirectCommands on
+    // CPU-side arrays.
+    int runIndirectCommandsTest(const size_t) {
+        using MeshRange = StaticGeometryBatch::MeshRange;
+        using DrawInstance = StaticGeometryBatch::DrawInstance;
+        using MaterialRange = StaticGeometryBatch::MaterialRange;
+
+        const auto translation = [](const float x) {
+            glm::mat4 matrix(1.0f);
+            matrix[3].x = x;
+
+            return matrix;
+        };
+
+        // Two meshes in shared buffers: 36 indices from vertex 0, then 6 indices from vertex 8.
+        const std::vector<MeshRange> meshes {
+            { 0, 36, 0 },
+            { 36, 6, 8 }
+        };
+
+        // Interleaved draws, including one of an unknown mesh that must be skipped.
+        const std::vector<DrawInstance> draws {
+            { 1, 2, translation(0.0f) },
+            { 0, 1, translation(1.0f) },
+            { 0, 2, translation(2.0f) },
+            { 0, 1, translation(3.0f) },
+            { 7, 1, translation(4.0f) },
+            { 1, 2, translation(5.0f) }
+        };
+
+        std::vector<DrawElementsIndirectCommand> commands;
+        std::vector<glm::mat4> drawData;
+        std::vector<MaterialRange> materialRanges;
+        StaticGeometryBatch::buildIndirectCommands(meshes, draws, commands, drawData, materialRanges);
+
+        // Material 1: mesh 0 twice. Material 2: mesh 0 once, then mesh 1 twice.
+        const auto isCommand = [&commands](const size_t index, const uint32_t count, const uint32_t instanceCount,
+                                           const uint32_t firstIndex, const int32_t baseVertex,
+                                           const uint32_t baseInstance) {
+            const DrawElementsIndirectCommand &command = commands[index];
+
+            return command.count == count && command.instanceCount == instanceCount &&
+                   command.firstIndex == firstIndex && command.baseVertex == baseVertex &&
+                   command.baseInstance == baseInstance;
+        };
+
+        const float expectedOrder[] = { 1.0f, 3.0f, 2.0f, 0.0f, 5.0f };
+        bool isDrawDataCorrect = drawData.size() == 5;
+
+        for (size_t i = 0; i < drawData.size() && isDrawDataCorrect; ++i) {
+            isDrawDataCorrect = drawData[i][3].x == expectedOrder[i];
+        }
+
+        const bool isMergingCorrect = isDrawDataCorrect && commands.size() == 3 &&
+            isCommand(0, 36, 2, 0, 0, 0) && isCommand(1, 36, 1, 0, 0, 2) && isCommand(2, 6, 2, 36, 8, 3) &&
+            materialRanges.size() == 2 &&
+            materialRanges[0].materialId == 1 && materialRanges[0].firstCommand == 0 &&
+            materialRanges[0].commandsCount == 1 && materialRanges[0].instancesCount == 2 &&
+            materialRanges[1].materialId == 2 && materialRanges[1].firstCommand == 1 &&
+            materialRanges[1].commandsCount == 2 && materialRanges[1].instancesCount == 3;
+
+        // 42 indices, 12 vertices and 5 draw data entries back the commands above; shrinking any must fail.
+        const bool isValidationCorrect = StaticGeometryBatch::validateIndirectCommands(commands, 42, 12, 5) &&
+                                         !StaticGeometryBatch::validateIndirectCommands(commands, 41, 12, 5) &&
+                                         !StaticGeometryBatch::validateIndirectCommands(commands, 42, 8, 5) &&
+                                         !StaticGeometryBatch::validateIndirectCommands(commands, 42, 12, 4);
+
+        std::cout << "Indirect draw commands:\n";
+
+        const bool isCorrect = reportCheck("Merged commands and draw data", isMergingCorrect) &
+                               reportCheck("Buffer bounds validation", isValidationCorrect);
+
+        return isCorrect ? 0 : 1;
+    }
+}
@@ -0,0 +1,91 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Rendering/TextureAtlasPacker.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace GameEngine {
+    namespace {
+        // Every packed rect lies inside its layer and no two packed rects share a texel.
+        bool checkPlacements(const TextureAtlasPacker::Settings &settings,
+                             const std::vector<TextureAtlasPacker::Placement> &placements) {
+            const size_t layerArea = size_t{settings.layerWidth} * settings.layerHeight;
+            std::vector<uint8_t> coverage(layerArea * settings.maxLayersCount, 0);
+
+            for (const TextureAtlasPacker::Placement &placement : placements) {
+                if (!placement.isPacked) {
+                    continue;
+                }
+
+                if (placement.layer >= settings.maxLayersCount ||
+                    placement.x + placement.width > settings.layerWidth ||
+                    placement.y + placement.height > settings.layerHeight) {
+                    return false;
+                }
+
+                for (unsigned int y = placement.y; y < placement.y + placement.height; ++y) {
+                    uint8_t *row = coverage.data() + placement.layer * layerArea + size_t{y} * settings.layerWidth;
+
+                    for (unsigned int x = placement.x; x < placement.x + placement.width; ++x) {
+                        if (row[x] != 0) {
+                            return false;
+                        }
+
+                        row[x] = 1;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+
+    // Packs rectsCount random rects of 8-128 px into 2048x2048 layers, tallest first and in
+    // arrival order. Packed rects must stay inside their layer and never overlap.
+    int runTextureAtlasPackerBenchmark(const size_t rectsCount) {
+        constexpr unsigned int minSize = 8;
+        constexpr unsigned int maxSize = 128;
+        const TextureAtlasPacker::Settings settings;
+        BenchmarkRandom random;
+        std::vector<std::pair<unsigned int, unsigned int>> sizes(rectsCount);
+
+        for (std::pair<unsigned int, unsigned int> &size : sizes) {
+            size.first = minSize + static_cast<unsigned int>(random.nextIndex(maxSize - minSize + 1));
+            size.second = minSize + static_cast<unsigned int>(random.nextIndex(maxSize - minSize + 1));
+        }
+
+        std::cout << "Packing " << rectsCount << " rects of " << minSize << "-" << maxSize << " px into "
+                  << settings.layerWidth << "x" << settings.layerHeight << " layers:\n";
+
+        bool isCorrect = true;
+
+        for (const bool sortByHeight : { true, false }) {
+            TextureAtlasPacker packer(settings);
+            std::vector<TextureAtlasPacker::Placement> placements(sizes.size());
+            size_t packedCount = 0;
+            const BenchmarkStopwatch stopwatch;
+
+            if (sortByHeight) {
+                packedCount = packer.packAll(sizes, placements);
+            } else {
+                for (size_t i = 0; i < sizes.size(); ++i) {
+                    packedCount += packer.pack(sizes[i].first, sizes[i].second, placements[i]) ? 1 : 0;
+                }
+            }
+
+            const double milliseconds = stopwatch.getMilliseconds();
+
+            std::cout << (sortByHeight ? "Tallest first: " : "Arrival order: ") << milliseconds << " ms ("
+                      << static_cast<double>(rectsCount) * 1000.0 / std::max(milliseconds, 1e-6)
+                      << " rects/s), packed " << packedCount << " into " << packer.getLayersCount()
+                      << " layers, occupancy " << packer.getOccupancy() * 100.0 << "%\n";
+
+            isCorrect = checkPlacements(settings, placements) && isCorrect;
+        }
+
+        return reportCheck("Placements inside their layers without overlaps", isCorrect) ? 0 : 1;
+    }
+}
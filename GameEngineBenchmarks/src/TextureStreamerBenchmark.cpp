@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+#include "GameEngineCore/Rendering/Headless/HeadlessContext.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/TextureStreamer.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace GameEngine {
+    // Streams texturesCount procedurally decoded textures into the null backend until every
+    // decode and upload has finished. Streaming must settle within the frames limit and stay
+    // inside the memory budget.
+    int runTextureStreamerBenchmark(const size_t texturesCount) {
+        constexpr unsigned int textureSize = 512;
+        constexpr size_t maxFramesCount = 100000;
+
+        if (!RendererOpenGL::initHeadless(RenderBackend::Null)) {
+            return 1;
+        }
+
+        JobSystem::init();
+
+        TextureStreamer::Settings settings;
+        settings.memoryBudget = 256 * 1024 * 1024;
+
+        std::vector<uintptr_t> seeds(texturesCount);
+        TextureStreamer::Statistics statistics;
+        size_t framesCount = 0;
+        const BenchmarkStopwatch stopwatch;
+
+        {
+            TextureStreamer streamer(settings);
+
+            for (size_t i = 0; i < texturesCount; ++i) {
+                seeds[i] = i;
+                streamer.request(textureSize, textureSize,
+                                 [](void *userData, unsigned char *pixels, const unsigned int width,
+                                    const unsigned int height) {
+                                     const auto seed = static_cast<unsigned char>(*static_cast<uintptr_t*>(userData));
+
+                                     for (size_t index = 0; index < size_t{width} * height * 3; ++index) {
+                                         pixels[index] = static_cast<unsigned char>(index * 31 + seed);
+                                     }
+                                 },
+                                 &seeds[i]);
+            }
+
+            size_t uploadsCount = 0;
+
+            while (framesCount < maxFramesCount) {
+                streamer.update();
+                ++framesCount;
+
+                if (streamer.getStatistics().pendingDecodesCount == 0 &&
+                    streamer.getStatistics().uploadsCount == uploadsCount) {
+                    break;
+                }
+
+                uploadsCount = streamer.getStatistics().uploadsCount;
+            }
+
+            statistics = streamer.getStatistics();
+        }
+
+        const double seconds = stopwatch.getMilliseconds() / 1000.0;
+
+        JobSystem::shutdown();
+        HeadlessContext::shutdown();
+
+        std::cout << "Streamed " << texturesCount << " textures of " << textureSize << "x" << textureSize
+                  << " in " << framesCount << " frames, " << seconds << " s\n"
+                  << "Mip uploads: " << statistics.uploadsCount << " ("
+                  << static_cast<double>(statistics.uploadsCount) / seconds << " uploads/s, "
+                  << static_cast<double>(statistics.uploadedBytes) / (1024.0 * 1024.0) / seconds
+                  << " MiB/s), evictions: " << statistics.evictionsCount << "\n";
+
+        return reportCheck("Streaming settled within the memory budget",
+                           framesCount < maxFramesCount && statistics.residentBytes <= settings.memoryBudget) ? 0 : 1;
+    }
+}
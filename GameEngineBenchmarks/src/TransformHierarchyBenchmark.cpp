@@ -0,0 +1,126 @@
+#include "Benchmark.hpp"
+
+#include "GameEngineCore/Scene/TransformHierarchy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace GameEngine {
+    // Average update time of a hierarchy of nodesCount nodes with 5% of them dirtied every
+    // frame. World matrices must match a naive parent-first recomputation.
+    int runTransformHierarchyBenchmark(const size_t nodesCount) {
+        constexpr uint32_t s_groupSize = 16;
+        constexpr float s_dirtyFraction = 0.05f;
+        constexpr unsigned int iterationsCount = 100;
+        BenchmarkRandom random;
+
+        const auto nextVector = [&random](const float scale) {
+            return glm::vec3(random.nextFloat(0.0f, scale), random.nextFloat(0.0f, scale),
+                             random.nextFloat(0.0f, scale));
+        };
+
+        // Small trees of 16 nodes, each node parented to a random earlier node of its tree.
+        TransformHierarchy hierarchy;
+        std::vector<TransformHandle> handles;
+        handles.reserve(nodesCount);
+
+        for (size_t i = 0; i < nodesCount; ++i) {
+            const uint32_t groupOffset = static_cast<uint32_t>(i % s_groupSize);
+            const TransformHandle parent = groupOffset != 0 ?
+                handles[i - 1 - random.nextIndex(groupOffset)] : TransformHierarchy::s_invalidHandle;
+            const TransformHandle handle = hierarchy.create(parent);
+
+            hierarchy.setPosition(handle, nextVector(10.0f));
+            hierarchy.setRotation(handle, nextVector(360.0f));
+            handles.push_back(handle);
+        }
+
+        hierarchy.update();
+
+        const size_t dirtyCount = static_cast<size_t>(static_cast<float>(nodesCount) * s_dirtyFraction);
+        size_t updatedNodesCount = 0;
+
+        const double updateMilliseconds = measureAverageMilliseconds(iterationsCount,
+            [&]() {
+                hierarchy.beginSimulationStep();
+
+                for (size_t i = 0; i < dirtyCount; ++i) {
+                    const TransformHandle handle = handles[random.nextIndex(nodesCount)];
+
+                    hierarchy.setPosition(handle, nextVector(10.0f));
+                    hierarchy.setRotation(handle, nextVector(360.0f));
+                }
+            },
+            [&]() {
+                hierarchy.update();
+                updatedNodesCount += hierarchy.getLastUpdatedCount();
+            });
+
+        updatedNodesCount /= iterationsCount;
+
+        // Nothing was destroyed, so handle indices are creation indices and parents come first.
+        std::vector<glm::mat4> expected(nodesCount);
+        bool isMatching = true;
+
+        for (size_t i = 0; i < nodesCount && isMatching; ++i) {
+            const TransformHandle handle = handles[i];
+            const TransformHandle parent = hierarchy.getParent(handle);
+            const glm::mat4 local = TransformHierarchy::composeMatrix(
+                hierarchy.getPosition(handle), hierarchy.getRotation(handle), hierarchy.getScale(handle));
+
+            expected[i] = parent != TransformHierarchy::s_invalidHandle ? expected[parent.index] * local : local;
+
+            const glm::mat4 &actual = hierarchy.getWorldMatrix(handle);
+
+            for (int column = 0; column < 4 && isMatching; ++column) {
+                for (int row = 0; row < 4; ++row) {
+                    if (std::abs(actual[column][row] - expected[i][column][row]) > 1e-3f) {
+                        isMatching = false;
+                    }
+                }
+            }
+        }
+
+        // A step keeps the world matrices from before it as the previous state, and a node created
+        // during the step starts at rest instead of moving from identity.
+        const TransformHandle moved = handles[0];
+        const glm::mat4 worldBeforeStep = hierarchy.getWorldMatrix(moved);
+
+        hierarchy.beginSimulationStep();
+        hierarchy.setPosition(moved, hierarchy.getPosition(moved) + glm::vec3(1.0f));
+
+        const TransformHandle created = hierarchy.create();
+        hierarchy.setPosition(created, glm::vec3(5.0f));
+        hierarchy.update();
+
+        bool isPreviousCorrect = hierarchy.getPreviousWorldMatrix(moved) == worldBeforeStep &&
+                                 hierarchy.getWorldMatrix(moved) != worldBeforeStep &&
+                                 hierarchy.getPreviousWorldMatrix(created) == hierarchy.getWorldMatrix(created);
+
+        hierarchy.beginSimulationStep();
+        isPreviousCorrect = isPreviousCorrect &&
+                            hierarchy.getPreviousWorldMatrix(moved) == hierarchy.getWorldMatrix(moved);
+
+        // Invalid handles are rejected instead of indexing past the arrays.
+        hierarchy.setPosition(TransformHierarchy::s_invalidHandle, glm::vec3(1.0f));
+
+        const bool isInvalidHandleRejected =
+            hierarchy.getWorldMatrix(TransformHierarchy::s_invalidHandle) == glm::mat4(1.0f) &&
+            hierarchy.getParent(TransformHierarchy::s_invalidHandle) == TransformHierarchy::s_invalidHandle;
+
+        std::cout << "Transform hierarchy with " << nodesCount << " nodes, " << s_dirtyFraction * 100.0f
+                  << "% dirty per frame:\n"
+                  << "Update: " << updateMilliseconds << " ms, " << updatedNodesCount
+                  << " nodes recomputed including descendants ("
+                  << updateMilliseconds * 1000000.0 / std::max<size_t>(updatedNodesCount, 1)
+                  << " ns per node)\n";
+
+        const bool isCorrect = reportCheck("World matrices against the naive reference", isMatching) &
+                               reportCheck("Previous world matrices across a step", isPreviousCorrect) &
+                               reportCheck("Invalid handles rejected", isInvalidHandleRejected);
+
+        return isCorrect ? 0 : 1;
+    }
+}
@@ -0,0 +1,62 @@
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "Benchmark.hpp"
+
+static const GameEngine::Benchmark s_benchmarks[] {
+    { "sort", "keys", 1000000, GameEngine::runRenderQueueBenchmark },
+    { "culling", "objects", 1000000, GameEngine::runCullingBenchmark },
+    { "ecs", "entities", 1000000, GameEngine::runRegistryBenchmark },
+    { "transform", "nodes", 100000, GameEngine::runTransformHierarchyBenchmark },
+    { "jobs", "jobs", 100000, GameEngine::runJobSystemBenchmark },
+    { "log", "messages", 100000, GameEngine::runLogBenchmark },
+    { "profiler", "scopes", 1000000, GameEngine::runProfilerBenchmark },
+    { "texture", "textures", 64, GameEngine::runTextureStreamerBenchmark },
+    { "procedural", "iterations", 20, GameEngine::runProceduralImageBenchmark },
+    { "atlas", "rects", 4096, GameEngine::runTextureAtlasPackerBenchmark },
+    { "gpu-profiler", nullptr, 0, GameEngine::runGpuProfilerTest },
+    { "indirect", nullptr, 0, GameEngine::runIndirectCommandsTest },
+};
+
+static void printUsage(const char *program) {
+    std::cerr << "Usage: " << program << " <benchmark> [argument]\n";
+
+    for (const GameEngine::Benchmark &benchmark : s_benchmarks) {
+        std::cerr << "  " << benchmark.name;
+
+        if (benchmark.argumentName != nullptr) {
+            std::cerr << " [" << benchmark.argumentName << ", default " << benchmark.defaultArgument << "]";
+        }
+
+        std::cerr << "\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        printUsage(argv[0]);
+
+        return 1;
+    }
+
+    for (const GameEngine::Benchmark &benchmark : s_benchmarks) {
+        if (std::strcmp(argv[1], benchmark.name) != 0) {
+            continue;
+        }
+
+        const size_t argument = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : benchmark.defaultArgument;
+
+        if (benchmark.argumentName != nullptr && argument == 0) {
+            std::cerr << benchmark.name << " needs a positive " << benchmark.argumentName << " count\n";
+
+            return 1;
+        }
+
+        return benchmark.run(argument);
+    }
+
+    printUsage(argv[0]);
+
+    return 1;
+}
@@ -1,12 +1,57 @@
 #ifndef APP_HPP
 #define APP_HPP
 
-#include "GameEngineCore/Event.hpp"
+#include "GameEngineCore/EventBus.hpp"
 #include "GameEngineCore/Camera.hpp"
+#include "GameEngineCore/FrameClock.hpp"
+#include "GameEngineCore/ECS/CommandBuffer.hpp"
+#include "GameEngineCore/ECS/Registry.hpp"
+#include "GameEngineCore/Scene/TransformHierarchy.hpp"
+#include "GameEngineCore/Rendering/OpenGL/GpuProfiler.hpp"
+#include "GameEngineCore/Rendering/OpenGL/TextureStreamer.hpp"
+#include "GameEngineCore/Rendering/RenderBackend.hpp"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace GameEngine {
+    struct RenderSnapshot;
+    class ShaderProgram;
+    class TextureAtlas;
+    class Texture2D;
+    class StaticGeometryBatch;
+    class VertexBuffer;
+    class StreamingBuffer;
+    class IndexBuffer;
+    class VertexArray;
+    class LinearAllocator;
+    class RenderQueue;
+    template<typename Snapshot> class FramePipeline;
+
+    struct FrameStatistics {
+        size_t drawCalls = 0;
+        size_t instances = 0;
+        size_t stateChangesIssued = 0;
+        size_t stateChangesFiltered = 0;
+        size_t bufferBytes = 0;
+        size_t buffersCount = 0;
+        size_t textureBytes = 0;
+        size_t texturesCount = 0;
+        double gpuFrameMilliseconds = 0.0;
+        size_t gpuDroppedFramesCount = 0;
+        TextureStreamer::Statistics textureStreaming;
+    };
+
+    // Time from App::start to the first frame, with the program binary cache share.
+    struct StartupStatistics {
+        double milliseconds = 0.0;
+        size_t programCacheHits = 0;
+        size_t programCacheMisses = 0;
+        double programCompileMilliseconds = 0.0;
+        double programCacheSavedMilliseconds = 0.0;
+    };
+
     class App {
     public:
         App();
@@ -21,7 +66,7 @@ namespace GameEngine {
                           const char *title);
         void close();
 
-        virtual void onUpdate() {}
+        virtual void onUpdate(const float deltaTime) {}
         virtual void onUIDraw() {}
 
         virtual void onMouseButtonEvent(const MouseButton buttonCode,
@@ -31,6 +76,26 @@ namespace GameEngine {
         
         glm::vec2 getCurrentCursorPosition() const;
 
+        const FrameClock &getFrameClock() const { return m_frameClock; }
+        float getInterpolationAlpha() const { return m_interpolationAlpha; }
+        FrameStatistics getFrameStatistics() const;
+        const std::vector<GpuProfiler::Timing> &getGpuTimings() const;
+        const StartupStatistics &getStartupStatistics() const { return m_startupStatistics; }
+
+        bool fixedTimeStepEnabled = true;
+        double fixedTimeStep = 1.0 / 120.0;
+        double maxFrameTime = 0.25;
+        unsigned int maxSimulationStepsPerFrame = 8;
+        bool pipelinedRendering = false;
+        RenderBackend renderBackend = RenderBackend::OpenGL;
+        uint64_t framesLimit = 0;
+        size_t textureMemoryBudget = 64 * 1024 * 1024;
+        // Empty disables the program binary cache.
+        std::string programBinaryCacheDirectory = "shader_cache";
+        // Cooked TextureFile shown on the demo cubes instead of the procedural smile texture.
+        std::string texturePath;
+
+        float backgroundColor[4] = { 0.33f, 0.33f, 0.33f, 0.0f };
         float cameraPosition[3] = { 0.0f, 0.0f, 1.0f };
         float cameraRotation[3] = { 0.0f, 0.0f, 0.0f };
         float cameraFov = 60.0f;
@@ -38,14 +103,52 @@ namespace GameEngine {
         float cameraFarPlane = 100.0f;
         bool perspectiveCamera = true;
         Camera camera{glm::vec3{-5.0f, 0.0f, 0.0f}};
+        Registry registry;
+        // Structural changes recorded during onUpdate, applied once simulation of the frame is done.
+        CommandBuffer commands;
+        TransformHierarchy transforms;
 
     private:
         void draw();
+        void simulate(const double frameTime);
+        void beginSimulationStep();
+        void buildSnapshot(RenderSnapshot &snapshot);
+        void renderSnapshot(const RenderSnapshot &snapshot);
+
+        static void simulateFrame(void *app, RenderSnapshot &snapshot);
+        static void renderFrame(void *app, const RenderSnapshot &snapshot);
 
         std::unique_ptr<class Window> m_window;
 
-        EventDispatcher m_eventDispatcher;
+        EventBus m_eventBus;
         bool m_isCloseWindow = false;
+
+        FrameClock m_frameClock;
+        double m_simulationAccumulator = 0.0;
+        float m_interpolationAlpha = 1.0f;
+        // Camera state before the last simulation step, blended towards the current one by the alpha.
+        glm::vec3 m_previousCameraPosition{ 0.0f };
+        glm::vec3 m_previousCameraRotation{ 0.0f };
+        uint64_t m_presentedInputTimestamp = 0;
+        StartupStatistics m_startupStatistics;
+
+        // Scene resources, created by start and released before the window takes the context down.
+        std::unique_ptr<ShaderProgram> m_shaderProgram;
+        std::unique_ptr<ShaderProgram> m_staticShaderProgram;
+        std::unique_ptr<ShaderProgram> m_atlasShaderProgram;
+        std::unique_ptr<TextureAtlas> m_textureAtlas;
+        std::unique_ptr<Texture2D> m_loadedTexture;
+        std::unique_ptr<StaticGeometryBatch> m_staticGeometry;
+        std::unique_ptr<VertexBuffer> m_cubePositionsVBO;
+        std::unique_ptr<StreamingBuffer> m_streamingBuffer;
+        std::unique_ptr<IndexBuffer> m_cubeIndexBuffer;
+        std::unique_ptr<TextureStreamer> m_textureStreamer;
+        std::unique_ptr<VertexArray> m_vao;
+        std::unique_ptr<LinearAllocator> m_frameAllocator;
+        std::unique_ptr<RenderQueue> m_renderQueue;
+        std::unique_ptr<LinearAllocator> m_simulationAllocator;
+        std::unique_ptr<FramePipeline<RenderSnapshot>> m_framePipeline;
+        std::unique_ptr<GpuProfiler> m_gpuProfiler;
     };
 }
 
@@ -1,6 +1,8 @@
 #ifndef CAMERA_HPP
 #define CAMERA_HPP
 
+#include "GameEngineCore/Math/Frustum.hpp"
+
 #include "glm/vec3.hpp"
 #include "glm/ext/matrix_float4x4.hpp"
 
@@ -27,6 +29,7 @@ namespace GameEngine {
 
         const glm::mat4 &getViewMatrix();
         const glm::mat4 &getProjectionMatrix() const { return m_projectionMatrix; }
+        Frustum getFrustum();
 
         const float getFarClipPlane() const { return m_farClipPlane; }
         const float getNearClipPlane() const { return m_nearClipPlane; }
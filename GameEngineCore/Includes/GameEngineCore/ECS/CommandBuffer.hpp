@@ -0,0 +1,90 @@
+#ifndef COMMAND_BUFFER_HPP
+#define COMMAND_BUFFER_HPP
+
+#include "GameEngineCore/ECS/Registry.hpp"
+#include "GameEngineCore/Memory/LinearAllocator.hpp"
+
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace GameEngine {
+    class CommandBuffer {
+    public:
+        explicit CommandBuffer(const size_t payloadCapacity = 64 * 1024);
+        ~CommandBuffer();
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer &operator=(const CommandBuffer&) = delete;
+
+        Entity createEntity();
+        void destroyEntity(const Entity entity);
+
+        template<typename T, typename... Args>
+        bool addComponent(const Entity entity, Args&&... args) {
+            void *payload = m_payloads.allocate(sizeof(T), alignof(T));
+
+            if (payload == nullptr) {
+                return false;
+            }
+
+            new (payload) T{std::forward<Args>(args)...};
+
+            Command command;
+            command.type = CommandType::AddComponent;
+            command.entity = entity;
+            command.payload = payload;
+            command.apply = [](Registry &registry, const Entity target, void *data) {
+                T *component = static_cast<T*>(data);
+                registry.addComponent<T>(target, std::move(*component));
+                component->~T();
+            };
+            command.discard = [](void *data) { static_cast<T*>(data)->~T(); };
+            m_commands.push_back(command);
+
+            return true;
+        }
+
+        template<typename T>
+        void removeComponent(const Entity entity) {
+            Command command;
+            command.type = CommandType::RemoveComponent;
+            command.entity = entity;
+            command.apply = [](Registry &registry, const Entity target, void*) {
+                registry.removeComponent<T>(target);
+            };
+            m_commands.push_back(command);
+        }
+
+        void execute(Registry &registry);
+        void clear();
+
+        bool isEmpty() const { return m_commands.empty(); }
+        size_t getCommandsCount() const { return m_commands.size(); }
+
+    private:
+        enum class CommandType {
+            CreateEntity,
+            DestroyEntity,
+            AddComponent,
+            RemoveComponent
+        };
+
+        struct Command {
+            CommandType type = CommandType::CreateEntity;
+            Entity entity;
+            void *payload = nullptr;
+            void (*apply)(Registry&, const Entity, void*) = nullptr;
+            void (*discard)(void*) = nullptr;
+        };
+
+        Entity resolve(const Entity entity) const;
+
+        std::vector<Command> m_commands;
+        std::vector<Entity> m_createdEntities;
+        LinearAllocator m_payloads;
+        uint32_t m_deferredCount = 0;
+    };
+}
+
+#endif
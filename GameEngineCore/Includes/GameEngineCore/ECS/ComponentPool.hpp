@@ -0,0 +1,116 @@
+#ifndef COMPONENT_POOL_HPP
+#define COMPONENT_POOL_HPP
+
+#include "GameEngineCore/ECS/Entity.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace GameEngine {
+    class ComponentTypeId {
+    public:
+        template<typename T>
+        static uint32_t get() {
+            static const uint32_t id = s_nextId.fetch_add(1, std::memory_order_relaxed);
+
+            return id;
+        }
+
+    private:
+        inline static std::atomic<uint32_t> s_nextId{0};
+    };
+
+    class IComponentPool {
+    public:
+        virtual ~IComponentPool() = default;
+
+        virtual bool contains(const Entity entity) const = 0;
+        virtual void remove(const Entity entity) = 0;
+        virtual size_t getSize() const = 0;
+        virtual const Entity *getEntities() const = 0;
+    };
+
+    template<typename T>
+    class ComponentPool final : public IComponentPool {
+    public:
+        static constexpr uint32_t s_invalidDenseIndex = std::numeric_limits<uint32_t>::max();
+
+        void reserve(const size_t capacity) {
+            m_entities.reserve(capacity);
+            m_components.reserve(capacity);
+        }
+
+        template<typename... Args>
+        T &emplace(const Entity entity, Args&&... args) {
+            if (entity.index >= m_sparse.size()) {
+                m_sparse.resize(static_cast<size_t>(entity.index) + 1, s_invalidDenseIndex);
+            }
+
+            uint32_t &denseIndex = m_sparse[entity.index];
+
+            if (denseIndex != s_invalidDenseIndex) {
+                m_entities[denseIndex] = entity;
+                m_components[denseIndex] = T{std::forward<Args>(args)...};
+
+                return m_components[denseIndex];
+            }
+
+            denseIndex = static_cast<uint32_t>(m_entities.size());
+            m_entities.push_back(entity);
+            m_components.push_back(T{std::forward<Args>(args)...});
+
+            return m_components.back();
+        }
+
+        bool contains(const Entity entity) const override {
+            return entity.index < m_sparse.size() &&
+                   m_sparse[entity.index] != s_invalidDenseIndex &&
+                   m_entities[m_sparse[entity.index]] == entity;
+        }
+
+        void remove(const Entity entity) override {
+            if (!contains(entity)) {
+                return;
+            }
+
+            const uint32_t denseIndex = m_sparse[entity.index];
+            const uint32_t lastIndex = static_cast<uint32_t>(m_entities.size() - 1);
+
+            if (denseIndex != lastIndex) {
+                m_entities[denseIndex] = m_entities[lastIndex];
+                m_components[denseIndex] = std::move(m_components[lastIndex]);
+                m_sparse[m_entities[denseIndex].index] = denseIndex;
+            }
+
+            m_entities.pop_back();
+            m_components.pop_back();
+            m_sparse[entity.index] = s_invalidDenseIndex;
+        }
+
+        T *get(const Entity entity) {
+            return contains(entity) ? &m_components[m_sparse[entity.index]] : nullptr;
+        }
+
+        const T *get(const Entity entity) const {
+            return contains(entity) ? &m_components[m_sparse[entity.index]] : nullptr;
+        }
+
+        T &getDense(const size_t denseIndex) { return m_components[denseIndex]; }
+        T &getUnchecked(const Entity entity) { return m_components[m_sparse[entity.index]]; }
+
+        size_t getSize() const override { return m_entities.size(); }
+        const Entity *getEntities() const override { return m_entities.data(); }
+        T *getComponents() { return m_components.data(); }
+
+    private:
+        std::vector<uint32_t> m_sparse;
+        std::vector<Entity> m_entities;
+        std::vector<T> m_components;
+    };
+}
+
+#endif
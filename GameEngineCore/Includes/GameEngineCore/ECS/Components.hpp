@@ -0,0 +1,30 @@
+#ifndef COMPONENTS_HPP
+#define COMPONENTS_HPP
+
+#include "GameEngineCore/Scene/TransformHierarchy.hpp"
+
+#include <array>
+
+namespace GameEngine {
+    class VertexArray;
+    class ShaderProgram;
+    class Texture2D;
+    class Texture2DArray;
+
+    struct TransformComponent {
+        TransformHierarchy::Handle node = TransformHierarchy::s_invalidHandle;
+    };
+
+    struct MeshRendererComponent {
+        const VertexArray *vertexArray = nullptr;
+        ShaderProgram *shaderProgram = nullptr;
+        std::array<const Texture2D*, 4> textures{};
+        const Texture2DArray *textureArray = nullptr;
+    };
+
+    struct BoundingSphereComponent {
+        float radius = 1.0f;
+    };
+}
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef ENTITY_HPP
+#define ENTITY_HPP
+
+#include <cstdint>
+#include <limits>
+
+namespace GameEngine {
+    struct Entity {
+        static constexpr uint32_t s_invalidIndex = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t s_deferredGeneration = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = s_invalidIndex;
+        uint32_t generation = 0;
+
+        bool isValid() const { return index != s_invalidIndex; }
+        bool isDeferred() const { return generation == s_deferredGeneration; }
+
+        bool operator==(const Entity &other) const {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const Entity &other) const { return !(*this == other); }
+    };
+}
+
+#endif
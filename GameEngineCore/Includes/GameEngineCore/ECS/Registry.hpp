@@ -0,0 +1,164 @@
+#ifndef REGISTRY_HPP
+#define REGISTRY_HPP
+
+#include "GameEngineCore/ECS/Entity.hpp"
+#include "GameEngineCore/ECS/ComponentPool.hpp"
+
+#include <array>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace GameEngine {
+    class Registry;
+
+    template<typename... Components>
+    class View {
+    public:
+        explicit View(Registry &registry);
+
+        template<typename Function>
+        void each(Function &&function);
+
+        size_t getCandidatesCount() const {
+            return m_driver != nullptr ? m_driver->getSize() : 0;
+        }
+
+    private:
+        template<size_t... Indices>
+        bool containsAll(const Entity entity, std::index_sequence<Indices...>) const {
+            return (std::get<Indices>(m_pools)->contains(entity) && ...);
+        }
+
+        std::tuple<ComponentPool<Components>*...> m_pools;
+        const IComponentPool *m_driver = nullptr;
+    };
+
+    class Registry {
+    public:
+        Registry() = default;
+
+        Registry(const Registry&) = delete;
+        Registry &operator=(const Registry&) = delete;
+
+        Entity createEntity();
+        void createEntities(Entity *entities, const size_t count);
+        void destroyEntity(const Entity entity);
+        void destroyEntities(const Entity *entities, const size_t count);
+        bool isAlive(const Entity entity) const;
+
+        size_t getEntitiesCount() const { return m_aliveCount; }
+
+        // Null when the entity isn't alive, so a stale handle can't attach to a reused index.
+        template<typename T, typename... Args>
+        T *addComponent(const Entity entity, Args&&... args) {
+            if (!isAlive(entity)) {
+                return nullptr;
+            }
+
+            return &getOrCreatePool<T>().emplace(entity, std::forward<Args>(args)...);
+        }
+
+        template<typename T>
+        void removeComponent(const Entity entity) {
+            if (ComponentPool<T> *pool = findPool<T>()) {
+                pool->remove(entity);
+            }
+        }
+
+        template<typename T>
+        T *getComponent(const Entity entity) {
+            ComponentPool<T> *pool = findPool<T>();
+
+            return pool != nullptr ? pool->get(entity) : nullptr;
+        }
+
+        template<typename T>
+        bool hasComponent(const Entity entity) const {
+            const uint32_t typeId = ComponentTypeId::get<T>();
+
+            return typeId < m_pools.size() && m_pools[typeId] != nullptr &&
+                   m_pools[typeId]->contains(entity);
+        }
+
+        template<typename T>
+        void reserve(const size_t capacity) {
+            getOrCreatePool<T>().reserve(capacity);
+        }
+
+        template<typename... Components>
+        View<Components...> view() {
+            return View<Components...>(*this);
+        }
+
+        template<typename T>
+        ComponentPool<T> *findPool() {
+            const uint32_t typeId = ComponentTypeId::get<T>();
+
+            return typeId < m_pools.size() ?
+                static_cast<ComponentPool<T>*>(m_pools[typeId].get()) : nullptr;
+        }
+
+        template<typename T>
+        ComponentPool<T> &getOrCreatePool() {
+            const uint32_t typeId = ComponentTypeId::get<T>();
+
+            if (typeId >= m_pools.size()) {
+                m_pools.resize(static_cast<size_t>(typeId) + 1);
+            }
+
+            if (m_pools[typeId] == nullptr) {
+                m_pools[typeId] = std::make_unique<ComponentPool<T>>();
+            }
+
+            return *static_cast<ComponentPool<T>*>(m_pools[typeId].get());
+        }
+
+    private:
+        std::vector<uint32_t> m_generations;
+        std::vector<uint32_t> m_freeIndices;
+        std::vector<std::unique_ptr<IComponentPool>> m_pools;
+        size_t m_aliveCount = 0;
+    };
+
+    template<typename... Components>
+    View<Components...>::View(Registry &registry)
+        : m_pools{registry.findPool<Components>()...} {
+        const std::array<const IComponentPool*, sizeof...(Components)> pools{
+            std::get<ComponentPool<Components>*>(m_pools)...
+        };
+
+        for (const IComponentPool *pool : pools) {
+            if (pool == nullptr) {
+                m_driver = nullptr;
+
+                return;
+            }
+
+            if (m_driver == nullptr || pool->getSize() < m_driver->getSize()) {
+                m_driver = pool;
+            }
+        }
+    }
+
+    template<typename... Components>
+    template<typename Function>
+    void View<Components...>::each(Function &&function) {
+        if (m_driver == nullptr) {
+            return;
+        }
+
+        const Entity *entities = m_driver->getEntities();
+        const size_t count = m_driver->getSize();
+
+        for (size_t i = 0; i < count; ++i) {
+            const Entity entity = entities[i];
+
+            if (containsAll(entity, std::index_sequence_for<Components...>{})) {
+                function(entity, std::get<ComponentPool<Components>*>(m_pools)->getUnchecked(entity)...);
+            }
+        }
+    }
+}
+
+#endif
@@ -3,9 +3,6 @@
 
 #include "GameEngineCore/Keys.hpp"
 
-#include <functional>
-#include <array>
-
 namespace GameEngine {
     enum class EventType {
         WindowResize = 0,
@@ -21,136 +18,105 @@ namespace GameEngine {
         EventsCount
     };
 
-    struct BaseEvent {
-        virtual ~BaseEvent() = default;
-        virtual EventType getType() const = 0;
-    };
-
-    class EventDispatcher {
-    public:
-        template<typename EventType>
-        void addEventListener(std::function<void(EventType&)> callback) {
-            auto baseCallback = [function = std::move(callback)](BaseEvent &event) {
-                if (event.getType() == EventType::type) {
-                    function(static_cast<EventType&>(event));
-                }
-            };
-
-            m_eventCallbacks[static_cast<size_t>(EventType::type)] = std::move(baseCallback);
-        }
-
-        void dispatch(BaseEvent &event) {
-            auto &callback = m_eventCallbacks[static_cast<size_t>(event.getType())];
-
-            if (callback) {
-                callback(event);
-            }
-        }
-
-    private:
-        std::array<std::function<void(BaseEvent&)>, static_cast<size_t>(EventType::EventsCount)> m_eventCallbacks;
-    };
-
-    struct EventMouseMoved : public BaseEvent {
-        double x;
-        double y;
+    struct EventMouseMoved {
+        double x = 0.0;
+        double y = 0.0;
 
         static const EventType type = EventType::MouseMoved;
 
+        EventMouseMoved() = default;
         EventMouseMoved(const double newX, const double newY)
             : x{newX}, y{newY} {
 
         }
-
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventWindowResize : public BaseEvent {
-        int width;
-        int height;
+    struct EventWindowResize {
+        int width = 0;
+        int height = 0;
 
         static const EventType type = EventType::WindowResize;
 
+        EventWindowResize() = default;
         EventWindowResize(const int newWidth, const int newHeight)
             : width{newWidth}, height{newHeight} {
             
         }
-
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventWindowClose : public BaseEvent {
+    struct EventWindowClose {
         static const EventType type = EventType::WindowClose;
-        
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventKeyPressed : public BaseEvent {
-        KeyCode m_keyCode;
-        bool m_repeated;
+    struct EventKeyPressed {
+        KeyCode m_keyCode = KeyCode::KEY_UNKNOWN;
+        bool m_repeated = false;
 
         static const EventType type = EventType::KeyPressed;
 
+        EventKeyPressed() = default;
         EventKeyPressed(const KeyCode keyCode, const bool repeated)
             : m_keyCode{keyCode}, m_repeated{repeated} {}
-        
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventKeyReleased : public BaseEvent {
-        KeyCode m_keyCode;
+    struct EventKeyReleased {
+        KeyCode m_keyCode = KeyCode::KEY_UNKNOWN;
 
         static const EventType type = EventType::KeyReleased;
 
+        EventKeyReleased() = default;
         EventKeyReleased(const KeyCode keyCode)
             : m_keyCode{keyCode} {}
-        
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventMouseButtonPressed : public BaseEvent {
-        MouseButton m_mouseButton;
+    struct EventMouseButtonPressed {
+        MouseButton m_mouseButton = MouseButton::MOUSE_BUTTON_1;
 
-        double m_positionX;
-        double m_positionY;
+        double m_positionX = 0.0;
+        double m_positionY = 0.0;
 
         static const EventType type = EventType::MouseButtonPressed;
 
+        EventMouseButtonPressed() = default;
         EventMouseButtonPressed(const MouseButton mouseButton,
                                 const double positionX, const double positionY)
             : m_mouseButton{mouseButton}, m_positionX{positionX}, m_positionY{positionY} {}
-
-        virtual EventType getType() const override {
-            return type;
-        }
     };
 
-    struct EventMouseButtonReleased : public BaseEvent {
-        MouseButton m_mouseButton;
+    struct EventMouseButtonReleased {
+        MouseButton m_mouseButton = MouseButton::MOUSE_BUTTON_1;
 
-        double m_positionX;
-        double m_positionY;
+        double m_positionX = 0.0;
+        double m_positionY = 0.0;
 
         static const EventType type = EventType::MouseButtonReleased;
 
+        EventMouseButtonReleased() = default;
         EventMouseButtonReleased(const MouseButton mouseButton,
                                  const double positionX, const double positionY)
             : m_mouseButton{mouseButton}, m_positionX(positionX) , m_positionY(positionY) {}
-
-        virtual EventType getType() const override {
-            return type;
-        }
     };
+
+    template<typename Event>
+    bool tryCoalesceEvent(Event&, const Event&) {
+        return false;
+    }
+
+    inline bool tryCoalesceEvent(EventMouseMoved &queued, const EventMouseMoved &incoming) {
+        queued = incoming;
+
+        return true;
+    }
+
+    inline bool tryCoalesceEvent(EventWindowResize &queued, const EventWindowResize &incoming) {
+        queued = incoming;
+
+        return true;
+    }
+
+    inline bool tryCoalesceEvent(EventKeyPressed &queued, const EventKeyPressed &incoming) {
+        return incoming.m_repeated && queued.m_keyCode == incoming.m_keyCode;
+    }
 }
 
 #endif
@@ -0,0 +1,247 @@
+#ifndef EVENT_BUS_HPP
+#define EVENT_BUS_HPP
+
+#include "GameEngineCore/Event.hpp"
+#include "GameEngineCore/Memory/InplaceFunction.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace GameEngine {
+    class EventBus {
+    public:
+        using ListenerId = uint32_t;
+
+        static constexpr ListenerId s_invalidListener = 0;
+        static constexpr uint32_t s_eventQueueCapacity = 256;
+        static constexpr uint32_t s_runsQueueCapacity = 1024;
+
+        EventBus();
+
+        EventBus(const EventBus&) = delete;
+        EventBus &operator=(const EventBus&) = delete;
+
+        template<typename Event, typename Function>
+        ListenerId subscribe(Function &&callback, const int priority = 0) {
+            Channel<Event> &channel = getChannel<Event>();
+
+            const ListenerId id = (++m_lastListenerId << 8) | static_cast<ListenerId>(Event::type);
+
+            Listener<Event> listener;
+            listener.id = id;
+            listener.priority = priority;
+
+            if constexpr (std::is_same_v<std::invoke_result_t<Function, Event&>, bool>) {
+                listener.callback = std::forward<Function>(callback);
+            } else {
+                listener.callback = [function = std::forward<Function>(callback)](Event &event) {
+                    function(event);
+
+                    return false;
+                };
+            }
+
+            if (m_isDispatching) {
+                channel.pendingListeners.push_back(std::move(listener));
+            } else {
+                insertListener(channel.listeners, std::move(listener));
+            }
+
+            return id;
+        }
+
+        void unsubscribe(const ListenerId id);
+
+        template<typename Event>
+        void enqueue(const Event &event) {
+            Channel<Event> &channel = getChannel<Event>();
+
+            if (isLastRunOpen(Event::type) &&
+                tryCoalesceEvent(channel.events[(channel.tail - 1) % s_eventQueueCapacity], event)) {
+                ++m_coalescedCount;
+
+                return;
+            }
+
+            if (channel.tail - channel.head >= s_eventQueueCapacity) {
+                ++m_droppedCount;
+
+                return;
+            }
+
+            if (!appendRun(Event::type)) {
+                ++m_droppedCount;
+
+                return;
+            }
+
+            channel.events[channel.tail % s_eventQueueCapacity] = event;
+            ++channel.tail;
+            ++m_queuedEventsCount;
+        }
+
+        template<typename Event>
+        bool publish(Event &event) {
+            Channel<Event> &channel = getChannel<Event>();
+
+            const bool wasDispatching = m_isDispatching;
+            m_isDispatching = true;
+
+            const bool consumed = invokeListeners(channel, event);
+
+            m_isDispatching = wasDispatching;
+
+            if (!m_isDispatching) {
+                flushPendingListeners();
+            }
+
+            return consumed;
+        }
+
+        void dispatchQueued();
+
+        size_t getQueuedCount() const { return m_queuedEventsCount; }
+        size_t getCoalescedCount() const { return m_coalescedCount; }
+        size_t getDroppedCount() const { return m_droppedCount; }
+
+    private:
+        template<typename Event>
+        struct Listener {
+            InplaceFunction<bool(Event&)> callback;
+            ListenerId id = s_invalidListener;
+            int priority = 0;
+        };
+
+        template<typename Event>
+        struct Channel {
+            std::array<Event, s_eventQueueCapacity> events;
+            uint32_t head = 0;
+            uint32_t tail = 0;
+
+            std::vector<Listener<Event>> listeners;
+            std::vector<Listener<Event>> pendingListeners;
+        };
+
+        struct EventRun {
+            EventType type;
+            uint32_t count;
+        };
+
+        using Channels = std::tuple<Channel<EventWindowResize>,
+                                    Channel<EventWindowClose>,
+                                    Channel<EventKeyPressed>,
+                                    Channel<EventKeyReleased>,
+                                    Channel<EventMouseButtonPressed>,
+                                    Channel<EventMouseButtonReleased>,
+                                    Channel<EventMouseMoved>>;
+
+        template<typename Event>
+        Channel<Event> &getChannel() {
+            return std::get<static_cast<size_t>(Event::type)>(m_channels);
+        }
+
+        template<typename Event>
+        static void insertListener(std::vector<Listener<Event>> &listeners, Listener<Event> &&listener) {
+            const auto position = std::upper_bound(listeners.begin(), listeners.end(), listener.priority,
+                [](const int priority, const Listener<Event> &current) {
+                    return priority > current.priority;
+                });
+
+            listeners.insert(position, std::move(listener));
+        }
+
+        template<typename Event>
+        static bool invokeListeners(Channel<Event> &channel, Event &event) {
+            const size_t listenersCount = channel.listeners.size();
+
+            for (size_t i = 0; i < listenersCount; ++i) {
+                const Listener<Event> &listener = channel.listeners[i];
+
+                if (listener.id != s_invalidListener && listener.callback(event)) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        template<typename Event>
+        void dispatchRun(const uint32_t count) {
+            Channel<Event> &channel = getChannel<Event>();
+
+            for (uint32_t i = 0; i < count; ++i) {
+                Event event = channel.events[channel.head % s_eventQueueCapacity];
+                ++channel.head;
+                --m_queuedEventsCount;
+
+                invokeListeners(channel, event);
+            }
+        }
+
+        template<typename Event>
+        static void flushChannelListeners(Channel<Event> &channel) {
+            channel.listeners.erase(
+                std::remove_if(channel.listeners.begin(), channel.listeners.end(),
+                               [](const Listener<Event> &listener) { return listener.id == s_invalidListener; }),
+                channel.listeners.end());
+
+            for (Listener<Event> &listener : channel.pendingListeners) {
+                if (listener.id != s_invalidListener) {
+                    insertListener(channel.listeners, std::move(listener));
+                }
+            }
+
+            channel.pendingListeners.clear();
+        }
+
+        template<typename Event>
+        static bool removeListener(Channel<Event> &channel, const ListenerId id, const bool deferred) {
+            for (std::vector<Listener<Event>> *listeners : { &channel.listeners, &channel.pendingListeners }) {
+                for (auto it = listeners->begin(); it != listeners->end(); ++it) {
+                    if (it->id != id) {
+                        continue;
+                    }
+
+                    if (deferred) {
+                        it->id = s_invalidListener;
+                    } else {
+                        listeners->erase(it);
+                    }
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool isLastRunOpen(const EventType type) const {
+            return m_runsTail != m_firstOpenRun &&
+                   m_runs[(m_runsTail - 1) % s_runsQueueCapacity].type == type;
+        }
+
+        bool appendRun(const EventType type);
+        void dispatchRun(const EventRun &run);
+        void flushPendingListeners();
+
+        Channels m_channels;
+
+        std::array<EventRun, s_runsQueueCapacity> m_runs;
+        uint32_t m_runsHead = 0;
+        uint32_t m_runsTail = 0;
+        uint32_t m_firstOpenRun = 0;
+
+        ListenerId m_lastListenerId = 0;
+        size_t m_queuedEventsCount = 0;
+        size_t m_coalescedCount = 0;
+        size_t m_droppedCount = 0;
+        bool m_isDispatching = false;
+    };
+}
+
+#endif
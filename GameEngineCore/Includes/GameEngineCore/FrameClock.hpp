@@ -0,0 +1,30 @@
+#ifndef FRAME_CLOCK_HPP
+#define FRAME_CLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+
+namespace GameEngine {
+    class FrameClock {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        void start();
+        double tick();
+
+        double getDeltaTime() const { return m_deltaTime; }
+        double getTotalTime() const { return m_totalTime; }
+        uint64_t getFrameIndex() const { return m_frameIndex; }
+
+        static double getSecondsSince(const Clock::time_point &timePoint);
+
+    private:
+        Clock::time_point m_startTime = Clock::now();
+        Clock::time_point m_lastTime = m_startTime;
+        double m_deltaTime = 0.0;
+        double m_totalTime = 0.0;
+        uint64_t m_frameIndex = 0;
+    };
+}
+
+#endif
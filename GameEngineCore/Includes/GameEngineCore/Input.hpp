@@ -3,22 +3,84 @@
 
 #include "GameEngineCore/Keys.hpp"
 
-#include <iostream>
+#include "glm/vec2.hpp"
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
 
 namespace GameEngine {
+    struct InputEvent {
+        enum class Type : uint8_t {
+            KeyPressed = 0,
+            KeyReleased,
+            MouseButtonPressed,
+            MouseButtonReleased,
+            CursorMoved
+        };
+
+        Type type = Type::KeyPressed;
+        int code = 0;
+        glm::vec2 cursorPosition{0.0f, 0.0f};
+        uint64_t timestamp = 0;
+    };
+
+    struct InputSnapshot {
+        static constexpr size_t s_keysCount = static_cast<size_t>(KeyCode::KEY_LAST) + 1;
+        static constexpr size_t s_mouseButtonsCount = static_cast<size_t>(MouseButton::MOUSE_BUTTON_LAST) + 1;
+
+        std::bitset<s_keysCount> keysDown;
+        std::bitset<s_keysCount> keysPressed;
+        std::bitset<s_keysCount> keysReleased;
+
+        std::bitset<s_mouseButtonsCount> mouseButtonsDown;
+        std::bitset<s_mouseButtonsCount> mouseButtonsPressed;
+        std::bitset<s_mouseButtonsCount> mouseButtonsReleased;
+
+        glm::vec2 cursorPosition{0.0f, 0.0f};
+        glm::vec2 cursorDelta{0.0f, 0.0f};
+
+        uint64_t frameIndex = 0;
+        uint64_t oldestEventTimestamp = 0;
+        size_t eventsCount = 0;
+
+        bool isKeyPressed(const KeyCode keyCode) const;
+        bool wasKeyJustPressed(const KeyCode keyCode) const;
+        bool wasKeyJustReleased(const KeyCode keyCode) const;
+
+        bool isMouseButtonPressed(const MouseButton mouseButton) const;
+        bool wasMouseButtonJustPressed(const MouseButton mouseButton) const;
+        bool wasMouseButtonJustReleased(const MouseButton mouseButton) const;
+    };
+
+    struct InputLatencyStats {
+        double lastMilliseconds = 0.0;
+        double averageMilliseconds = 0.0;
+        double maxMilliseconds = 0.0;
+        uint64_t samplesCount = 0;
+    };
+
     class Input {
     public:
         static bool isKeyPressed(const KeyCode keyCode);
-        static void pressKey(const KeyCode keyCode);
-        static void releaseKey(const KeyCode keyCode);
-
         static bool isMouseButtonPressed(const MouseButton mouseButton);
-        static void pressMouseButton(const MouseButton mouseButton);
-        static void releaseMouseButton(const MouseButton mouseButton);
+
+        static void recordKey(const KeyCode keyCode, const bool pressed);
+        static void recordMouseButton(const MouseButton mouseButton, const bool pressed,
+                                      const double positionX, const double positionY);
+        static void recordCursorPosition(const double positionX, const double positionY);
+
+        static void beginFrame(const uint64_t frameIndex);
+        static const InputSnapshot &getSnapshot();
+
+        static uint64_t getTimestamp();
+        static void onFramePresented(const uint64_t oldestEventTimestamp);
+        static InputLatencyStats getLatencyStats();
+        static void resetLatencyStats();
+        static size_t getDroppedEventsCount();
 
     private:
-        static bool m_keysPressed[];
-        static bool m_mouseButtonsPressed[];
+        static void pushEvent(const InputEvent &event);
     };
 }
 
@@ -0,0 +1,87 @@
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace GameEngine {
+    struct JobCounter {
+        std::atomic<uint32_t> value{0};
+
+        bool isDone() const { return value.load(std::memory_order_acquire) == 0; }
+    };
+
+    struct JobSlot;
+
+    struct Job {
+        using Function = void (*)(void *data, const size_t begin, const size_t end);
+
+        Function function = nullptr;
+        void *data = nullptr;
+        size_t begin = 0;
+        size_t end = 0;
+        JobCounter *counter = nullptr;
+        const JobCounter *dependency = nullptr;
+    };
+
+    class JobSystem {
+    public:
+        static constexpr size_t s_maxWorkers = 64;
+        static constexpr size_t s_jobsPerWorker = 4096;
+
+        static bool init(const size_t workersCount = 0);
+        static void shutdown();
+
+        static bool isInitialized() { return s_workersCount > 0; }
+        static size_t getWorkersCount() { return s_workersCount > 0 ? s_workersCount : 1; }
+
+        static void run(const Job::Function function, void *data, JobCounter &counter,
+                        const JobCounter *dependency = nullptr,
+                        const size_t begin = 0, const size_t end = 0);
+        static void wait(const JobCounter &counter);
+
+        static size_t computeGrainSize(const size_t count);
+
+        template<typename Function>
+        static void parallelFor(const size_t count, Function &&function, size_t grainSize = 0) {
+            using Callable = std::remove_reference_t<Function>;
+
+            if (count == 0) {
+                return;
+            }
+
+            grainSize = grainSize > 0 ? grainSize : computeGrainSize(count);
+
+            if (!isInitialized() || count <= grainSize) {
+                function(size_t{0}, count);
+
+                return;
+            }
+
+            JobCounter counter;
+            void *data = const_cast<void*>(static_cast<const void*>(&function));
+
+            for (size_t begin = grainSize; begin < count; begin += grainSize) {
+                run([](void *callable, const size_t rangeBegin, const size_t rangeEnd) {
+                        (*static_cast<Callable*>(callable))(rangeBegin, rangeEnd);
+                    },
+                    data, counter, nullptr, begin, std::min(begin + grainSize, count));
+            }
+
+            function(size_t{0}, grainSize);
+            wait(counter);
+        }
+
+    private:
+        static bool executeNext(const size_t workerIndex);
+        static void execute(JobSlot &slot);
+        static void workerLoop(const size_t workerIndex);
+
+        static size_t s_workersCount;
+    };
+}
+
+#endif
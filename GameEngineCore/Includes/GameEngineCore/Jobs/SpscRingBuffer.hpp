@@ -0,0 +1,65 @@
+#ifndef SPSC_RING_BUFFER_HPP
+#define SPSC_RING_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace GameEngine {
+    template<typename T, size_t Capacity>
+    class SpscRingBuffer {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        bool tryPush(const T &item) {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+
+            if (tail - m_cachedHead >= Capacity) {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+
+                if (tail - m_cachedHead >= Capacity) {
+                    return false;
+                }
+            }
+
+            m_items[tail & s_mask] = item;
+            m_tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        bool tryPop(T &item) {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+
+            if (head == m_cachedTail) {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+
+                if (head == m_cachedTail) {
+                    return false;
+                }
+            }
+
+            item = m_items[head & s_mask];
+            m_head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        size_t getSize() const {
+            return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+        }
+
+    private:
+        static constexpr size_t s_mask = Capacity - 1;
+
+        alignas(64) std::atomic<size_t> m_head{0};
+        size_t m_cachedTail = 0;
+
+        alignas(64) std::atomic<size_t> m_tail{0};
+        size_t m_cachedHead = 0;
+
+        alignas(64) std::array<T, Capacity> m_items{};
+    };
+}
+
+#endif
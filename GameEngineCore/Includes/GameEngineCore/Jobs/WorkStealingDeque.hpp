@@ -0,0 +1,90 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace GameEngine {
+    template<typename T, size_t Capacity>
+    class WorkStealingDeque {
+        static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        bool push(T *item) {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_top.load(std::memory_order_acquire);
+
+            if (bottom - top >= static_cast<int64_t>(Capacity)) {
+                return false;
+            }
+
+            m_items[bottom & s_mask].store(item, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        T *pop() {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom) {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+                return nullptr;
+            }
+
+            T *item = m_items[bottom & s_mask].load(std::memory_order_relaxed);
+
+            if (top == bottom) {
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed)) {
+                    item = nullptr;
+                }
+
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+
+            return item;
+        }
+
+        T *steal() {
+            int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom) {
+                return nullptr;
+            }
+
+            T *item = m_items[top & s_mask].load(std::memory_order_relaxed);
+
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+                return nullptr;
+            }
+
+            return item;
+        }
+
+        size_t getSize() const {
+            const int64_t size = m_bottom.load(std::memory_order_relaxed) -
+                                 m_top.load(std::memory_order_relaxed);
+
+            return size > 0 ? static_cast<size_t>(size) : 0;
+        }
+
+    private:
+        static constexpr int64_t s_mask = static_cast<int64_t>(Capacity) - 1;
+
+        alignas(64) std::atomic<int64_t> m_top{0};
+        alignas(64) std::atomic<int64_t> m_bottom{0};
+        alignas(64) std::array<std::atomic<T*>, Capacity> m_items{};
+    };
+}
+
+#endif
@@ -2,19 +2,185 @@
 #define LOG_HPP
 
 #include "spdlog/spdlog.h"
+#include "spdlog/sinks/sink.h"
 
-namespace GameEngine {
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#define GAME_ENGINE_LOG_LEVEL_TRACE 0
+#define GAME_ENGINE_LOG_LEVEL_DEBUG 1
+#define GAME_ENGINE_LOG_LEVEL_INFO 2
+#define GAME_ENGINE_LOG_LEVEL_WARNING 3
+#define GAME_ENGINE_LOG_LEVEL_ERROR 4
+#define GAME_ENGINE_LOG_LEVEL_CRITICAL 5
+#define GAME_ENGINE_LOG_LEVEL_OFF 6
+
+#ifndef GAME_ENGINE_LOG_ACTIVE_LEVEL
     #ifdef NDEBUG
-        #define LOG_INFO(...)
-        #define LOG_WARNING(...)
-        #define LOG_ERROR(...)
-        #define LOG_CRITICAL(...)
+        #define GAME_ENGINE_LOG_ACTIVE_LEVEL GAME_ENGINE_LOG_LEVEL_WARNING
     #else
-        #define LOG_INFO(...) spdlog::info(__VA_ARGS__)
-        #define LOG_WARNING(...) spdlog::warn(__VA_ARGS__)
-        #define LOG_ERROR(...) spdlog::error(__VA_ARGS__)
-        #define LOG_CRITICAL(...) spdlog::critical(__VA_ARGS__)
+        #define GAME_ENGINE_LOG_ACTIVE_LEVEL GAME_ENGINE_LOG_LEVEL_DEBUG
     #endif
+#endif
+
+namespace GameEngine {
+    enum class LogSubsystem : uint8_t {
+        Core = 0,
+        Window,
+        Input,
+        Rendering,
+        Scene,
+        Jobs,
+        Memory,
+
+        SubsystemsCount
+    };
+
+    struct LogConfig {
+        bool asynchronous = true;
+        size_t queueSize = 8192;
+        size_t threadsCount = 1;
+        bool blockOnOverflow = false;
+        spdlog::level::level_enum level = spdlog::level::info;
+        // Null logs to the colored stdout sink.
+        std::shared_ptr<spdlog::sinks::sink> sink;
+    };
+
+    class Log {
+    public:
+        static bool init(const LogConfig &config = LogConfig{});
+        static void shutdown();
+        static bool isInitialized();
+
+        static spdlog::logger *getLogger(const LogSubsystem subsystem);
+        static void setLevel(const LogSubsystem subsystem, const spdlog::level::level_enum level);
+        static void setLevel(const spdlog::level::level_enum level);
+        static void flush();
+
+        static size_t getDroppedMessagesCount();
+        static const char *getSubsystemName(const LogSubsystem subsystem);
+    };
+
+    class LogRateLimiter {
+    public:
+        explicit LogRateLimiter(const int64_t intervalMilliseconds)
+            : m_interval{std::chrono::milliseconds(intervalMilliseconds)} {}
+
+        bool tryAcquire(size_t &suppressedCount) {
+            const int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+            int64_t nextTime = m_nextTime.load(std::memory_order_relaxed);
+
+            if (now < nextTime ||
+                !m_nextTime.compare_exchange_strong(nextTime, now + m_interval.count(),
+                                                    std::memory_order_relaxed)) {
+                m_suppressedCount.fetch_add(1, std::memory_order_relaxed);
+
+                return false;
+            }
+
+            suppressedCount = m_suppressedCount.exchange(0, std::memory_order_relaxed);
+
+            return true;
+        }
+
+    private:
+        std::chrono::steady_clock::duration m_interval;
+        std::atomic<int64_t> m_nextTime{0};
+        std::atomic<size_t> m_suppressedCount{0};
+    };
+
+    // Only named inside sizeof, so compiled-out log calls keep their arguments used without evaluating them.
+    template<typename... Args>
+    constexpr int consumeLogArguments(const Args&...) { return 0; }
 }
 
+#define GAME_ENGINE_LOG(subsystem, level, ...)                                  \
+    do {                                                                        \
+        spdlog::logger *gameEngineLogger_ = ::GameEngine::Log::getLogger(subsystem); \
+        if (gameEngineLogger_->should_log(level)) {                             \
+            gameEngineLogger_->log(level, __VA_ARGS__);                         \
+        }                                                                       \
+    } while (false)
+
+#define GAME_ENGINE_LOG_RATE_LIMITED(subsystem, level, intervalMilliseconds, ...) \
+    do {                                                                        \
+        static ::GameEngine::LogRateLimiter gameEngineRateLimiter_{intervalMilliseconds}; \
+        spdlog::logger *gameEngineLogger_ = ::GameEngine::Log::getLogger(subsystem); \
+        size_t gameEngineSuppressed_ = 0;                                       \
+        if (gameEngineLogger_->should_log(level) &&                             \
+            gameEngineRateLimiter_.tryAcquire(gameEngineSuppressed_)) {         \
+            gameEngineLogger_->log(level, __VA_ARGS__);                         \
+            if (gameEngineSuppressed_ > 0) {                                    \
+                gameEngineLogger_->log(level, "({0} similar messages suppressed)", \
+                                       gameEngineSuppressed_);                  \
+            }                                                                   \
+        }                                                                       \
+    } while (false)
+
+#define GAME_ENGINE_LOG_DISABLED(...) static_cast<void>(sizeof(::GameEngine::consumeLogArguments(__VA_ARGS__)))
+
+#if GAME_ENGINE_LOG_ACTIVE_LEVEL <= GAME_ENGINE_LOG_LEVEL_TRACE
+    #define LOG_TRACE_TO(subsystem, ...) GAME_ENGINE_LOG(subsystem, spdlog::level::trace, __VA_ARGS__)
+    #define LOG_TRACE_RATE_LIMITED_TO(subsystem, intervalMilliseconds, ...) \
+        GAME_ENGINE_LOG_RATE_LIMITED(subsystem, spdlog::level::trace, intervalMilliseconds, __VA_ARGS__)
+#else
+    #define LOG_TRACE_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+    #define LOG_TRACE_RATE_LIMITED_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if GAME_ENGINE_LOG_ACTIVE_LEVEL <= GAME_ENGINE_LOG_LEVEL_DEBUG
+    #define LOG_DEBUG_TO(subsystem, ...) GAME_ENGINE_LOG(subsystem, spdlog::level::debug, __VA_ARGS__)
+    #define LOG_DEBUG_RATE_LIMITED_TO(subsystem, intervalMilliseconds, ...) \
+        GAME_ENGINE_LOG_RATE_LIMITED(subsystem, spdlog::level::debug, intervalMilliseconds, __VA_ARGS__)
+#else
+    #define LOG_DEBUG_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+    #define LOG_DEBUG_RATE_LIMITED_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if GAME_ENGINE_LOG_ACTIVE_LEVEL <= GAME_ENGINE_LOG_LEVEL_INFO
+    #define LOG_INFO_TO(subsystem, ...) GAME_ENGINE_LOG(subsystem, spdlog::level::info, __VA_ARGS__)
+    #define LOG_INFO_RATE_LIMITED_TO(subsystem, intervalMilliseconds, ...) \
+        GAME_ENGINE_LOG_RATE_LIMITED(subsystem, spdlog::level::info, intervalMilliseconds, __VA_ARGS__)
+#else
+    #define LOG_INFO_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+    #define LOG_INFO_RATE_LIMITED_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if GAME_ENGINE_LOG_ACTIVE_LEVEL <= GAME_ENGINE_LOG_LEVEL_WARNING
+    #define LOG_WARNING_TO(subsystem, ...) GAME_ENGINE_LOG(subsystem, spdlog::level::warn, __VA_ARGS__)
+    #define LOG_WARNING_RATE_LIMITED_TO(subsystem, intervalMilliseconds, ...) \
+        GAME_ENGINE_LOG_RATE_LIMITED(subsystem, spdlog::level::warn, intervalMilliseconds, __VA_ARGS__)
+#else
+    #define LOG_WARNING_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+    #define LOG_WARNING_RATE_LIMITED_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if GAME_ENGINE_LOG_ACTIVE_LEVEL <= GAME_ENGINE_LOG_LEVEL_ERROR
+    #define LOG_ERROR_TO(subsystem, ...) GAME_ENGINE_LOG(subsystem, spdlog::level::err, __VA_ARGS__)
+    #define LOG_ERROR_RATE_LIMITED_TO(subsystem, intervalMilliseconds, ...) \
+        GAME_ENGINE_LOG_RATE_LIMITED(subsystem, spdlog::level::err, intervalMilliseconds, __VA_ARGS__)
+#else
+    #define LOG_ERROR_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+    #define LOG_ERROR_RATE_LIMITED_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#if GAME_ENGINE_LOG_ACTIVE_LEVEL <= GAME_ENGINE_LOG_LEVEL_CRITICAL
+    #define LOG_CRITICAL_TO(subsystem, ...) GAME_ENGINE_LOG(subsystem, spdlog::level::critical, __VA_ARGS__)
+    #define LOG_CRITICAL_RATE_LIMITED_TO(subsystem, intervalMilliseconds, ...) \
+        GAME_ENGINE_LOG_RATE_LIMITED(subsystem, spdlog::level::critical, intervalMilliseconds, __VA_ARGS__)
+#else
+    #define LOG_CRITICAL_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+    #define LOG_CRITICAL_RATE_LIMITED_TO(...) GAME_ENGINE_LOG_DISABLED(__VA_ARGS__)
+#endif
+
+#define LOG_TRACE(...) LOG_TRACE_TO(::GameEngine::LogSubsystem::Core, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_DEBUG_TO(::GameEngine::LogSubsystem::Core, __VA_ARGS__)
+#define LOG_INFO(...) LOG_INFO_TO(::GameEngine::LogSubsystem::Core, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_WARNING_TO(::GameEngine::LogSubsystem::Core, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_ERROR_TO(::GameEngine::LogSubsystem::Core, __VA_ARGS__)
+#define LOG_CRITICAL(...) LOG_CRITICAL_TO(::GameEngine::LogSubsystem::Core, __VA_ARGS__)
+
 #endif
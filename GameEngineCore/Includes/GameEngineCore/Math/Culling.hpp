@@ -0,0 +1,39 @@
+#ifndef CULLING_HPP
+#define CULLING_HPP
+
+#include "GameEngineCore/Math/Frustum.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GameEngine {
+    struct BoundingSpheres {
+        const float *centerX = nullptr;
+        const float *centerY = nullptr;
+        const float *centerZ = nullptr;
+        const float *radius = nullptr;
+        size_t count = 0;
+    };
+
+    struct BoundingBoxes {
+        const float *minX = nullptr;
+        const float *minY = nullptr;
+        const float *minZ = nullptr;
+        const float *maxX = nullptr;
+        const float *maxY = nullptr;
+        const float *maxZ = nullptr;
+        size_t count = 0;
+    };
+
+    size_t cullSpheres(const Frustum &frustum, const BoundingSpheres &spheres,
+                       uint32_t *visibleIndices);
+    size_t cullSpheresScalar(const Frustum &frustum, const BoundingSpheres &spheres,
+                             uint32_t *visibleIndices, const size_t first = 0);
+
+    size_t cullBoxes(const Frustum &frustum, const BoundingBoxes &boxes,
+                     uint32_t *visibleIndices);
+    size_t cullBoxesScalar(const Frustum &frustum, const BoundingBoxes &boxes,
+                           uint32_t *visibleIndices, const size_t first = 0);
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef FRUSTUM_HPP
+#define FRUSTUM_HPP
+
+#include "glm/vec4.hpp"
+#include "glm/ext/matrix_float4x4.hpp"
+
+#include <array>
+
+namespace GameEngine {
+    struct Frustum {
+        enum Plane {
+            Left = 0,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+
+            PlanesCount
+        };
+
+        std::array<glm::vec4, PlanesCount> planes;
+
+        static Frustum fromMatrix(const glm::mat4 &viewProjectionMatrix);
+    };
+}
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef ALLOCATION_TRACKER_HPP
+#define ALLOCATION_TRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GameEngine {
+    enum class MemoryTag : uint8_t {
+        General = 0,
+        Events,
+        Scene,
+        Rendering,
+        UI,
+        Jobs,
+        Assets,
+
+        TagsCount
+    };
+
+    class AllocationTracker {
+    public:
+        struct Counters {
+            size_t bytes = 0;
+            size_t allocations = 0;
+        };
+
+        static constexpr bool isEnabled() {
+#if defined(GAME_ENGINE_TRACK_ALLOCATIONS)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        static void recordAllocation(const size_t size);
+        static void endFrame();
+
+        static Counters getFrameCounters(const MemoryTag tag);
+        static Counters getFrameTotal();
+
+        // Sums of the frame counters over the frames ended since the last resetTotals.
+        static void resetTotals();
+        static Counters getTotalCounters(const MemoryTag tag);
+        static size_t getTotalFramesCount();
+        static size_t getFramesWithAllocationsCount();
+
+        static MemoryTag getThreadTag();
+        static MemoryTag setThreadTag(const MemoryTag tag);
+        static const char *getTagName(const MemoryTag tag);
+    };
+
+    class MemoryTagScope {
+    public:
+        explicit MemoryTagScope(const MemoryTag tag)
+            : m_previousTag{AllocationTracker::setThreadTag(tag)} {}
+
+        ~MemoryTagScope() {
+            AllocationTracker::setThreadTag(m_previousTag);
+        }
+
+        MemoryTagScope(const MemoryTagScope&) = delete;
+        MemoryTagScope &operator=(const MemoryTagScope&) = delete;
+
+    private:
+        MemoryTag m_previousTag;
+    };
+}
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef INPLACE_FUNCTION_HPP
+#define INPLACE_FUNCTION_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace GameEngine {
+    template<typename Signature, size_t Capacity = 32>
+    class InplaceFunction;
+
+    template<typename Result, typename... Args, size_t Capacity>
+    class InplaceFunction<Result(Args...), Capacity> {
+    public:
+        InplaceFunction() = default;
+
+        template<typename Function,
+                 typename = std::enable_if_t<!std::is_same_v<std::decay_t<Function>, InplaceFunction>>>
+        InplaceFunction(Function &&function) {
+            using Callable = std::decay_t<Function>;
+
+            static_assert(sizeof(Callable) <= Capacity, "Callable doesn't fit into InplaceFunction");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t),
+                          "Callable is over-aligned for InplaceFunction");
+
+            new (m_storage) Callable(std::forward<Function>(function));
+
+            m_invoke = [](void *storage, Args... args) -> Result {
+                return (*static_cast<Callable*>(storage))(std::forward<Args>(args)...);
+            };
+
+            m_manage = [](const Operation operation, void *destination, void *source) {
+                switch (operation) {
+                    case Operation::Copy:
+                        new (destination) Callable(*static_cast<const Callable*>(source));
+                        break;
+                    case Operation::Move:
+                        new (destination) Callable(std::move(*static_cast<Callable*>(source)));
+                        static_cast<Callable*>(source)->~Callable();
+                        break;
+                    case Operation::Destroy:
+                        static_cast<Callable*>(destination)->~Callable();
+                        break;
+                }
+            };
+        }
+
+        InplaceFunction(const InplaceFunction &other) {
+            copyFrom(other);
+        }
+
+        InplaceFunction(InplaceFunction &&other) noexcept {
+            moveFrom(other);
+        }
+
+        InplaceFunction &operator=(const InplaceFunction &other) {
+            if (this != &other) {
+                reset();
+                copyFrom(other);
+            }
+
+            return *this;
+        }
+
+        InplaceFunction &operator=(InplaceFunction &&other) noexcept {
+            if (this != &other) {
+                reset();
+                moveFrom(other);
+            }
+
+            return *this;
+        }
+
+        ~InplaceFunction() {
+            reset();
+        }
+
+        Result operator()(Args... args) const {
+            return m_invoke(const_cast<unsigned char*>(m_storage), std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const { return m_invoke != nullptr; }
+
+        void reset() {
+            if (m_manage != nullptr) {
+                m_manage(Operation::Destroy, m_storage, nullptr);
+            }
+
+            m_invoke = nullptr;
+            m_manage = nullptr;
+        }
+
+    private:
+        enum class Operation {
+            Copy,
+            Move,
+            Destroy
+        };
+
+        void copyFrom(const InplaceFunction &other) {
+            if (other.m_manage != nullptr) {
+                other.m_manage(Operation::Copy, m_storage, const_cast<unsigned char*>(other.m_storage));
+            }
+
+            m_invoke = other.m_invoke;
+            m_manage = other.m_manage;
+        }
+
+        void moveFrom(InplaceFunction &other) {
+            if (other.m_manage != nullptr) {
+                other.m_manage(Operation::Move, m_storage, other.m_storage);
+            }
+
+            m_invoke = other.m_invoke;
+            m_manage = other.m_manage;
+            other.m_invoke = nullptr;
+            other.m_manage = nullptr;
+        }
+
+        alignas(std::max_align_t) unsigned char m_storage[Capacity];
+        Result (*m_invoke)(void*, Args...) = nullptr;
+        void (*m_manage)(const Operation, void*, void*) = nullptr;
+    };
+}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef LINEAR_ALLOCATOR_HPP
+#define LINEAR_ALLOCATOR_HPP
+
+#include <cstddef>
+
+namespace GameEngine {
+    class LinearAllocator {
+    public:
+        explicit LinearAllocator(const size_t capacity);
+        ~LinearAllocator();
+
+        LinearAllocator(const LinearAllocator&) = delete;
+        LinearAllocator &operator=(const LinearAllocator&) = delete;
+
+        void *allocate(const size_t size, const size_t alignment = alignof(std::max_align_t));
+
+        template<typename T>
+        T *allocateArray(const size_t count) {
+            return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        void reset() { m_offset = 0; }
+        void rewind(const size_t offset) { m_offset = offset < m_offset ? offset : m_offset; }
+
+        size_t getUsed() const { return m_offset; }
+        size_t getCapacity() const { return m_capacity; }
+
+    private:
+        unsigned char *m_data = nullptr;
+        size_t m_capacity = 0;
+        size_t m_offset = 0;
+    };
+}
+
+#endif
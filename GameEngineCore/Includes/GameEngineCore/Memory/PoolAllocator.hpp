@@ -0,0 +1,69 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace GameEngine {
+    class PoolAllocator {
+    public:
+        PoolAllocator(const size_t blockSize, const size_t blockAlignment,
+                      const size_t blocksPerChunk = 256);
+        ~PoolAllocator();
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator &operator=(const PoolAllocator&) = delete;
+
+        void *allocate();
+        void deallocate(void *block);
+
+        size_t getAllocatedCount() const { return m_allocatedCount; }
+        size_t getCapacity() const { return m_chunks.size() * m_blocksPerChunk; }
+
+    private:
+        struct FreeBlock {
+            FreeBlock *next;
+        };
+
+        bool addChunk();
+
+        std::vector<void*> m_chunks;
+        FreeBlock *m_freeList = nullptr;
+        size_t m_blockSize = 0;
+        size_t m_blockAlignment;
+        size_t m_blocksPerChunk;
+        size_t m_allocatedCount = 0;
+    };
+
+    template<typename T>
+    class ObjectPool {
+    public:
+        explicit ObjectPool(const size_t objectsPerChunk = 256)
+            : m_allocator{std::max(sizeof(T), sizeof(void*)), std::max(alignof(T), alignof(void*)),
+                          objectsPerChunk} {}
+
+        template<typename... Args>
+        T *create(Args&&... args) {
+            void *memory = m_allocator.allocate();
+
+            return memory != nullptr ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+        }
+
+        void destroy(T *object) {
+            if (object != nullptr) {
+                object->~T();
+                m_allocator.deallocate(object);
+            }
+        }
+
+        size_t getAllocatedCount() const { return m_allocator.getAllocatedCount(); }
+
+    private:
+        PoolAllocator m_allocator;
+    };
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef SCRATCH_ALLOCATOR_HPP
+#define SCRATCH_ALLOCATOR_HPP
+
+#include "GameEngineCore/Memory/LinearAllocator.hpp"
+
+#include <cstddef>
+
+namespace GameEngine {
+    LinearAllocator &getThreadScratchAllocator();
+
+    class ScratchScope {
+    public:
+        static constexpr size_t s_threadScratchCapacity = 8 * 1024 * 1024;
+
+        ScratchScope();
+        ~ScratchScope();
+
+        ScratchScope(const ScratchScope&) = delete;
+        ScratchScope &operator=(const ScratchScope&) = delete;
+
+        void *allocate(const size_t size, const size_t alignment = alignof(std::max_align_t)) {
+            return m_allocator.allocate(size, alignment);
+        }
+
+        template<typename T>
+        T *allocateArray(const size_t count) {
+            return m_allocator.allocateArray<T>(count);
+        }
+
+    private:
+        LinearAllocator &m_allocator;
+        size_t m_marker;
+    };
+}
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include "GameEngineCore/Jobs/SpscRingBuffer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define GAME_ENGINE_PROFILER_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define GAME_ENGINE_PROFILER_RDTSC 1
+#endif
+
+namespace GameEngine {
+    struct ProfileRecord {
+        const char *name = nullptr;
+        uint64_t begin = 0;
+        uint64_t end = 0;
+        uint32_t depth = 0;
+        uint32_t threadIndex = 0;
+    };
+
+    struct ProfileNode {
+        const char *name = nullptr;
+        uint32_t depth = 0;
+        uint32_t threadIndex = 0;
+        uint32_t callsCount = 0;
+        double totalMilliseconds = 0.0;
+    };
+
+    class Profiler {
+    public:
+        static constexpr size_t s_threadBufferCapacity = 16384;
+
+        struct ThreadBuffer {
+            SpscRingBuffer<ProfileRecord, s_threadBufferCapacity> records;
+            std::string name;
+            uint32_t threadIndex = 0;
+            std::atomic<size_t> droppedCount{0};
+        };
+
+        static void init();
+        static void shutdown();
+
+        static void setEnabled(const bool enabled) { s_isEnabled.store(enabled, std::memory_order_relaxed); }
+        static bool isEnabled() { return s_isEnabled.load(std::memory_order_relaxed); }
+
+        static void setThreadName(const char *name);
+        static void endFrame();
+
+        static const std::vector<ProfileNode> &getFrameNodes();
+        static size_t getDroppedRecordsCount();
+
+        static void startCapture();
+        static bool stopCapture(const std::string &path);
+        static bool isCapturing();
+
+        static double toMilliseconds(const uint64_t ticks);
+
+        static uint64_t getTimestamp() {
+#if defined(GAME_ENGINE_PROFILER_RDTSC)
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        static uint32_t enterScope() {
+            return s_depth++;
+        }
+
+        static void leaveScope(const char *name, const uint64_t begin, const uint32_t depth) {
+            --s_depth;
+
+            if (s_threadBuffer == nullptr) {
+                s_threadBuffer = registerThread();
+            }
+
+            ProfileRecord record;
+            record.name = name;
+            record.begin = begin;
+            record.end = getTimestamp();
+            record.depth = depth;
+            record.threadIndex = s_threadBuffer->threadIndex;
+
+            if (!s_threadBuffer->records.tryPush(record)) {
+                s_threadBuffer->droppedCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        static ThreadBuffer *registerThread();
+
+        static inline std::atomic<bool> s_isEnabled{true};
+        static inline thread_local ThreadBuffer *s_threadBuffer = nullptr;
+        static inline thread_local uint32_t s_depth = 0;
+    };
+
+    class ProfileScope {
+    public:
+        explicit ProfileScope(const char *name)
+            : m_name{Profiler::isEnabled() ? name : nullptr} {
+            if (m_name != nullptr) {
+                m_depth = Profiler::enterScope();
+                m_begin = Profiler::getTimestamp();
+            }
+        }
+
+        ~ProfileScope() {
+            if (m_name != nullptr) {
+                Profiler::leaveScope(m_name, m_begin, m_depth);
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope &operator=(const ProfileScope&) = delete;
+
+    private:
+        const char *m_name;
+        uint64_t m_begin = 0;
+        uint32_t m_depth = 0;
+    };
+}
+
+#define GAME_ENGINE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define GAME_ENGINE_PROFILE_CONCAT(a, b) GAME_ENGINE_PROFILE_CONCAT_IMPL(a, b)
+
+#if defined(GAME_ENGINE_PROFILING)
+    #define PROFILE_SCOPE(name) \
+        ::GameEngine::ProfileScope GAME_ENGINE_PROFILE_CONCAT(profileScope_, __LINE__){name}
+    #define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+#else
+    #define PROFILE_SCOPE(name) (void)0
+    #define PROFILE_FUNCTION() (void)0
+#endif
+
+#endif
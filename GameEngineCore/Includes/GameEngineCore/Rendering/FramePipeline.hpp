@@ -0,0 +1,74 @@
+#ifndef FRAME_PIPELINE_HPP
+#define FRAME_PIPELINE_HPP
+
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace GameEngine {
+    template<typename Snapshot>
+    class FramePipeline {
+    public:
+        using SimulateFunction = void (*)(void *context, Snapshot &snapshot);
+        using RenderFunction = void (*)(void *context, const Snapshot &snapshot);
+
+        FramePipeline(const SimulateFunction simulate, const RenderFunction render, void *context)
+            : m_simulate{simulate}, m_render{render}, m_context{context} {}
+
+        FramePipeline(const FramePipeline&) = delete;
+        FramePipeline &operator=(const FramePipeline&) = delete;
+
+        void setPipelined(const bool pipelined) {
+            m_isPipelined = pipelined;
+            m_hasPendingSnapshot = false;
+        }
+
+        bool isPipelined() const { return m_isPipelined; }
+
+        void runFrame() {
+            Snapshot &front = m_snapshots[m_frontIndex];
+
+            if (!m_isPipelined) {
+                m_simulate(m_context, front);
+                m_render(m_context, front);
+
+                return;
+            }
+
+            if (!m_hasPendingSnapshot) {
+                m_simulate(m_context, front);
+                m_hasPendingSnapshot = true;
+            }
+
+            m_simulationSnapshot = &m_snapshots[1 - m_frontIndex];
+
+            JobCounter simulationCounter;
+            JobSystem::run([](void *pipeline, const size_t, const size_t) {
+                    auto *self = static_cast<FramePipeline*>(pipeline);
+                    self->m_simulate(self->m_context, *self->m_simulationSnapshot);
+                },
+                this, simulationCounter);
+
+            m_render(m_context, front);
+            JobSystem::wait(simulationCounter);
+
+            m_frontIndex = 1 - m_frontIndex;
+        }
+
+        const Snapshot &getFrontSnapshot() const { return m_snapshots[m_frontIndex]; }
+
+    private:
+        SimulateFunction m_simulate;
+        RenderFunction m_render;
+        void *m_context;
+
+        std::array<Snapshot, 2> m_snapshots;
+        Snapshot *m_simulationSnapshot = nullptr;
+        size_t m_frontIndex = 0;
+        bool m_isPipelined = false;
+        bool m_hasPendingSnapshot = false;
+    };
+}
+
+#endif
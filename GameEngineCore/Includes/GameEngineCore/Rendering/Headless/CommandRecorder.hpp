@@ -0,0 +1,103 @@
+#ifndef COMMAND_RECORDER_HPP
+#define COMMAND_RECORDER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace GameEngine {
+    enum class RecordedCommand : uint8_t {
+        CreateBuffer = 0,
+        DeleteBuffer,
+        BufferData,
+        BufferStorage,
+        BufferSubData,
+        MapBuffer,
+        UnmapBuffer,
+        BindBuffer,
+        BindBufferRange,
+        CreateTexture,
+        DeleteTexture,
+        TextureStorage,
+        TextureSubImage,
+        CompressedTextureSubImage,
+        TextureParameter,
+        GenerateMipmap,
+        CopyImageSubData,
+        PixelStore,
+        BindTextureUnit,
+        CreateVertexArray,
+        DeleteVertexArray,
+        VertexArrayVertexBuffer,
+        VertexArrayElementBuffer,
+        VertexArrayAttribFormat,
+        VertexArrayAttribBinding,
+        VertexArrayBindingDivisor,
+        EnableVertexArrayAttrib,
+        BindVertexArray,
+        CreateShader,
+        DeleteShader,
+        CreateProgram,
+        LinkProgram,
+        DeleteProgram,
+        UseProgram,
+        UniformBlockBinding,
+        SetUniform,
+        Enable,
+        Disable,
+        BlendFunc,
+        ClearColor,
+        Clear,
+        Viewport,
+        DrawElements,
+        DrawElementsInstanced,
+        MultiDrawElementsIndirect,
+        FenceSync,
+        ClientWaitSync,
+        DeleteSync,
+        QueryCounter,
+        Present,
+
+        CommandsCount
+    };
+
+    struct RecordedCall {
+        static constexpr size_t s_maxArguments = 5;
+
+        RecordedCommand command = RecordedCommand::Present;
+        uint8_t argumentsCount = 0;
+        std::array<uint32_t, s_maxArguments> arguments{};
+    };
+
+    class CommandRecorder {
+    public:
+        void clear();
+
+        void record(const RecordedCommand command,
+                    std::initializer_list<uint32_t> arguments = {});
+
+        const std::vector<RecordedCall> &getCalls() const { return m_calls; }
+        size_t getCallsCount(const RecordedCommand command) const {
+            return m_callsCounts[static_cast<size_t>(command)];
+        }
+        size_t getFramesCount() const { return getCallsCount(RecordedCommand::Present); }
+
+        void write(std::ostream &stream) const;
+        void writeSummary(std::ostream &stream) const;
+        bool saveToFile(const std::string &path) const;
+
+        static const char *getCommandName(const RecordedCommand command);
+
+    private:
+        static constexpr size_t s_commandsCount = static_cast<size_t>(RecordedCommand::CommandsCount);
+
+        std::vector<RecordedCall> m_calls;
+        std::array<size_t, s_commandsCount> m_callsCounts{};
+    };
+}
+
+#endif
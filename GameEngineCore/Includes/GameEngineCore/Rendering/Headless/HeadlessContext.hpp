@@ -0,0 +1,23 @@
+#ifndef HEADLESS_CONTEXT_HPP
+#define HEADLESS_CONTEXT_HPP
+
+#include "GameEngineCore/Rendering/RenderBackend.hpp"
+#include "GameEngineCore/Rendering/Headless/CommandRecorder.hpp"
+
+#include <cstdint>
+
+namespace GameEngine {
+    class HeadlessContext {
+    public:
+        static bool init(const RenderBackend backend);
+        static void shutdown();
+
+        static void present();
+
+        static RenderBackend getBackend();
+        static uint64_t getPresentedFramesCount();
+        static const CommandRecorder &getRecorder();
+    };
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef BINDLESS_TEXTURE_TABLE_HPP
+#define BINDLESS_TEXTURE_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace GameEngine {
+    class Texture2D;
+
+    // Resident ARB_bindless_texture handles of registered textures, uploaded as a uint64
+    // array to the BindlessTextures storage block so shaders pick textures by index
+    // without any per-draw binding. The extension is optional: loadFunctions() resolves
+    // it when the driver reports it, otherwise isSupported() stays false and callers fall
+    // back to TextureAtlas or plain units. Handles are re-acquired in update() when a
+    // streamed texture reallocates its GL object. Textures must outlive the table.
+    class BindlessTextureTable {
+    public:
+        static constexpr uint32_t s_invalidIndex = std::numeric_limits<uint32_t>::max();
+
+        using GetProcAddress = void *(*)(const char *name);
+
+        static bool loadFunctions(GetProcAddress getProcAddress);
+        static bool isSupported();
+
+        BindlessTextureTable() = default;
+        ~BindlessTextureTable();
+
+        BindlessTextureTable(const BindlessTextureTable&) = delete;
+        BindlessTextureTable(BindlessTextureTable&&) = delete;
+        BindlessTextureTable &operator=(const BindlessTextureTable&) = delete;
+        BindlessTextureTable &operator=(BindlessTextureTable&&) = delete;
+
+        uint32_t add(const Texture2D &texture);
+        void update();
+        void bind() const;
+
+        size_t getTexturesCount() const { return m_entries.size(); }
+        uint64_t getHandle(const uint32_t index) const { return m_handles[index]; }
+
+    private:
+        struct Entry {
+            const Texture2D *texture = nullptr;
+            unsigned int textureId = 0;
+        };
+
+        void releaseHandle(const size_t index);
+
+        std::vector<Entry> m_entries;
+        std::vector<uint64_t> m_handles;
+        unsigned int m_bufferId = 0;
+        size_t m_bufferSize = 0;
+        bool m_isDirty = false;
+    };
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef GPU_PROFILER_HPP
+#define GPU_PROFILER_HPP
+
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+    struct GpuQueryFunctions {
+        void (*createQueries)(unsigned int target, int count, unsigned int *ids) = nullptr;
+        void (*deleteQueries)(int count, const unsigned int *ids) = nullptr;
+        void (*queryCounter)(unsigned int id, unsigned int target) = nullptr;
+        void (*getQueryObjectiv)(unsigned int id, unsigned int parameter, int *value) = nullptr;
+        void (*getQueryObjectui64v)(unsigned int id, unsigned int parameter, uint64_t *value) = nullptr;
+
+        static GpuQueryFunctions fromOpenGL();
+    };
+
+    class GpuProfiler {
+    public:
+        static constexpr size_t s_framesInFlight = 4;
+        static constexpr size_t s_maxScopesPerFrame = 64;
+        static constexpr int32_t s_invalidScope = -1;
+
+        struct Timing {
+            const char *name = nullptr;
+            uint32_t depth = 0;
+            double milliseconds = 0.0;
+        };
+
+        explicit GpuProfiler(const GpuQueryFunctions &functions);
+        ~GpuProfiler();
+
+        GpuProfiler(const GpuProfiler&) = delete;
+        GpuProfiler &operator=(const GpuProfiler&) = delete;
+
+        void beginFrame();
+        void endFrame();
+
+        int32_t beginScope(const char *name);
+        void endScope(const int32_t scope);
+
+        const std::vector<Timing> &getLatestTimings() const { return m_latestTimings; }
+        double getLatestFrameMilliseconds() const { return m_latestFrameMilliseconds; }
+        uint64_t getLatestFrameIndex() const { return m_latestFrameIndex; }
+        size_t getDroppedFramesCount() const { return m_droppedFramesCount; }
+        size_t getDroppedScopesCount() const { return m_droppedScopesCount; }
+
+        static void setActive(GpuProfiler *profiler) { s_active = profiler; }
+        static GpuProfiler *getActive() { return s_active; }
+
+    private:
+        struct Scope {
+            const char *name = nullptr;
+            uint32_t depth = 0;
+            bool isClosed = false;
+        };
+
+        struct Frame {
+            std::array<Scope, s_maxScopesPerFrame> scopes;
+            uint32_t scopesCount = 0;
+            uint64_t frameIndex = 0;
+            bool isPending = false;
+        };
+
+        unsigned int getBeginQuery(const size_t frame, const size_t scope) const;
+        unsigned int getEndQuery(const size_t frame, const size_t scope) const;
+        bool collectFrame(Frame &frame, const size_t frameSlot);
+        void collectPendingFrames();
+
+        GpuQueryFunctions m_functions;
+        std::vector<unsigned int> m_queries;
+        std::array<Frame, s_framesInFlight> m_frames;
+        size_t m_currentSlot = 0;
+        uint64_t m_frameIndex = 0;
+        uint32_t m_depth = 0;
+        int32_t m_frameScope = s_invalidScope;
+        bool m_isFrameOpen = false;
+
+        std::vector<Timing> m_latestTimings;
+        double m_latestFrameMilliseconds = 0.0;
+        uint64_t m_latestFrameIndex = 0;
+        size_t m_droppedFramesCount = 0;
+        size_t m_droppedScopesCount = 0;
+
+        static GpuProfiler *s_active;
+    };
+
+    class GpuProfileScope {
+    public:
+        explicit GpuProfileScope(const char *name)
+            : m_profiler{GpuProfiler::getActive()} {
+            if (m_profiler != nullptr) {
+                m_scope = m_profiler->beginScope(name);
+            }
+        }
+
+        ~GpuProfileScope() {
+            if (m_profiler != nullptr) {
+                m_profiler->endScope(m_scope);
+            }
+        }
+
+        GpuProfileScope(const GpuProfileScope&) = delete;
+        GpuProfileScope &operator=(const GpuProfileScope&) = delete;
+
+    private:
+        GpuProfiler *m_profiler;
+        int32_t m_scope = GpuProfiler::s_invalidScope;
+    };
+}
+
+#if defined(GAME_ENGINE_PROFILING)
+    #define PROFILE_GPU_SCOPE(name)                                                     \
+        PROFILE_SCOPE(name);                                                            \
+        ::GameEngine::GpuProfileScope GAME_ENGINE_PROFILE_CONCAT(gpuProfileScope_, __LINE__){name}
+#else
+    #define PROFILE_GPU_SCOPE(name) (void)0
+#endif
+
+#endif
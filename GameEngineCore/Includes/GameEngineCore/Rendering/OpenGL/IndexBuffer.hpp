@@ -18,11 +18,19 @@ namespace GameEngine {
 
         void bind() const;
         static void unbind();
+        void setData(const unsigned int *indices, const size_t count, const size_t firstIndex = 0);
+        bool allocate(const size_t count, size_t &firstIndex);
+
         size_t getCount() const { return m_count; }
+        size_t getUsedCount() const { return m_usedCount; }
+        unsigned int getId() const { return m_id; }
 
     private:
+        void release();
+
         unsigned int m_id = 0;
         size_t m_count;
+        size_t m_usedCount = 0;
     };
 }
 
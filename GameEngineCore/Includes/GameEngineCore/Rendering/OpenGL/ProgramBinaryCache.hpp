@@ -0,0 +1,54 @@
+#ifndef PROGRAM_BINARY_CACHE_HPP
+#define PROGRAM_BINARY_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace GameEngine {
+    // On-disk cache of linked program binaries (glGetProgramBinary/glProgramBinary), one
+    // file per program named after a hash of its shader sources and the driver vendor,
+    // renderer and version strings. Entries written by another driver, truncated files
+    // and binaries the driver refuses are rejected and the caller compiles from source,
+    // which then overwrites the entry. Disabled when the context reports no binary
+    // formats, e.g. on the headless backends.
+    class ProgramBinaryCache {
+    public:
+        struct Statistics {
+            size_t hitsCount = 0;
+            size_t missesCount = 0;
+            size_t rejectedCount = 0;
+            size_t storesCount = 0;
+            double loadMilliseconds = 0.0;
+            double compileMilliseconds = 0.0;
+            // Compile time recorded with each hit entry minus the time it took to load it.
+            double savedMilliseconds = 0.0;
+        };
+
+        static constexpr uint32_t s_version = 1;
+
+        static bool init(const std::string &directory);
+        static void shutdown();
+        static bool isEnabled() { return s_isEnabled; }
+
+        static uint64_t makeKey(const char *vertexShaderSrc, const char *fragmentShaderSrc);
+
+        // programId must be a freshly created program without attached shaders.
+        static bool load(const uint64_t key, const unsigned int programId);
+        // programId must be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+        static void store(const uint64_t key, const unsigned int programId, const double compileMilliseconds);
+        static void onCompiled(const double compileMilliseconds);
+
+        static const Statistics &getStatistics() { return s_statistics; }
+
+    private:
+        static std::string getEntryPath(const uint64_t key);
+
+        static bool s_isEnabled;
+        static uint64_t s_driverHash;
+        static std::string s_directory;
+        static Statistics s_statistics;
+    };
+}
+
+#endif
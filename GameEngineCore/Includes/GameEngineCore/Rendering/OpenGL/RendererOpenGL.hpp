@@ -1,16 +1,48 @@
 #ifndef RENDERER_OPENGL_HPP
 #define RENDERER_OPENGL_HPP
 
+#include "GameEngineCore/Rendering/RenderBackend.hpp"
+
+#include <cstddef>
+
 struct GLFWwindow;
 
 namespace GameEngine {
     class VertexArray;
+    class RenderQueue;
+    class StreamingBuffer;
+    struct FrameUniforms;
 
     class RendererOpenGL {
     public:
+        struct Statistics {
+            size_t drawCalls = 0;
+            size_t instances = 0;
+            size_t stateChangesIssued = 0;
+            size_t stateChangesFiltered = 0;
+        };
+
+        struct MemoryStatistics {
+            size_t bufferBytes = 0;
+            size_t buffersCount = 0;
+            size_t textureBytes = 0;
+            size_t texturesCount = 0;
+        };
+
         static bool init(GLFWwindow *window);
+        static bool initHeadless(const RenderBackend backend);
 
         static void draw(const VertexArray &vertexArray);
+        static void drawInstanced(const VertexArray &vertexArray, const size_t instanceCount,
+                                  const size_t baseInstance = 0);
+        // instancesCount is the sum of the commands' instance counts, which live only on the GPU.
+        static void multiDrawIndirect(const VertexArray &vertexArray,
+                                      const unsigned int indirectBufferId,
+                                      const size_t indirectOffset, const size_t drawCount,
+                                      const size_t instancesCount);
+        static void submit(RenderQueue &renderQueue, StreamingBuffer &uniformsRing);
+        static void setFrameUniforms(StreamingBuffer &uniformsRing,
+                                     const FrameUniforms &frameUniforms);
         static void setClearColor(const float red, const float green,
                                     const float blue, const float alpha);
         static void clear();
@@ -23,6 +55,26 @@ namespace GameEngine {
         static const char *getVendorStr();
         static const char *getRendererStr();
         static const char *getVersionStr();
+
+        static size_t getUniformBufferOffsetAlignment() { return s_uniformBufferOffsetAlignment; }
+
+        static const Statistics &getStatistics() { return s_statistics; }
+        static void resetStatistics();
+
+        static const MemoryStatistics &getMemoryStatistics() { return s_memoryStatistics; }
+        static void onBufferAllocated(const size_t size);
+        static void onBufferReleased(const size_t size);
+        static void onTextureAllocated(const size_t size);
+        static void onTextureReleased(const size_t size);
+
+    private:
+        friend class StateCacheOpenGL;
+
+        static bool onContextLoaded();
+
+        static Statistics s_statistics;
+        static MemoryStatistics s_memoryStatistics;
+        static size_t s_uniformBufferOffsetAlignment;
     };
 }
 
@@ -1,9 +1,23 @@
 #ifndef SHADER_PROGRAM_HPP
 #define SHADER_PROGRAM_HPP
 
+#include "glm/vec2.hpp"
+#include "glm/vec3.hpp"
+#include "glm/vec4.hpp"
+#include "glm/mat3x3.hpp"
 #include "glm/mat4x4.hpp"
 
+#include <string>
+#include <vector>
+
 namespace GameEngine {
+    struct UniformHandle {
+        int location = -1;
+        int index = -1;
+
+        bool isValid() const { return index >= 0; }
+    };
+
     class ShaderProgram {
     public:
         ShaderProgram(const char *vertexShaderSrc, const char *fragmentShaderSrc);
@@ -19,12 +33,51 @@ namespace GameEngine {
         static void unbind();
 
         bool isCompiled() const { return m_isCompiled; }
-        void setMatrix_4(const char *name, const glm::mat4 &matrix) const;
-        void setInt(const char *name, const int value) const;
+        unsigned int getId() const { return m_id; }
+
+        UniformHandle getUniformHandle(const char *name) const;
+
+        void setInt(const UniformHandle handle, const int value);
+        void setSampler(const UniformHandle handle, const int unit);
+        void setFloat(const UniformHandle handle, const float value);
+        void setVec2(const UniformHandle handle, const glm::vec2 &value);
+        void setVec3(const UniformHandle handle, const glm::vec3 &value);
+        void setVec4(const UniformHandle handle, const glm::vec4 &value);
+        void setMatrix_3(const UniformHandle handle, const glm::mat3 &matrix);
+        void setMatrix_4(const UniformHandle handle, const glm::mat4 &matrix);
+
+        void setIntArray(const UniformHandle handle, const int *values, const size_t count);
+        void setFloatArray(const UniformHandle handle, const float *values, const size_t count);
+        void setVec4Array(const UniformHandle handle, const glm::vec4 *values, const size_t count);
+        void setMatrix_4Array(const UniformHandle handle, const glm::mat4 *matrices,
+                              const size_t count);
+
+        void setMatrix_4(const char *name, const glm::mat4 &matrix);
+        void setInt(const char *name, const int value);
 
     private:
+        struct UniformInfo {
+            std::string name;
+            int location = -1;
+            unsigned int type = 0;
+            int arraySize = 1;
+            size_t shadowOffset = 0;
+            size_t shadowSize = 0;
+            bool hasValue = false;
+        };
+
+        bool compileFromSource(const char *vertexShaderSrc, const char *fragmentShaderSrc,
+                               const bool isRetrievable);
+        void reflectUniforms();
+        bool validateUniformBlocks() const;
+        bool updateShadow(const UniformHandle handle, const void *data, const size_t size);
+
         bool m_isCompiled = false;
         unsigned int m_id = 0;
+
+        std::vector<UniformInfo> m_uniforms;
+        std::vector<int> m_uniformsTable;
+        std::vector<unsigned char> m_uniformsShadow;
     };
 }
 
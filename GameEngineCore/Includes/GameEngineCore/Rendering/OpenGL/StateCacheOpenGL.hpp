@@ -0,0 +1,82 @@
+#ifndef STATE_CACHE_OPENGL_HPP
+#define STATE_CACHE_OPENGL_HPP
+
+#include <array>
+#include <cstddef>
+
+namespace GameEngine {
+    class StateCacheOpenGL {
+    public:
+        static constexpr unsigned int s_maxTextureUnits = 32;
+        static constexpr unsigned int s_maxUniformBindings = 16;
+
+        static void useProgram(const unsigned int id);
+        static void bindVertexArray(const unsigned int id);
+        static void bindBuffer(const unsigned int target, const unsigned int id);
+        static void bindBufferRange(const unsigned int target, const unsigned int index,
+                                    const unsigned int id, const size_t offset,
+                                    const size_t size);
+        static void bindTextureUnit(const unsigned int unit, const unsigned int id);
+
+        static void setDepthTest(const bool enabled);
+        static void setBlending(const bool enabled);
+        static void setBlendFunction(const unsigned int source, const unsigned int destination);
+        static void setFaceCulling(const bool enabled);
+        static void setClearColor(const float red, const float green,
+                                  const float blue, const float alpha);
+
+        static void onProgramDeleted(const unsigned int id);
+        static void onVertexArrayDeleted(const unsigned int id);
+        static void onBufferDeleted(const unsigned int id);
+        static void onTextureDeleted(const unsigned int id);
+
+        static void invalidate();
+
+    private:
+        enum class BufferTarget {
+            Array = 0,
+            Uniform,
+            ShaderStorage,
+            DrawIndirect,
+            PixelUnpack,
+
+            TargetsCount
+        };
+
+        enum class Capability {
+            DepthTest = 0,
+            Blend,
+            CullFace,
+
+            CapabilitiesCount
+        };
+
+        struct BufferRange {
+            unsigned int id;
+            size_t offset;
+            size_t size;
+
+            bool operator!=(const BufferRange &other) const {
+                return id != other.id || offset != other.offset || size != other.size;
+            }
+        };
+
+        static constexpr unsigned int s_unknown = ~0u;
+
+        static bool bufferTargetIndex(const unsigned int target, size_t &index);
+        static void setCapability(const Capability capability, const bool enabled);
+        static bool filter(const bool changed);
+
+        static unsigned int s_program;
+        static unsigned int s_vertexArray;
+        static std::array<unsigned int, static_cast<size_t>(BufferTarget::TargetsCount)> s_buffers;
+        static std::array<unsigned int, s_maxTextureUnits> s_textures;
+        static std::array<BufferRange, s_maxUniformBindings> s_uniformBindings;
+        static std::array<int, static_cast<size_t>(Capability::CapabilitiesCount)> s_capabilities;
+        static std::array<unsigned int, 2> s_blendFunction;
+        static std::array<float, 4> s_clearColor;
+        static bool s_clearColorValid;
+    };
+}
+
+#endif
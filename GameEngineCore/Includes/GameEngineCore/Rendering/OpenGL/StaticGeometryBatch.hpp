@@ -0,0 +1,93 @@
+#ifndef STATIC_GEOMETRY_BATCH_HPP
+#define STATIC_GEOMETRY_BATCH_HPP
+
+#include "GameEngineCore/Rendering/OpenGL/VertexBuffer.hpp"
+#include "GameEngineCore/Rendering/OpenGL/IndexBuffer.hpp"
+#include "GameEngineCore/Rendering/OpenGL/VertexArray.hpp"
+
+#include "glm/mat4x4.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+    struct DrawElementsIndirectCommand {
+        uint32_t count;
+        uint32_t instanceCount;
+        uint32_t firstIndex;
+        int32_t baseVertex;
+        uint32_t baseInstance;
+    };
+
+    // Packs many static meshes into shared vertex/index buffers and draws them with one
+    // glMultiDrawElementsIndirect per material. Draws of the same mesh and material are
+    // merged into one instanced command, so shaders read their model matrix from the
+    // DrawData storage block at draw_data[gl_BaseInstance + gl_InstanceID].
+    class StaticGeometryBatch {
+    public:
+        struct MeshRange {
+            uint32_t firstIndex = 0;
+            uint32_t indicesCount = 0;
+            int32_t baseVertex = 0;
+        };
+
+        struct DrawInstance {
+            uint32_t meshId = 0;
+            uint32_t materialId = 0;
+            glm::mat4 modelMatrix{1.0f};
+        };
+
+        struct MaterialRange {
+            uint32_t materialId = 0;
+            size_t firstCommand = 0;
+            size_t commandsCount = 0;
+            size_t instancesCount = 0;
+        };
+
+        StaticGeometryBatch(BufferLayout bufferLayout, const size_t verticesCapacity,
+                            const size_t indicesCapacity);
+        ~StaticGeometryBatch();
+
+        StaticGeometryBatch(const StaticGeometryBatch&) = delete;
+        StaticGeometryBatch(StaticGeometryBatch&&) = delete;
+        StaticGeometryBatch &operator=(const StaticGeometryBatch&) = delete;
+        StaticGeometryBatch &operator=(StaticGeometryBatch&&) = delete;
+
+        bool addMesh(const void *vertices, const size_t verticesCount,
+                     const unsigned int *indices, const size_t indicesCount, uint32_t &meshId);
+        void addDraw(const uint32_t meshId, const uint32_t materialId, const glm::mat4 &modelMatrix);
+        bool build();
+        void draw(const uint32_t materialId) const;
+
+        const std::vector<DrawElementsIndirectCommand> &getCommands() const { return m_commands; }
+        const std::vector<MaterialRange> &getMaterialRanges() const { return m_materialRanges; }
+
+        static void buildIndirectCommands(const std::vector<MeshRange> &meshes,
+                                          const std::vector<DrawInstance> &draws,
+                                          std::vector<DrawElementsIndirectCommand> &commands,
+                                          std::vector<glm::mat4> &drawData,
+                                          std::vector<MaterialRange> &materialRanges);
+        static bool validateIndirectCommands(const std::vector<DrawElementsIndirectCommand> &commands,
+                                             const size_t indicesCount, const size_t verticesCount,
+                                             const size_t drawDataCount);
+
+    private:
+        void releaseBuffers();
+
+        VertexBuffer m_vertexBuffer;
+        IndexBuffer m_indexBuffer;
+        VertexArray m_vertexArray;
+
+        std::vector<MeshRange> m_meshes;
+        std::vector<DrawInstance> m_draws;
+        std::vector<DrawElementsIndirectCommand> m_commands;
+        std::vector<MaterialRange> m_materialRanges;
+
+        unsigned int m_indirectBufferId = 0;
+        size_t m_indirectBufferSize = 0;
+        unsigned int m_drawDataBufferId = 0;
+        size_t m_drawDataSize = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef STREAMING_BUFFER_HPP
+#define STREAMING_BUFFER_HPP
+
+#include <array>
+#include <cstddef>
+
+namespace GameEngine {
+    class StreamingBuffer {
+    public:
+        struct Allocation {
+            size_t offset = 0;
+            void *data = nullptr;
+
+            bool isValid() const { return data != nullptr; }
+        };
+
+        static constexpr unsigned int s_regionsCount = 3;
+
+        explicit StreamingBuffer(const size_t regionSize);
+        ~StreamingBuffer();
+
+        StreamingBuffer(const StreamingBuffer&) = delete;
+        StreamingBuffer &operator=(const StreamingBuffer&) = delete;
+
+        StreamingBuffer &operator=(StreamingBuffer &&streamingBuffer) noexcept;
+        StreamingBuffer(StreamingBuffer &&streamingBuffer) noexcept;
+
+        void beginFrame();
+        void endFrame();
+        Allocation allocate(const size_t size, const size_t alignment = 16);
+
+        unsigned int getId() const { return m_id; }
+        size_t getRegionSize() const { return m_regionSize; }
+
+    private:
+        void waitForRegion(const unsigned int region);
+        void release();
+
+        unsigned int m_id = 0;
+        unsigned char *m_mappedData = nullptr;
+        size_t m_regionSize = 0;
+        size_t m_regionOffset = 0;
+        unsigned int m_currentRegion = 0;
+        std::array<void*, s_regionsCount> m_fences{};
+    };
+}
+
+#endif
@@ -1,11 +1,25 @@
 #ifndef TEXTURE_2D_HPP
 #define TEXTURE_2D_HPP
 
+#include "GameEngineCore/Rendering/TextureFormat.hpp"
+
+#include <cstddef>
+
 namespace GameEngine {
+    // Texture with a mip chain in one of the TextureFormat layouts. The RGB8 data
+    // constructor uploads level 0 and generates the rest on the GPU; the TextureData
+    // constructor uploads prebuilt (possibly block-compressed) levels as they are. The
+    // size-only constructor creates an empty texture whose resident mips are managed by
+    // TextureStreamer through setResidentTopLevel and uploadLevel. Only levels
+    // [residentTopLevel, levelsCount) have GL storage, so the GL object is reallocated
+    // whenever that range changes and getId may change with it.
     class Texture2D {
     public:
         Texture2D(const unsigned char *data,
                   const unsigned int width, const unsigned int height);
+        explicit Texture2D(const TextureData &data);
+        Texture2D(const unsigned int width, const unsigned int height,
+                  const TextureFormat format = TextureFormat::RGB8);
         ~Texture2D();
 
         Texture2D(const Texture2D&) = delete;
@@ -15,11 +29,37 @@ namespace GameEngine {
         Texture2D(Texture2D &&texture) noexcept;
 
         void bind(const unsigned int unit) const;
+        unsigned int getId() const { return m_id; }
+        size_t getMemorySize() const { return m_memorySize; }
+
+        TextureFormat getFormat() const { return m_format; }
+        unsigned int getWidth() const { return m_width; }
+        unsigned int getHeight() const { return m_height; }
+        unsigned int getLevelsCount() const { return m_levelsCount; }
+        unsigned int getResidentTopLevel() const { return m_residentTopLevel; }
+        bool isResident() const { return m_id != 0; }
+
+        size_t getLevelMemorySize(const unsigned int level) const;
+        size_t getLevelsMemorySize(const unsigned int topLevel) const;
+
+        void setResidentTopLevel(const unsigned int topLevel);
+        void uploadLevel(const unsigned int level, const unsigned int pixelBufferId,
+                         const size_t offset);
+        bool takeUsed() const;
 
     private:
+        void release();
+        void setParameters();
+        void uploadLevelData(const unsigned int level, const void *data);
+
         unsigned int m_id = 0;
+        TextureFormat m_format = TextureFormat::RGB8;
         unsigned int m_width = 0;
         unsigned int m_height = 0;
+        unsigned int m_levelsCount = 0;
+        unsigned int m_residentTopLevel = 0;
+        size_t m_memorySize = 0;
+        mutable bool m_isUsed = false;
     };
 }
 
@@ -0,0 +1,51 @@
+#ifndef TEXTURE_2D_ARRAY_HPP
+#define TEXTURE_2D_ARRAY_HPP
+
+#include "GameEngineCore/Rendering/TextureFormat.hpp"
+
+#include <cstddef>
+
+namespace GameEngine {
+    // GL_TEXTURE_2D_ARRAY with immutable storage. Regions of any layer can be updated
+    // independently, which is what TextureAtlas uses to pack many small textures into
+    // one binding. Only uncompressed formats are supported.
+    class Texture2DArray {
+    public:
+        Texture2DArray(const unsigned int width, const unsigned int height, const unsigned int layersCount,
+                       const unsigned int levelsCount, const TextureFormat format = TextureFormat::RGBA8);
+        ~Texture2DArray();
+
+        Texture2DArray(const Texture2DArray&) = delete;
+        Texture2DArray &operator=(const Texture2DArray&) = delete;
+
+        Texture2DArray &operator=(Texture2DArray &&textureArray) noexcept;
+        Texture2DArray(Texture2DArray &&textureArray) noexcept;
+
+        void uploadRegion(const unsigned int layer, const unsigned int x, const unsigned int y,
+                          const unsigned int width, const unsigned int height, const void *data);
+        void generateMipmaps();
+
+        void bind(const unsigned int unit) const;
+        unsigned int getId() const { return m_id; }
+        size_t getMemorySize() const { return m_memorySize; }
+
+        TextureFormat getFormat() const { return m_format; }
+        unsigned int getWidth() const { return m_width; }
+        unsigned int getHeight() const { return m_height; }
+        unsigned int getLayersCount() const { return m_layersCount; }
+        unsigned int getLevelsCount() const { return m_levelsCount; }
+
+    private:
+        void release();
+
+        unsigned int m_id = 0;
+        TextureFormat m_format = TextureFormat::RGBA8;
+        unsigned int m_width = 0;
+        unsigned int m_height = 0;
+        unsigned int m_layersCount = 0;
+        unsigned int m_levelsCount = 0;
+        size_t m_memorySize = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef TEXTURE_ATLAS_HPP
+#define TEXTURE_ATLAS_HPP
+
+#include "GameEngineCore/Rendering/OpenGL/Texture2DArray.hpp"
+#include "GameEngineCore/Rendering/TextureAtlasPacker.hpp"
+
+#include "glm/vec4.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace GameEngine {
+    // Matches the std430 AtlasRegions storage block: uv_in_layer = uv * scale + offset.
+    struct AtlasRegion {
+        glm::vec4 uvScaleOffset{1.0f, 1.0f, 0.0f, 0.0f};
+        uint32_t layer = 0;
+        uint32_t padding[3] = {};
+    };
+
+    static_assert(sizeof(AtlasRegion) == 32, "AtlasRegion must match the std430 AtlasRegions block");
+
+    // Packs small textures into the layers of one Texture2DArray so materials that only
+    // differ in their texture share a single binding. Each texture gets a gutter of
+    // replicated edge texels as wide as the coarsest mip footprint, which keeps mips
+    // from bleeding across neighbours. Shaders look regions up by index in the
+    // AtlasRegions storage block bound by bind().
+    class TextureAtlas {
+    public:
+        static constexpr uint32_t s_invalidRegion = std::numeric_limits<uint32_t>::max();
+
+        struct Settings {
+            unsigned int layerSize = 2048;
+            unsigned int layersCount = 4;
+            unsigned int levelsCount = 4;
+            TextureFormat format = TextureFormat::RGBA8;
+        };
+
+        explicit TextureAtlas(const Settings &settings);
+        ~TextureAtlas();
+
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas(TextureAtlas&&) = delete;
+        TextureAtlas &operator=(const TextureAtlas&) = delete;
+        TextureAtlas &operator=(TextureAtlas&&) = delete;
+
+        // pixels are tightly packed in the atlas format. Returns s_invalidRegion when
+        // every layer is full.
+        uint32_t add(const unsigned char *pixels, const unsigned int width, const unsigned int height);
+        // Rebuilds mips and re-uploads the region table after additions.
+        void update();
+        void bind(const unsigned int unit) const;
+
+        const Texture2DArray &getTexture() const { return m_texture; }
+        const TextureAtlasPacker &getPacker() const { return m_packer; }
+        const AtlasRegion &getRegion(const uint32_t region) const { return m_regions[region]; }
+        size_t getRegionsCount() const { return m_regions.size(); }
+
+    private:
+        TextureAtlasPacker m_packer;
+        Texture2DArray m_texture;
+        std::vector<AtlasRegion> m_regions;
+        std::vector<unsigned char> m_scratch;
+        unsigned int m_regionsBufferId = 0;
+        size_t m_regionsBufferSize = 0;
+        bool m_isDirty = false;
+    };
+}
+
+#endif
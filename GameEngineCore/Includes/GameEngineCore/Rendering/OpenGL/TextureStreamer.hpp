@@ -0,0 +1,93 @@
+#ifndef TEXTURE_STREAMER_HPP
+#define TEXTURE_STREAMER_HPP
+
+#include "GameEngineCore/Rendering/OpenGL/Texture2D.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StreamingBuffer.hpp"
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+#include "GameEngineCore/Memory/PoolAllocator.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+    // Streams textures in the background. Requests decode level 0 and build the mip chain
+    // on job workers; update() then uploads mips coarse-to-fine through the persistently
+    // mapped StreamingBuffer ring, bound as GL_PIXEL_UNPACK_BUFFER, so uploads never stall
+    // on the GPU. When resident mips exceed the memory budget the top mip of the least
+    // recently bound texture is evicted. Decoded pixels stay in system memory so evicted
+    // mips can be streamed back in.
+    class TextureStreamer {
+    public:
+        using DecodeFunction = void (*)(void *userData, unsigned char *pixels,
+                                        const unsigned int width, const unsigned int height);
+
+        static constexpr unsigned int s_maxLevelsCount = 32;
+
+        struct Settings {
+            size_t memoryBudget = 64 * 1024 * 1024;
+            size_t stagingRegionSize = 4 * 1024 * 1024;
+        };
+
+        struct Statistics {
+            size_t memoryBudget = 0;
+            size_t residentBytes = 0;
+            size_t texturesCount = 0;
+            size_t fullyResidentCount = 0;
+            size_t pendingDecodesCount = 0;
+            size_t uploadsCount = 0;
+            size_t uploadedBytes = 0;
+            size_t evictionsCount = 0;
+        };
+
+        explicit TextureStreamer(const Settings &settings);
+        ~TextureStreamer();
+
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer(TextureStreamer&&) = delete;
+        TextureStreamer &operator=(const TextureStreamer&) = delete;
+        TextureStreamer &operator=(TextureStreamer&&) = delete;
+
+        // userData must stay valid until the texture is decoded.
+        Texture2D *request(const unsigned int width, const unsigned int height,
+                           const DecodeFunction decode, void *userData = nullptr);
+        void update();
+
+        void setMemoryBudget(const size_t memoryBudget) { m_settings.memoryBudget = memoryBudget; }
+        const Statistics &getStatistics() const { return m_statistics; }
+
+    private:
+        struct Entry {
+            Entry(const unsigned int width, const unsigned int height)
+                : texture{width, height} {}
+
+            Texture2D texture;
+            DecodeFunction decode = nullptr;
+            void *userData = nullptr;
+            std::vector<unsigned char> pixels;
+            std::array<size_t, s_maxLevelsCount> levelOffsets{};
+            JobCounter decodeCounter;
+            bool isDecoded = false;
+            uint64_t lastUsedFrame = 0;
+        };
+
+        static void decodeJob(void *entry, const size_t, const size_t);
+
+        void streamIn(Entry &entry, size_t &stagingBytes);
+        bool reserve(const size_t size, const uint64_t usedBefore);
+        bool evictLeastRecentlyUsed(const uint64_t usedBefore);
+
+        Settings m_settings;
+        Statistics m_statistics;
+        StreamingBuffer m_stagingBuffer;
+        // Entries live in pool chunks so requests do not allocate one by one and decode jobs keep
+        // stable pointers to them.
+        ObjectPool<Entry> m_entryPool;
+        std::vector<Entry*> m_entries;
+        std::vector<Entry*> m_streamOrder;
+        uint64_t m_frameIndex = 0;
+    };
+}
+
+#endif
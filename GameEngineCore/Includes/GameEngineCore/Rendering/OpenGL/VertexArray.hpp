@@ -5,6 +5,8 @@
 #include "GameEngineCore/Rendering/OpenGL/IndexBuffer.hpp"
 
 namespace GameEngine {
+    class StreamingBuffer;
+
     class VertexArray {
     public:
         VertexArray();
@@ -17,14 +19,20 @@ namespace GameEngine {
         VertexArray(VertexArray&&) noexcept;
 
         void addVertexBuffer(const VertexBuffer &vertexBuffer);
+        void addVertexBuffer(const StreamingBuffer &streamingBuffer, const BufferLayout &layout);
         void setIndexBuffer(const IndexBuffer &indexBuffer);
         void bind() const;
         static void unbind();
         size_t getIndicesCount() const { return m_indicesCount; }
+        unsigned int getId() const { return m_id; }
 
     private:
+        void release();
+        void attachBuffer(const unsigned int bufferId, const BufferLayout &layout);
+
         unsigned int m_id = 0;
         unsigned int m_elementsCount = 0;
+        unsigned int m_buffersCount = 0;
         size_t m_indicesCount = 0;
     };
 }
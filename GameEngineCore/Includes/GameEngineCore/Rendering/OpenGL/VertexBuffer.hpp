@@ -1,7 +1,9 @@
 #ifndef VERTEX_BUFFER_HPP
 #define VERTEX_BUFFER_HPP
 
-#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 
 namespace GameEngine {
     enum class ShaderDataType {
@@ -13,38 +15,40 @@ namespace GameEngine {
         Int2,
         Int3,
         Int4,
+        Mat3,
+        Mat4
     };
 
     struct BufferElement {
-        ShaderDataType m_type;
-        uint32_t m_componentType;
-        size_t m_componentsCount;
-        size_t m_size;
-        size_t m_offset;
-
+        ShaderDataType m_type = ShaderDataType::Float;
+        uint32_t m_componentType = 0;
+        size_t m_componentsCount = 0;
+        size_t m_columnsCount = 0;
+        size_t m_size = 0;
+        size_t m_offset = 0;
+
+        BufferElement() = default;
         BufferElement(const ShaderDataType type);
     };
 
     class BufferLayout {
     public:
-        BufferLayout(std::initializer_list<BufferElement> elements)
-            : m_elements{std::move(elements)} {
-            size_t offset = 0;
-            m_stride = 0;
-
-            for (auto &element : m_elements) {
-                element.m_offset = offset;
-                offset += element.m_size;
-                m_stride += element.m_size;
-            }
-        }
-
-        const std::vector<BufferElement> &getElements() const { return m_elements; }
+        static constexpr size_t s_maxElements = 16;
+
+        BufferLayout(std::initializer_list<BufferElement> elements,
+                     const unsigned int instanceDivisor = 0);
+
+        const BufferElement *begin() const { return m_elements.data(); }
+        const BufferElement *end() const { return m_elements.data() + m_elementsCount; }
+        size_t getElementsCount() const { return m_elementsCount; }
         size_t getStride() const { return m_stride; }
+        unsigned int getInstanceDivisor() const { return m_instanceDivisor; }
 
     private:
-        std::vector<BufferElement> m_elements;
+        std::array<BufferElement, s_maxElements> m_elements;
+        size_t m_elementsCount = 0;
         size_t m_stride = 0;
+        unsigned int m_instanceDivisor = 0;
     };
 
     class VertexBuffer {
@@ -68,11 +72,21 @@ namespace GameEngine {
         void bind() const;
         static void unbind();
 
+        void setData(const void *data, const size_t size, const size_t offset = 0);
+        bool allocate(const size_t size, size_t &offset);
+
         const BufferLayout &getLayout() const { return m_bufferLayout; }
+        unsigned int getId() const { return m_id; }
+        size_t getCapacity() const { return m_capacity; }
+        size_t getUsedSize() const { return m_usedSize; }
 
     private:
+        void release();
+
         unsigned int m_id = 0;
         BufferLayout m_bufferLayout;
+        size_t m_capacity = 0;
+        size_t m_usedSize = 0;
     };
 }
 
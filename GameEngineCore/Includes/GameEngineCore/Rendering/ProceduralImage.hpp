@@ -0,0 +1,88 @@
+#ifndef PROCEDURAL_IMAGE_HPP
+#define PROCEDURAL_IMAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+    // Row-major 8-bit image with 1-4 interleaved channels. rowPitch may be larger than
+    // width * channelsCount, e.g. when the pixels live in a mapped upload buffer.
+    struct ImageView {
+        unsigned char *pixels = nullptr;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        unsigned int channelsCount = 3;
+        size_t rowPitch = 0;
+
+        size_t getRowPitch() const { return rowPitch != 0 ? rowPitch : size_t{width} * channelsCount; }
+        unsigned char *getRow(const unsigned int y) const { return pixels + y * getRowPitch(); }
+    };
+
+    struct ImageColor {
+        unsigned char red = 0;
+        unsigned char green = 0;
+        unsigned char blue = 0;
+        unsigned char alpha = 255;
+    };
+
+    // Fills pixels [begin, end) of a row with one color.
+    void fillImageSpan(unsigned char *row, const unsigned int begin, const unsigned int end,
+                       const unsigned int channelsCount, const ImageColor &color);
+    void fillImageSpanScalar(unsigned char *row, const unsigned int begin, const unsigned int end,
+                             const unsigned int channelsCount, const ImageColor &color);
+
+    // Ordered list of shapes painted over each other. render() splits the rows across the
+    // JobSystem; every band paints only the shapes whose bounding box overlaps it, one
+    // horizontal span per shape and row, so each pixel is written once per covering shape
+    // and never per shape. Coordinates are in pixels, rects are half-open and circles
+    // cover pixels strictly closer than radius to the center.
+    class ProceduralImage {
+    public:
+        void clear() { m_shapes.clear(); }
+
+        void fill(const ImageColor &color);
+        void addRect(const int left, const int top, const int right, const int bottom,
+                     const ImageColor &color);
+        void addCircle(const int centerX, const int centerY, const int radius,
+                       const ImageColor &color);
+        // Smooth value noise over the rect blending between two colors, one random value
+        // per cellSize x cellSize lattice cell.
+        void addNoise(const int left, const int top, const int right, const int bottom,
+                      const unsigned int cellSize, const uint32_t seed,
+                      const ImageColor &firstColor, const ImageColor &secondColor);
+
+        void render(const ImageView &image) const;
+        void renderRows(const ImageView &image, const unsigned int begin, const unsigned int end) const;
+
+    private:
+        enum class ShapeType : uint8_t {
+            Rect,
+            Circle,
+            Noise
+        };
+
+        struct Shape {
+            ShapeType type = ShapeType::Rect;
+            int left = 0;
+            int top = 0;
+            int right = 0;
+            int bottom = 0;
+            int centerX = 0;
+            int centerY = 0;
+            int radius = 0;
+            unsigned int cellSize = 1;
+            uint32_t seed = 0;
+            ImageColor color;
+            ImageColor secondColor;
+        };
+
+        std::vector<Shape> m_shapes;
+    };
+
+    // Demo content shared by App and the benchmark.
+    void buildSmileImage(ProceduralImage &image, const unsigned int width, const unsigned int height);
+    void buildQuadsImage(ProceduralImage &image, const unsigned int width, const unsigned int height);
+}
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef RENDER_BACKEND_HPP
+#define RENDER_BACKEND_HPP
+
+#include <cstdint>
+
+namespace GameEngine {
+    enum class RenderBackend : uint8_t {
+        OpenGL = 0,
+        Null,
+        Recording
+    };
+
+    inline bool isHeadless(const RenderBackend backend) {
+        return backend != RenderBackend::OpenGL;
+    }
+}
+
+#endif
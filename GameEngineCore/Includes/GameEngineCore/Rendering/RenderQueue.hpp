@@ -0,0 +1,65 @@
+#ifndef RENDER_QUEUE_HPP
+#define RENDER_QUEUE_HPP
+
+#include "glm/mat4x4.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace GameEngine {
+    class VertexArray;
+    class ShaderProgram;
+    class Texture2D;
+    class Texture2DArray;
+    class LinearAllocator;
+
+    struct DrawCommand {
+        static constexpr size_t s_maxTextures = 4;
+        // Atlas textures go to the unit after the regular ones, see TextureAtlas.
+        static constexpr unsigned int s_textureArrayUnit = s_maxTextures;
+
+        const VertexArray *vertexArray = nullptr;
+        ShaderProgram *shaderProgram = nullptr;
+        std::array<const Texture2D*, s_maxTextures> textures{};
+        const Texture2DArray *textureArray = nullptr;
+        glm::mat4 modelMatrix{1.0f};
+        size_t instanceCount = 1;
+        size_t baseInstance = 0;
+        float depth = 0.0f;
+        bool transparent = false;
+    };
+
+    class RenderQueue {
+    public:
+        RenderQueue(LinearAllocator &frameAllocator, const size_t capacity);
+
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue &operator=(const RenderQueue&) = delete;
+
+        void begin();
+        bool submit(const DrawCommand &command);
+        void sort();
+
+        size_t getCount() const { return m_count; }
+        const DrawCommand &getSortedCommand(const size_t index) const {
+            return m_commands[m_sortedIndices[index]];
+        }
+
+        static uint64_t makeSortKey(const DrawCommand &command);
+        static void radixSort(uint64_t *keys, uint32_t *indices,
+                              uint64_t *scratchKeys, uint32_t *scratchIndices,
+                              const size_t count);
+
+    private:
+        LinearAllocator &m_frameAllocator;
+        size_t m_capacity = 0;
+        size_t m_count = 0;
+
+        DrawCommand *m_commands = nullptr;
+        uint64_t *m_keys = nullptr;
+        uint32_t *m_sortedIndices = nullptr;
+    };
+}
+
+#endif
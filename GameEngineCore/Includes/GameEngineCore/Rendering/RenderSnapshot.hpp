@@ -0,0 +1,38 @@
+#ifndef RENDER_SNAPSHOT_HPP
+#define RENDER_SNAPSHOT_HPP
+
+#include "GameEngineCore/Rendering/RenderQueue.hpp"
+#include "GameEngineCore/Rendering/UniformBlocks.hpp"
+
+#include "glm/vec4.hpp"
+#include "glm/mat4x4.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+    struct RenderBatch {
+        const VertexArray *vertexArray = nullptr;
+        ShaderProgram *shaderProgram = nullptr;
+        std::array<const Texture2D*, DrawCommand::s_maxTextures> textures{};
+        const Texture2DArray *textureArray = nullptr;
+        size_t firstInstance = 0;
+        size_t instanceCount = 0;
+    };
+
+    struct RenderSnapshot {
+        FrameUniforms frameUniforms{};
+        glm::vec4 clearColor{0.0f};
+        uint64_t inputTimestamp = 0;
+        std::vector<glm::mat4> instanceTransforms;
+        std::vector<RenderBatch> batches;
+
+        void clear() {
+            instanceTransforms.clear();
+            batches.clear();
+        }
+    };
+}
+
+#endif
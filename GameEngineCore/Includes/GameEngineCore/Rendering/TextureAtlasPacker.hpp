@@ -0,0 +1,66 @@
+#ifndef TEXTURE_ATLAS_PACKER_HPP
+#define TEXTURE_ATLAS_PACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace GameEngine {
+    // Skyline bottom-left packer over a stack of equally sized layers. Every rect is
+    // surrounded by padding and its padded footprint is rounded up to alignment, so
+    // placements stay aligned for mip levels and block formats. Pure CPU, no GL calls.
+    class TextureAtlasPacker {
+    public:
+        struct Settings {
+            unsigned int layerWidth = 2048;
+            unsigned int layerHeight = 2048;
+            unsigned int maxLayersCount = 8;
+            unsigned int padding = 2;
+            unsigned int alignment = 1;
+        };
+
+        struct Placement {
+            unsigned int layer = 0;
+            unsigned int x = 0;
+            unsigned int y = 0;
+            unsigned int width = 0;
+            unsigned int height = 0;
+            bool isPacked = false;
+        };
+
+        explicit TextureAtlasPacker(const Settings &settings);
+
+        bool pack(const unsigned int width, const unsigned int height, Placement &placement);
+        // Packs tallest first, which fills the skyline much tighter than arrival order.
+        // placements[i] belongs to sizes[i]; returns how many rects fit.
+        size_t packAll(const std::vector<std::pair<unsigned int, unsigned int>> &sizes,
+                       std::vector<Placement> &placements);
+        void reset();
+
+        const Settings &getSettings() const { return m_settings; }
+        unsigned int getLayersCount() const { return static_cast<unsigned int>(m_layers.size()); }
+        size_t getUsedArea() const { return m_usedArea; }
+        double getOccupancy() const;
+
+    private:
+        struct SkylineNode {
+            unsigned int x = 0;
+            unsigned int y = 0;
+            unsigned int width = 0;
+        };
+
+        using Skyline = std::vector<SkylineNode>;
+
+        bool findPosition(const Skyline &skyline, const unsigned int width, const unsigned int height,
+                          size_t &nodeIndex, unsigned int &x, unsigned int &y) const;
+        void addSkylineLevel(Skyline &skyline, const size_t nodeIndex, const unsigned int x,
+                             const unsigned int y, const unsigned int width, const unsigned int height);
+
+        Settings m_settings;
+        std::vector<Skyline> m_layers;
+        size_t m_usedArea = 0;
+    };
+}
+
+#endif
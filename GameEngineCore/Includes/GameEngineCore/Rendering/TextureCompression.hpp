@@ -0,0 +1,34 @@
+#ifndef TEXTURE_COMPRESSION_HPP
+#define TEXTURE_COMPRESSION_HPP
+
+#include "GameEngineCore/Rendering/TextureFormat.hpp"
+
+#include <cstddef>
+
+namespace GameEngine {
+    // Block encoders read 16 RGBA8 texels of a 4x4 block in row-major order. Endpoints are
+    // fitted along the principal axis of the block colors; BC7 uses mode 6 only (one subset,
+    // RGBA endpoints with p-bits and 4-bit indices), which covers most content well.
+    void compressBlockBC1(const unsigned char *texels, unsigned char *block);
+    void compressBlockBC3(const unsigned char *texels, unsigned char *block);
+    void compressBlockBC4(const unsigned char *texels, const size_t channel, unsigned char *block);
+    void compressBlockBC5(const unsigned char *texels, unsigned char *block);
+    void compressBlockBC7(const unsigned char *texels, unsigned char *block);
+
+    void downsampleImage(const unsigned char *source, const unsigned int sourceWidth,
+                         const unsigned int sourceHeight, unsigned char *destination,
+                         const unsigned int width, const unsigned int height,
+                         const unsigned int channelsCount, const bool isSrgb = false);
+
+    // Converts an RGBA8 image to one level of the given format.
+    void encodeTextureLevel(const TextureFormat format, const unsigned char *rgba,
+                            const unsigned int width, const unsigned int height,
+                            unsigned char *destination);
+
+    // Builds the mip chain from an RGBA8 image (in linear space for sRGB formats) and
+    // encodes every level. Block rows are split across the JobSystem when it is running.
+    void cookTexture(const unsigned char *rgba, const unsigned int width, const unsigned int height,
+                     const TextureFormat format, const bool generateMips, TextureData &data);
+}
+
+#endif
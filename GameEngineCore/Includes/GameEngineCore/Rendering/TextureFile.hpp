@@ -0,0 +1,20 @@
+#ifndef TEXTURE_FILE_HPP
+#define TEXTURE_FILE_HPP
+
+#include "GameEngineCore/Rendering/TextureFormat.hpp"
+
+#include <string>
+
+namespace GameEngine {
+    // Cooked texture container: a fixed header ("GETX", version, format, size, levels
+    // count) followed by all levels back to back, ready to be uploaded without decoding.
+    class TextureFile {
+    public:
+        static constexpr uint32_t s_version = 1;
+
+        static bool save(const std::string &path, const TextureData &data);
+        static bool load(const std::string &path, TextureData &data);
+    };
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef TEXTURE_FORMAT_HPP
+#define TEXTURE_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+    enum class TextureFormat : uint8_t {
+        RGB8 = 0,
+        RGBA8,
+        SRGB8_ALPHA8,
+        R8,
+        RG8,
+        BC1,
+        BC1_SRGB,
+        BC3,
+        BC3_SRGB,
+        BC4,
+        BC5,
+        BC7,
+        BC7_SRGB,
+
+        FormatsCount
+    };
+
+    // Block-compressed formats store 4x4 texel blocks; uncompressed ones are described
+    // as 1x1 blocks so level sizes are computed the same way for both.
+    struct TextureFormatInfo {
+        const char *name;
+        uint8_t channelsCount;
+        uint8_t blockSize;
+        uint8_t bytesPerBlock;
+        bool isCompressed;
+        bool isSrgb;
+    };
+
+    struct TextureData {
+        TextureFormat format = TextureFormat::RGBA8;
+        unsigned int width = 0;
+        unsigned int height = 0;
+        std::vector<unsigned char> pixels;
+        std::vector<size_t> levelOffsets;
+
+        unsigned int getLevelsCount() const { return static_cast<unsigned int>(levelOffsets.size()); }
+        const unsigned char *getLevelData(const unsigned int level) const {
+            return pixels.data() + levelOffsets[level];
+        }
+        size_t getLevelMemorySize(const unsigned int level) const;
+    };
+
+    const TextureFormatInfo &getTextureFormatInfo(const TextureFormat format);
+    bool findTextureFormat(const char *name, TextureFormat &format);
+
+    unsigned int computeTextureLevelsCount(const unsigned int width, const unsigned int height);
+    unsigned int getTextureLevelSize(const unsigned int size, const unsigned int level);
+    size_t getTextureLevelMemorySize(const TextureFormat format, const unsigned int width,
+                                     const unsigned int height, const unsigned int level);
+}
+
+#endif
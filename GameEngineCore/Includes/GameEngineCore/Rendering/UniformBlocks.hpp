@@ -0,0 +1,56 @@
+#ifndef UNIFORM_BLOCKS_HPP
+#define UNIFORM_BLOCKS_HPP
+
+#include "glm/vec4.hpp"
+#include "glm/mat4x4.hpp"
+
+#include <cstddef>
+
+namespace GameEngine {
+    enum class UniformBlockBinding : unsigned int {
+        Frame = 0,
+        Object = 1
+    };
+
+    enum class StorageBlockBinding : unsigned int {
+        DrawData = 0,
+        AtlasRegions = 1,
+        BindlessTextures = 2
+    };
+
+    struct FrameUniforms {
+        glm::mat4 viewMatrix;
+        glm::mat4 projectionMatrix;
+        glm::mat4 viewProjectionMatrix;
+        glm::vec4 cameraPosition;
+        float time;
+        int currentFrame;
+        float deltaTime;
+        // Pads the block to its std140 size.
+        float reserved;
+    };
+
+    struct ObjectUniforms {
+        glm::mat4 modelMatrix;
+    };
+
+    static_assert(sizeof(FrameUniforms) == 224, "FrameUniforms must match the std140 FrameData block");
+    static_assert(sizeof(ObjectUniforms) == 64, "ObjectUniforms must match the std140 ObjectData block");
+
+    struct UniformBlockMember {
+        const char *name;
+        size_t offset;
+    };
+
+    struct UniformBlockLayout {
+        const char *name;
+        UniformBlockBinding binding;
+        size_t size;
+        const UniformBlockMember *members;
+        size_t membersCount;
+    };
+
+    const UniformBlockLayout *findUniformBlockLayout(const char *name);
+}
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef TRANSFORM_HIERARCHY_HPP
+#define TRANSFORM_HIERARCHY_HPP
+
+#include "glm/vec3.hpp"
+#include "glm/mat4x4.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace GameEngine {
+    // The generation is bumped whenever a destroyed node's index is reused, so stale handles stay invalid.
+    struct TransformHandle {
+        static constexpr uint32_t s_invalidIndex = std::numeric_limits<uint32_t>::max();
+
+        uint32_t index = s_invalidIndex;
+        uint32_t generation = 0;
+
+        bool operator==(const TransformHandle &other) const {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const TransformHandle &other) const { return !(*this == other); }
+    };
+
+    class TransformHierarchy {
+    public:
+        using Handle = TransformHandle;
+
+        static constexpr Handle s_invalidHandle{};
+
+        Handle create(const Handle parent = s_invalidHandle);
+        void destroy(const Handle handle);
+        bool isValid(const Handle handle) const;
+
+        bool setParent(const Handle handle, const Handle parent);
+        Handle getParent(const Handle handle) const;
+
+        void setPosition(const Handle handle, const glm::vec3 &position);
+        void setRotation(const Handle handle, const glm::vec3 &rotation);
+        void setScale(const Handle handle, const glm::vec3 &scale);
+
+        // Invalid handles get the values of a fresh root node.
+        const glm::vec3 &getPosition(const Handle handle) const;
+        const glm::vec3 &getRotation(const Handle handle) const;
+        const glm::vec3 &getScale(const Handle handle) const;
+        const glm::mat4 &getLocalMatrix(const Handle handle) const;
+        const glm::mat4 &getWorldMatrix(const Handle handle) const;
+        // The world matrix as of the last beginSimulationStep, for blending towards the current one.
+        const glm::mat4 &getPreviousWorldMatrix(const Handle handle) const;
+
+        void update();
+        // Brings the world matrices up to date and makes them the previous state of the next step.
+        void beginSimulationStep();
+
+        size_t getNodesCount() const { return m_handles.size(); }
+        size_t getLastUpdatedCount() const { return m_lastUpdatedCount; }
+
+        static glm::mat4 composeMatrix(const glm::vec3 &position, const glm::vec3 &rotation,
+                                       const glm::vec3 &scale);
+        static void multiplyMatrices(const glm::mat4 &left, const glm::mat4 &right,
+                                     glm::mat4 &result);
+
+    private:
+        enum DirtyFlags : uint8_t {
+            LocalDirty = 1 << 0,
+            Destroyed = 1 << 1,
+            // The world matrix changed since the last step, so the previous one differs from it.
+            Moved = 1 << 2,
+            // Not updated yet; the first world matrix becomes the previous one too instead of moving from identity.
+            Created = 1 << 3
+        };
+
+        // Everything update() reads about a node in one cache line, so that reaching a scattered
+        // dirty subtree costs one miss here rather than one per array.
+        struct alignas(64) Node {
+            glm::vec3 position{ 0.0f };
+            glm::vec3 rotation{ 0.0f };
+            glm::vec3 scale{ 1.0f };
+            uint32_t parent;
+            uint32_t subtreeEnd;
+            uint8_t flags;
+        };
+
+        // Exactly one cache line per matrix.
+        struct alignas(64) Matrix {
+            glm::mat4 value{ 1.0f };
+        };
+
+        uint32_t findSlot(const Handle handle, const char *function) const;
+        void markDirty(const uint32_t slot);
+        void rebuild();
+
+        // Slots are in depth-first order, so each subtree covers the slots [slot, subtreeEnd).
+        std::vector<Node> m_nodes;
+        std::vector<Matrix> m_localMatrices;
+        std::vector<Matrix> m_worldMatrices;
+        std::vector<Matrix> m_previousWorldMatrices;
+        std::vector<uint32_t> m_handles;
+
+        std::vector<uint32_t> m_slots;
+        std::vector<uint32_t> m_generations;
+        std::vector<uint32_t> m_freeHandles;
+        // One bit per slot, so the dirty nodes come out in slot order without sorting them.
+        std::vector<uint64_t> m_dirtyWords;
+        std::vector<uint32_t> m_dirtySlots;
+        size_t m_dirtyCount = 0;
+        std::vector<uint32_t> m_movedSlots;
+
+        size_t m_lastUpdatedCount = 0;
+        bool m_needsRebuild = false;
+    };
+}
+
+#endif
@@ -1,10 +1,10 @@
 #ifndef WINDOW_HPP
 #define WINDOW_HPP
 
-#include "GameEngineCore/Event.hpp"
+#include "GameEngineCore/EventBus.hpp"
+#include "GameEngineCore/Rendering/RenderBackend.hpp"
 
 #include <string>
-#include <functional>
 
 #include "glm/ext/vector_float2.hpp"
 
@@ -13,9 +13,8 @@ struct GLFWwindow;
 namespace GameEngine {
     class Window {
     public:
-        using EventCallbackFunction = std::function<void(BaseEvent&)>;
-
-        Window(std::string title, const unsigned int width, const unsigned int height);
+        Window(std::string title, const unsigned int width, const unsigned int height,
+               const RenderBackend backend = RenderBackend::OpenGL);
         ~Window();
 
         Window(const Window&) = delete;
@@ -23,14 +22,16 @@ namespace GameEngine {
         Window &operator=(const Window&) = delete;
         Window &operator=(Window&&) = delete;
 
-        void onUpdate();
+        void swapBuffers();
+        void pollEvents();
         unsigned int getWidth() const { return m_data.width; }
         unsigned int getHeight() const { return m_data.height; }
+        bool isHeadless() const { return GameEngine::isHeadless(m_backend); }
 
-        glm::vec2 getCurrentCursorPosition() const;
+        glm::vec2 getCurrentCursorPosition() const { return m_data.cursorPosition; }
 
-        void setEventCallback(const EventCallbackFunction &callback) {
-            m_data.eventCallbackFunction = callback;
+        void setEventBus(EventBus *eventBus) {
+            m_data.eventBus = eventBus;
         }
 
     private:
@@ -38,14 +39,17 @@ namespace GameEngine {
             std::string title;
             unsigned int width;
             unsigned int height;
+            glm::vec2 cursorPosition{0.0f, 0.0f};
 
-            EventCallbackFunction eventCallbackFunction;
+            EventBus *eventBus = nullptr;
         };
 
         int init();
+        int initHeadless();
         void shutdown();
 
         GLFWwindow *m_window = nullptr;
+        RenderBackend m_backend;
         WindowData m_data;
     };
 }
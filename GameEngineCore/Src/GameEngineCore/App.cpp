@@ -1,7 +1,7 @@
 #include "GameEngineCore/App.hpp"
 #include "GameEngineCore/Log.hpp"
 #include "GameEngineCore/Window.hpp"
-#include "GameEngineCore/Event.hpp"
+#include "GameEngineCore/EventBus.hpp"
 #include "GameEngineCore/Input.hpp"
 
 #include "GameEngineCore/Rendering/OpenGL/ShaderProgram.hpp"
@@ -9,17 +9,43 @@
 #include "GameEngineCore/Rendering/OpenGL/VertexArray.hpp"
 #include "GameEngineCore/Rendering/OpenGL/IndexBuffer.hpp"
 #include "GameEngineCore/Rendering/OpenGL/Texture2D.hpp"
+#include "GameEngineCore/Rendering/OpenGL/TextureStreamer.hpp"
+#include "GameEngineCore/Rendering/OpenGL/TextureAtlas.hpp"
+#include "GameEngineCore/Rendering/TextureFile.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StreamingBuffer.hpp"
+#include "GameEngineCore/Rendering/OpenGL/GpuProfiler.hpp"
+#include "GameEngineCore/Rendering/OpenGL/ProgramBinaryCache.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StaticGeometryBatch.hpp"
 #include "GameEngineCore/Camera.hpp"
 #include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+#include "GameEngineCore/Rendering/RenderQueue.hpp"
+#include "GameEngineCore/Rendering/UniformBlocks.hpp"
+#include "GameEngineCore/Rendering/RenderSnapshot.hpp"
+#include "GameEngineCore/Rendering/FramePipeline.hpp"
+#include "GameEngineCore/Rendering/ProceduralImage.hpp"
+#include "GameEngineCore/Memory/LinearAllocator.hpp"
+#include "GameEngineCore/Memory/AllocationTracker.hpp"
+#include "GameEngineCore/Math/Culling.hpp"
+#include "GameEngineCore/ECS/Components.hpp"
+#include "GameEngineCore/Jobs/JobSystem.hpp"
 #include "GameEngineCore/Modules/UIModule.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
 
 #include "imgui/imgui.h"
 #include "glm/mat3x3.hpp"
 #include "glm/ext/matrix_transform.hpp"
 #include "glm/trigonometric.hpp"
+#include "glm/common.hpp"
+#include "glm/exponential.hpp"
+#include "glm/geometric.hpp"
 #include "GLFW/glfw3.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 namespace GameEngine {
     GLfloat positionsCoords[] {
@@ -43,79 +69,25 @@ namespace GameEngine {
         1, 5, 0, 5, 0, 4
     };
 
-    static void generateCircle(unsigned char *data,
-                               const unsigned int width,
-                               const unsigned int height,
-                               const unsigned int centerX,
-                               const unsigned int centerY,
-                               const unsigned int radius,
-                               const unsigned char colorRed,
-                               const unsigned char colorGreen,
-                               const unsigned char colorBlue) {
-        for (unsigned int x = 0; x < width; ++x) {
-            for (unsigned int y = 0; y < height; ++y) {
-                if ((x - centerX) * (x - centerY) + (y - centerY) * (y - centerY) <
-                     radius * radius) {
-                    data[3 * (x + width * y) + 0] = colorRed;
-                    data[3 * (x + width * y) + 1] = colorGreen;
-                    data[3 * (x + width * y) + 2] = colorBlue;
-                }
-            }
-        }
-    }
-
-    static void generateSmileTexture(unsigned char *data,
-                                     const unsigned int width,
-                                     const unsigned int height) {
-        for (unsigned int x = 0; x < width; ++x) {
-            for (unsigned int y = 0; y < height; ++y) {
-                data[3 * (x + width * y) + 0] = 200;
-                data[3 * (x + width * y) + 1] = 191;
-                data[3 * (x + width * y) + 2] = 231;
-            }
-        }
-
-        generateCircle(data, width, height, width * 0.5, height * 0.5, width * 0.4,
-                       255, 255, 0);
-
-        generateCircle(data, width, height, width * 0.5, height * 0.4, width * 0.2,
-                       0, 0, 0);
-        generateCircle(data, width, height, width * 0.5, height * 0.45, width * 0.2,
-                       255, 255, 0);
-
-        generateCircle(data, width, height, width * 0.35, height * 0.6, width * 0.07,
-                       255, 0, 255);
-        generateCircle(data, width, height, width * 0.65, height * 0.6, width * 0.07,
-                       0, 0, 255);
-    }
-
-    static void generateQuadsTexture(unsigned char *data,
-                                     const unsigned int width,
-                                     const unsigned int height) {
-        for (unsigned int x = 0; x < width; ++x) {
-            for (unsigned int y = 0; y < height; ++y) {
-                if ((x < width / 2 && y < height / 2) || x >= width / 2 &&
-                     y >= height / 2) {
-                    data[3 * (x + width * y) + 0] = 0;
-                    data[3 * (x + width * y) + 1] = 0;
-                    data[3 * (x + width * y) + 2] = 0;
-                } else {
-                    data[3 * (x + width * y) + 0] = 255;
-                    data[3 * (x + width * y) + 1] = 255;
-                    data[3 * (x + width * y) + 2] = 255;
-                }
-            }
-        }
-    }
-
     const char *vertexShader =
         R"(#version 460
             layout(location = 0) in vec3 vertex_position;
             layout(location = 1) in vec2 texture_coord;
-
-            uniform mat4 model_matrix;
-            uniform mat4 view_projection_matrix;
-            uniform int current_frame;
+            layout(location = 2) in mat4 instance_model_matrix;
+
+            layout(std140, binding = 0) uniform FrameData {
+                mat4 view_matrix;
+                mat4 projection_matrix;
+                mat4 view_projection_matrix;
+                vec4 camera_position;
+                float time;
+                int current_frame;
+                float delta_time;
+            };
+
+            layout(std140, binding = 1) uniform ObjectData {
+                mat4 model_matrix;
+            };
 
             out vec2 texture_coord_smile;
             out vec2 texture_coord_quads;
@@ -125,7 +97,7 @@ namespace GameEngine {
                 texture_coord_quads = texture_coord +
                     vec2(current_frame / 1000.0f, current_frame / 1000.0f);
                 gl_Position = view_projection_matrix * model_matrix *
-                    vec4(vertex_position, 1.0);
+                    instance_model_matrix * vec4(vertex_position, 1.0);
             }
         )";
 
@@ -145,19 +117,112 @@ namespace GameEngine {
             }
         )";
 
-    std::unique_ptr<ShaderProgram> p_shaderProgram;
-    std::unique_ptr<VertexBuffer> p_cubePositionsVBO;
-    std::unique_ptr<IndexBuffer> p_cubeIndexBuffer;
-    std::unique_ptr<Texture2D> p_textureSmile;
-    std::unique_ptr<Texture2D> p_textureQuads;
-    std::unique_ptr<VertexArray> p_vao;
+    // Cubes whose textures share one TextureAtlas binding. The region is picked from the
+    // instance position, so all of them go out as a single batch.
+    const char *atlasVertexShader =
+        R"(#version 460
+            layout(location = 0) in vec3 vertex_position;
+            layout(location = 1) in vec2 texture_coord;
+            layout(location = 2) in mat4 instance_model_matrix;
+
+            layout(std140, binding = 0) uniform FrameData {
+                mat4 view_matrix;
+                mat4 projection_matrix;
+                mat4 view_projection_matrix;
+                vec4 camera_position;
+                float time;
+                int current_frame;
+                float delta_time;
+            };
+
+            layout(std140, binding = 1) uniform ObjectData {
+                mat4 model_matrix;
+            };
+
+            struct AtlasRegion {
+                vec4 uv_scale_offset;
+                uint layer;
+                uint padding[3];
+            };
+
+            layout(std430, binding = 1) readonly buffer AtlasRegions {
+                AtlasRegion atlas_regions[];
+            };
+
+            out vec3 atlas_coord;
+
+            void main() {
+                vec3 cell = round(instance_model_matrix[3].xyz);
+                uint region = uint(abs(dot(cell, vec3(1.0, 3.0, 7.0)))) % uint(atlas_regions.length());
+                vec4 uv_scale_offset = atlas_regions[region].uv_scale_offset;
+
+                atlas_coord = vec3(texture_coord * uv_scale_offset.xy + uv_scale_offset.zw,
+                                   float(atlas_regions[region].layer));
+                gl_Position = view_projection_matrix * model_matrix *
+                    instance_model_matrix * vec4(vertex_position, 1.0);
+            }
+        )";
+
+    const char *atlasFragmentShader =
+        R"(#version 460
+            in vec3 atlas_coord;
+
+            layout (binding = 4) uniform sampler2DArray InTextureAtlas;
+
+            out vec4 fragment_color;
+
+            void main() {
+                fragment_color = texture(InTextureAtlas, atlas_coord);
+            }
+        )";
+
+    // Static floor tiles drawn from the shared batch buffers with one multi-draw, reading their
+    // model matrices from the DrawData storage block.
+    const char *staticVertexShader =
+        R"(#version 460
+            layout(location = 0) in vec3 vertex_position;
+            layout(location = 1) in vec2 texture_coord;
+
+            layout(std140, binding = 0) uniform FrameData {
+                mat4 view_matrix;
+                mat4 projection_matrix;
+                mat4 view_projection_matrix;
+                vec4 camera_position;
+                float time;
+                int current_frame;
+                float delta_time;
+            };
+
+            layout(std430, binding = 0) readonly buffer DrawData {
+                mat4 draw_data[];
+            };
+
+            out vec2 tile_coord;
+
+            void main() {
+                tile_coord = texture_coord;
+                gl_Position = view_projection_matrix * draw_data[gl_BaseInstance + gl_InstanceID] *
+                    vec4(vertex_position, 1.0);
+            }
+        )";
+
+    const char *staticFragmentShader =
+        R"(#version 460
+            in vec2 tile_coord;
+
+            out vec4 fragment_color;
+
+            void main() {
+                fragment_color = vec4(vec3(0.35 + 0.1 * tile_coord.x), 1.0);
+            }
+        )";
 
-    float scale[3] = { 1.0f, 1.0f, 1.0f };
-    float rotate = 0.0f;
-    float translate[3] = { 0.0f, 0.0f, 0.0f };
-    float backgroundColor[4] = { 0.33f, 0.33f, 0.33f, 0.0f };
+    constexpr uint64_t s_allocationWarmupFramesCount = 10;
+    constexpr uint32_t s_floorMaterialId = 0;
+    constexpr int s_floorTilesPerSide = 8;
 
-    std::array<glm::vec3, 5> positions {
+    std::array<glm::vec3, 6> cubePositions {
+        glm::vec3(0.f,  0.f,  0.f),
         glm::vec3(-2.f, -2.f, -4.f),
         glm::vec3(-5.f,  0.f,  3.f),
         glm::vec3(2.f,  1.f, -2.f),
@@ -165,165 +230,428 @@ namespace GameEngine {
         glm::vec3(1.f, -7.f,  1.f)
     };
 
+    std::array<glm::vec3, 4> atlasCubePositions {
+        glm::vec3(3.f,  4.f, -5.f),
+        glm::vec3(6.f,  2.f,  6.f),
+        glm::vec3(8.f, -4.f, -3.f),
+        glm::vec3(5.f,  6.f,  2.f)
+    };
+
+    // Small procedural tiles of different sizes, so the atlas packs more than one row.
+    void addAtlasTiles(TextureAtlas &atlas) {
+        constexpr unsigned int channelsCount = 4;
+        const ImageColor white{ 240, 240, 240 };
+        const ImageColor red{ 200, 60, 50 };
+        const ImageColor blue{ 50, 90, 200 };
+        const ImageColor green{ 60, 170, 80 };
+
+        std::vector<unsigned char> pixels;
+        ProceduralImage image;
+
+        const auto addTile = [&](const unsigned int width, const unsigned int height) {
+            pixels.resize(size_t{width} * height * channelsCount);
+            image.render({ pixels.data(), width, height, channelsCount });
+            atlas.add(pixels.data(), width, height);
+            image.clear();
+        };
+
+        image.fill(white);
+        image.addCircle(64, 64, 48, red);
+        addTile(128, 128);
+
+        image.fill(blue);
+        image.addRect(16, 16, 80, 48, white);
+        addTile(96, 64);
+
+        image.addNoise(0, 0, 64, 64, 8, 7, green, white);
+        addTile(64, 64);
+
+        image.fill(green);
+        image.addRect(0, 0, 128, 16, red);
+        image.addRect(0, 32, 128, 48, red);
+        addTile(128, 64);
+
+        atlas.update();
+    }
+
+    // Unlike glm::mix, leaves a state that didn't change between the steps bit for bit intact.
+    template<typename T>
+    T blendStates(const T &previous, const T &current, const float alpha) {
+        return previous + (current - previous) * alpha;
+    }
+
     App::App() {
+        Log::init();
+
         LOG_INFO("Starting application");
     }
 
     App::~App() {
         LOG_INFO("Closing application");
+
+        Log::shutdown();
     }
 
     void App::draw() {
-        RendererOpenGL::setClearColor(backgroundColor[0], backgroundColor[1],
-                                      backgroundColor[2], backgroundColor[3]);
+        PROFILE_SCOPE("App::draw");
+
+        m_gpuProfiler->beginFrame();
+
+        if (m_framePipeline->isPipelined() != pipelinedRendering) {
+            m_framePipeline->setPipelined(pipelinedRendering);
+        }
+
+        m_framePipeline->runFrame();
+
+        if (!m_window->isHeadless()) {
+            MemoryTagScope uiScope(MemoryTag::UI);
+            PROFILE_GPU_SCOPE("App::drawUI");
+
+            UIModule::onUIDrawBegin();
+            onUIDraw();
+            UIModule::onUIDrawEnd();
+        }
+
+        m_gpuProfiler->endFrame();
+        m_window->swapBuffers();
+        Input::onFramePresented(m_presentedInputTimestamp);
+
+        AllocationTracker::endFrame();
+    }
+
+    void App::simulateFrame(void *app, RenderSnapshot &snapshot) {
+        App &self = *static_cast<App*>(app);
+        MemoryTagScope sceneScope(MemoryTag::Scene);
+
+        self.simulate(self.m_frameClock.tick());
+        self.buildSnapshot(snapshot);
+    }
+
+    void App::renderFrame(void *app, const RenderSnapshot &snapshot) {
+        MemoryTagScope renderingScope(MemoryTag::Rendering);
+
+        static_cast<App*>(app)->renderSnapshot(snapshot);
+    }
+
+    void App::buildSnapshot(RenderSnapshot &snapshot) {
+        PROFILE_SCOPE("App::buildSnapshot");
+
+        m_simulationAllocator->reset();
+        snapshot.clear();
+        snapshot.clearColor = glm::vec4(backgroundColor[0], backgroundColor[1],
+                                        backgroundColor[2], backgroundColor[3]);
+        snapshot.inputTimestamp = Input::getSnapshot().oldestEventTimestamp;
+
+        transforms.update();
+
+        // Rendering lags the simulation by up to one step, blending the last two simulated states.
+        const float alpha = m_interpolationAlpha;
+        Camera renderCamera = camera;
+        renderCamera.setPositionRotation(blendStates(m_previousCameraPosition, camera.getPosition(), alpha),
+                                         blendStates(m_previousCameraRotation, camera.getRotation(), alpha));
+
+        auto view = registry.view<TransformComponent, MeshRendererComponent,
+                                  BoundingSphereComponent>();
+        const size_t candidatesCount = view.getCandidatesCount();
+
+        auto *candidateTransforms = m_simulationAllocator->allocateArray<glm::mat4>(candidatesCount);
+        auto *candidateMeshes =
+            m_simulationAllocator->allocateArray<const MeshRendererComponent*>(candidatesCount);
+        auto *centersX = m_simulationAllocator->allocateArray<float>(candidatesCount);
+        auto *centersY = m_simulationAllocator->allocateArray<float>(candidatesCount);
+        auto *centersZ = m_simulationAllocator->allocateArray<float>(candidatesCount);
+        auto *radiuses = m_simulationAllocator->allocateArray<float>(candidatesCount);
+        auto *visibleIndices = m_simulationAllocator->allocateArray<uint32_t>(candidatesCount);
+
+        if (candidateTransforms != nullptr && candidateMeshes != nullptr && centersX != nullptr &&
+            centersY != nullptr && centersZ != nullptr && radiuses != nullptr &&
+            visibleIndices != nullptr) {
+            size_t count = 0;
+
+            view.each([&](const Entity, const TransformComponent &transform,
+                          const MeshRendererComponent &meshRenderer,
+                          const BoundingSphereComponent &boundingSphere) {
+                const glm::mat4 worldMatrix = blendStates(transforms.getPreviousWorldMatrix(transform.node),
+                                                          transforms.getWorldMatrix(transform.node), alpha);
+                const float maxScaleSquared = glm::max(glm::dot(worldMatrix[0], worldMatrix[0]),
+                    glm::max(glm::dot(worldMatrix[1], worldMatrix[1]),
+                             glm::dot(worldMatrix[2], worldMatrix[2])));
+
+                candidateTransforms[count] = worldMatrix;
+                candidateMeshes[count] = &meshRenderer;
+                centersX[count] = worldMatrix[3].x;
+                centersY[count] = worldMatrix[3].y;
+                centersZ[count] = worldMatrix[3].z;
+                radiuses[count] = boundingSphere.radius * glm::sqrt(maxScaleSquared);
+                ++count;
+            });
+
+            const BoundingSpheres bounds{ centersX, centersY, centersZ, radiuses, count };
+            const size_t visibleCount = cullSpheres(renderCamera.getFrustum(), bounds, visibleIndices);
+
+            snapshot.instanceTransforms.resize(visibleCount);
+
+            for (size_t i = 0; i < visibleCount; ++i) {
+                snapshot.instanceTransforms[i] = candidateTransforms[visibleIndices[i]];
+            }
+
+            for (size_t first = 0; first < visibleCount;) {
+                const MeshRendererComponent &meshRenderer = *candidateMeshes[visibleIndices[first]];
+                size_t last = first + 1;
+
+                while (last < visibleCount) {
+                    const MeshRendererComponent &next = *candidateMeshes[visibleIndices[last]];
+
+                    if (next.vertexArray != meshRenderer.vertexArray ||
+                        next.shaderProgram != meshRenderer.shaderProgram ||
+                        next.textures != meshRenderer.textures ||
+                        next.textureArray != meshRenderer.textureArray) {
+                        break;
+                    }
+
+                    ++last;
+                }
+
+                RenderBatch batch;
+                batch.vertexArray = meshRenderer.vertexArray;
+                batch.shaderProgram = meshRenderer.shaderProgram;
+                batch.textures = meshRenderer.textures;
+                batch.textureArray = meshRenderer.textureArray;
+                batch.firstInstance = first;
+                batch.instanceCount = last - first;
+                snapshot.batches.push_back(batch);
+
+                first = last;
+            }
+        }
+
+        FrameUniforms &frameUniforms = snapshot.frameUniforms;
+        frameUniforms.viewMatrix = renderCamera.getViewMatrix();
+        frameUniforms.projectionMatrix = renderCamera.getProjectionMatrix();
+        frameUniforms.viewProjectionMatrix = frameUniforms.projectionMatrix *
+                                             frameUniforms.viewMatrix;
+        frameUniforms.cameraPosition = glm::vec4(renderCamera.getPosition(), 1.0f);
+        frameUniforms.time = static_cast<float>(m_frameClock.getTotalTime());
+        frameUniforms.currentFrame = static_cast<int>(m_frameClock.getFrameIndex());
+        frameUniforms.deltaTime = static_cast<float>(m_frameClock.getDeltaTime());
+    }
+
+    void App::renderSnapshot(const RenderSnapshot &snapshot) {
+        PROFILE_GPU_SCOPE("App::renderSnapshot");
+
+        m_presentedInputTimestamp = snapshot.inputTimestamp;
+
+        RendererOpenGL::resetStatistics();
+        m_textureStreamer->setMemoryBudget(textureMemoryBudget);
+        m_textureStreamer->update();
+        m_frameAllocator->reset();
+        m_renderQueue->begin();
+        m_streamingBuffer->beginFrame();
+
+        RendererOpenGL::setClearColor(snapshot.clearColor.r, snapshot.clearColor.g,
+                                      snapshot.clearColor.b, snapshot.clearColor.a);
         RendererOpenGL::clear();
+        RendererOpenGL::setFrameUniforms(*m_streamingBuffer, snapshot.frameUniforms);
+
+        const size_t instancesCount = snapshot.instanceTransforms.size();
+        StreamingBuffer::Allocation instances;
 
-        p_shaderProgram->bind();
-
-        glm::mat4 scaleMatrix(scale[0], 0, 0, 0,
-                              0, scale[1], 0, 0,
-                              0, 0, scale[2], 0,
-                              0, 0, 0, 1);
-
-        float rotateInRadians = glm::radians(rotate);
-        glm::mat4 rotateMatrix(cos(rotateInRadians), sin(rotateInRadians), 0, 0,
-                               -sin(rotateInRadians), cos(rotateInRadians), 0, 0,
-                               0, 0, 1, 0,
-                               0, 0, 0, 1);
-
-        glm::mat4 translateMatrix(1, 0, 0, 0,
-                                  0, 1, 0, 0,
-                                  0, 0, 1, 0,
-                                  translate[0], translate[1], translate[2], 1);
-
-        glm::mat4 modelMatrix = translateMatrix * rotateMatrix * scaleMatrix;
-        p_shaderProgram->setMatrix_4("model_matrix", modelMatrix);
-        static int currentFrame = 0;
-        p_shaderProgram->setInt("current_frame", currentFrame++);
-
-        p_shaderProgram->setMatrix_4("view_projection_matrix",
-                                    camera.getProjectionMatrix() * camera.getViewMatrix());
-        RendererOpenGL::draw(*p_vao);
-
-        for (const glm::vec3 &currentPosition : positions) {
-            glm::mat4 translateMatrix(1, 0, 0, 0,
-                                      0, 1, 0, 0,
-                                      0, 0, 1, 0,
-                                      currentPosition[0], currentPosition[1],
-                                          currentPosition[2], 1);
-
-            p_shaderProgram->setMatrix_4("model_matrix", translateMatrix);
-            RendererOpenGL::draw(*p_vao);
+        if (instancesCount > 0) {
+            instances = m_streamingBuffer->allocate(sizeof(glm::mat4) * instancesCount,
+                                                    sizeof(glm::mat4));
+        }
+
+        if (instances.isValid()) {
+            std::memcpy(instances.data, snapshot.instanceTransforms.data(),
+                        sizeof(glm::mat4) * instancesCount);
+
+            for (const RenderBatch &batch : snapshot.batches) {
+                DrawCommand command;
+                command.vertexArray = batch.vertexArray;
+                command.shaderProgram = batch.shaderProgram;
+                command.textures = batch.textures;
+                command.textureArray = batch.textureArray;
+                command.instanceCount = batch.instanceCount;
+                command.baseInstance = instances.offset / sizeof(glm::mat4) + batch.firstInstance;
+                m_renderQueue->submit(command);
+            }
         }
 
-        UIModule::onUIDrawBegin();
-        onUIDraw();
-        UIModule::onUIDrawEnd();
+        // Binds the AtlasRegions block; the array texture itself is bound per draw command.
+        m_textureAtlas->bind(DrawCommand::s_textureArrayUnit);
+        RendererOpenGL::submit(*m_renderQueue, *m_streamingBuffer);
 
-        m_window->onUpdate();
-        onUpdate();
+        m_staticShaderProgram->bind();
+        m_staticGeometry->draw(s_floorMaterialId);
+
+        m_streamingBuffer->endFrame();
+    }
+
+    void App::simulate(const double frameTime) {
+        PROFILE_SCOPE("App::simulate");
+
+        if (!fixedTimeStepEnabled) {
+            beginSimulationStep();
+            onUpdate(static_cast<float>(frameTime));
+            commands.execute(registry);
+            m_interpolationAlpha = 1.0f;
+
+            return;
+        }
+
+        m_simulationAccumulator += std::min(frameTime, maxFrameTime);
+        unsigned int stepsCount = 0;
+
+        while (m_simulationAccumulator >= fixedTimeStep && stepsCount < maxSimulationStepsPerFrame) {
+            beginSimulationStep();
+            onUpdate(static_cast<float>(fixedTimeStep));
+            m_simulationAccumulator -= fixedTimeStep;
+            ++stepsCount;
+        }
+
+        if (m_simulationAccumulator >= fixedTimeStep) {
+            LOG_WARNING_RATE_LIMITED_TO(LogSubsystem::Core, 1000,
+                                        "Simulation is behind by {0} steps, dropping them",
+                                        static_cast<unsigned int>(m_simulationAccumulator / fixedTimeStep));
+
+            m_simulationAccumulator = std::fmod(m_simulationAccumulator, fixedTimeStep);
+        }
+
+        commands.execute(registry);
+        m_interpolationAlpha = static_cast<float>(m_simulationAccumulator / fixedTimeStep);
+    }
+
+    void App::beginSimulationStep() {
+        m_previousCameraPosition = camera.getPosition();
+        m_previousCameraRotation = camera.getRotation();
+        transforms.beginSimulationStep();
     }
 
     int App::start(unsigned int windowWidth, unsigned int windowHeight,
                    const char *title) {
-        m_window = std::make_unique<Window>(title, windowWidth, windowHeight);
+        const auto startupBegin = std::chrono::steady_clock::now();
+
+        m_window = std::make_unique<Window>(title, windowWidth, windowHeight, renderBackend);
         camera.setViewportSize(static_cast<float>(windowWidth),
                                static_cast<float>(windowHeight));
 
-        m_eventDispatcher.addEventListener<EventMouseMoved>(
+        m_eventBus.subscribe<EventMouseMoved>(
             [](EventMouseMoved &event) {
-                LOG_INFO("[MouseMoved] Mouse moved to {0}x{1}", event.x, event.y);
+                LOG_DEBUG_RATE_LIMITED_TO(LogSubsystem::Input, 250,
+                                          "[MouseMoved] Mouse moved to {0}x{1}", event.x, event.y);
             });
 
-        m_eventDispatcher.addEventListener<EventWindowResize>(
+        m_eventBus.subscribe<EventWindowResize>(
             [&](EventWindowResize &event) {
-                LOG_INFO("[Resized] Changed size to {0}x{1}", event.width, event.height);
+                LOG_INFO_TO(LogSubsystem::Window, "[Resized] Changed size to {0}x{1}", event.width, event.height);
 
                 camera.setViewportSize(event.width, event.height);
                 draw();
             });
 
-        m_eventDispatcher.addEventListener<EventWindowClose>(
-            [&](EventWindowClose &event) {
-                LOG_INFO("[WindowClose]");
+        m_eventBus.subscribe<EventWindowClose>(
+            [&](EventWindowClose&) {
+                LOG_INFO_TO(LogSubsystem::Window, "[WindowClose]");
 
                 close();
             });
         
-        m_eventDispatcher.addEventListener<EventMouseButtonPressed>(
+        m_eventBus.subscribe<EventMouseButtonPressed>(
             [&](EventMouseButtonPressed &event) {
-                LOG_INFO("[Mouse button pressed: {0}, at ({1}, {2})",
-                          static_cast<size_t>(event.m_mouseButton),
-                          event.m_positionX, event.m_positionY);
+                LOG_DEBUG_TO(LogSubsystem::Input, "[Mouse button pressed: {0}, at ({1}, {2})",
+                             static_cast<size_t>(event.m_mouseButton),
+                             event.m_positionX, event.m_positionY);
 
-                Input::pressMouseButton(event.m_mouseButton);
                 onMouseButtonEvent(event.m_mouseButton,
                                    event.m_positionX, event.m_positionY,
                                    true);
             });
 
-        m_eventDispatcher.addEventListener<EventMouseButtonReleased>(
+        m_eventBus.subscribe<EventMouseButtonReleased>(
             [&](EventMouseButtonReleased &event) {
-                LOG_INFO("[Mouse button released: {0}, at ({1}, {2})",
-                          static_cast<size_t>(event.m_mouseButton),
-                          event.m_positionX, event.m_positionY);
+                LOG_DEBUG_TO(LogSubsystem::Input, "[Mouse button released: {0}, at ({1}, {2})",
+                             static_cast<size_t>(event.m_mouseButton),
+                             event.m_positionX, event.m_positionY);
 
-                Input::releaseMouseButton(event.m_mouseButton);
                 onMouseButtonEvent(event.m_mouseButton,
                                    event.m_positionX, event.m_positionY,
                                    false);
             });
 
-        m_eventDispatcher.addEventListener<EventKeyPressed>(
+        m_eventBus.subscribe<EventKeyPressed>(
             [&](EventKeyPressed &event) {
                 if (event.m_keyCode <= KeyCode::KEY_Z) {
                     if (event.m_repeated) {
-                        LOG_INFO("[Key pressed: {0}, repeated", static_cast<char>(event.m_keyCode));
+                        LOG_DEBUG_TO(LogSubsystem::Input, "[Key pressed: {0}, repeated",
+                                     static_cast<char>(event.m_keyCode));
                     } else {
-                        LOG_INFO("[Key pressed: {0}", static_cast<char>(event.m_keyCode));
+                        LOG_DEBUG_TO(LogSubsystem::Input, "[Key pressed: {0}", static_cast<char>(event.m_keyCode));
                     }
                 }
-
-                Input::pressKey(event.m_keyCode);
             });
         
-        m_eventDispatcher.addEventListener<EventKeyReleased>(
+        m_eventBus.subscribe<EventKeyReleased>(
             [&](EventKeyReleased &event) {
                 if (event.m_keyCode <= KeyCode::KEY_Z) {
-                    LOG_INFO("[Key released: {0}", static_cast<char>(event.m_keyCode));
+                    LOG_DEBUG_TO(LogSubsystem::Input, "[Key released: {0}", static_cast<char>(event.m_keyCode));
                 }
-
-                Input::releaseKey(event.m_keyCode);
             });
 
-        m_window->setEventCallback(
-            [&](BaseEvent &event) {
-                m_eventDispatcher.dispatch(event);
-            });
+        // Checked before any worker thread or streaming job exists, so the early exit
+        // needs no shutdown.
+        ProgramBinaryCache::init(programBinaryCacheDirectory);
+        m_shaderProgram = std::make_unique<ShaderProgram>(vertexShader, fragmentShader);
+        m_staticShaderProgram = std::make_unique<ShaderProgram>(staticVertexShader, staticFragmentShader);
+        m_atlasShaderProgram = std::make_unique<ShaderProgram>(atlasVertexShader, atlasFragmentShader);
 
-        const unsigned int width = 1000;
-        const unsigned int height = 1000;
-        const unsigned int channels = 3;
+        if (!m_shaderProgram->isCompiled() || !m_staticShaderProgram->isCompiled() ||
+            !m_atlasShaderProgram->isCompiled()) {
+            LOG_CRITICAL("Failed to compile the scene shader programs");
 
-        auto *data = new unsigned char[width * height * channels];
+            return 1;
+        }
 
-        generateSmileTexture(data, width, height);
+        m_window->setEventBus(&m_eventBus);
 
-        p_textureSmile = std::make_unique<Texture2D>(data, width, height);
-        p_textureSmile->bind(0);
+        JobSystem::init();
 
-        generateQuadsTexture(data, width, height);
+        TextureStreamer::Settings textureStreamerSettings;
+        textureStreamerSettings.memoryBudget = textureMemoryBudget;
+        m_textureStreamer = std::make_unique<TextureStreamer>(textureStreamerSettings);
 
-        p_textureQuads = std::make_unique<Texture2D>(data, width, height);
-        p_textureQuads->bind(1);
+        Texture2D *textureSmile = nullptr;
 
-        delete[] data;
+        if (!texturePath.empty()) {
+            TextureData textureData;
 
-        p_shaderProgram = std::make_unique<ShaderProgram>(vertexShader, fragmentShader);
+            if (TextureFile::load(texturePath, textureData)) {
+                m_loadedTexture = std::make_unique<Texture2D>(textureData);
+                textureSmile = m_loadedTexture.get();
+            } else {
+                LOG_WARNING("Keeping the procedural texture in place of {0}", texturePath);
+            }
+        }
 
-        if (!p_shaderProgram->isCompiled()) {
-            return false;
+        if (textureSmile == nullptr) {
+            textureSmile = m_textureStreamer->request(1000, 1000,
+                [](void*, unsigned char *pixels, const unsigned int width, const unsigned int height) {
+                    ProceduralImage image;
+                    buildSmileImage(image, width, height);
+                    image.render({ pixels, width, height });
+                });
         }
+        Texture2D *textureQuads = m_textureStreamer->request(1000, 1000,
+            [](void*, unsigned char *pixels, const unsigned int width, const unsigned int height) {
+                ProceduralImage image;
+                buildQuadsImage(image, width, height);
+                image.render({ pixels, width, height });
+            });
+
+        TextureAtlas::Settings atlasSettings;
+        atlasSettings.layerSize = 512;
+        atlasSettings.layersCount = 1;
+        m_textureAtlas = std::make_unique<TextureAtlas>(atlasSettings);
+        addAtlasTiles(*m_textureAtlas);
 
         BufferLayout bufferLayout_1_vec_3 {
             ShaderDataType::Float3
@@ -334,25 +662,185 @@ namespace GameEngine {
             ShaderDataType::Float2
         };
 
-        p_vao = std::make_unique<VertexArray>();
-        p_cubePositionsVBO = std::make_unique<VertexBuffer>(positionsCoords,
+        BufferLayout bufferLayoutInstanceMat4({ ShaderDataType::Mat4 }, 1);
+
+        m_vao = std::make_unique<VertexArray>();
+        m_cubePositionsVBO = std::make_unique<VertexBuffer>(positionsCoords,
             sizeof(positionsCoords), bufferLayoutVec3_Vec3_Vec2);
-        p_cubeIndexBuffer = std::make_unique<IndexBuffer>(indices, sizeof(indices) / sizeof(GLuint));
+        m_cubeIndexBuffer = std::make_unique<IndexBuffer>(indices, sizeof(indices) / sizeof(GLuint));
+        m_streamingBuffer = std::make_unique<StreamingBuffer>(1024 * 1024);
+
+        m_vao->addVertexBuffer(*m_cubePositionsVBO);
+        m_vao->addVertexBuffer(*m_streamingBuffer, bufferLayoutInstanceMat4);
+        m_vao->setIndexBuffer(*m_cubeIndexBuffer);
+
+        constexpr size_t cubeVerticesCount = sizeof(positionsCoords) / (5 * sizeof(GLfloat));
+        constexpr size_t cubeIndicesCount = sizeof(indices) / sizeof(GLuint);
+        uint32_t floorMeshId = 0;
+
+        m_staticGeometry = std::make_unique<StaticGeometryBatch>(bufferLayoutVec3_Vec3_Vec2,
+                                                                 cubeVerticesCount, cubeIndicesCount);
+        m_staticGeometry->addMesh(positionsCoords, cubeVerticesCount, indices, cubeIndicesCount, floorMeshId);
+
+        for (int x = 0; x < s_floorTilesPerSide; ++x) {
+            for (int z = 0; z < s_floorTilesPerSide; ++z) {
+                const glm::vec3 tilePosition(2.5f * static_cast<float>(x - s_floorTilesPerSide / 2), -9.0f,
+                                             2.5f * static_cast<float>(z - s_floorTilesPerSide / 2));
+                const glm::mat4 tileMatrix = glm::scale(glm::translate(glm::mat4(1.0f), tilePosition),
+                                                        glm::vec3(1.2f, 0.1f, 1.2f));
+
+                m_staticGeometry->addDraw(floorMeshId, s_floorMaterialId, tileMatrix);
+            }
+        }
+
+        m_staticGeometry->build();
+
+        m_frameAllocator = std::make_unique<LinearAllocator>(1024 * 1024);
+        m_renderQueue = std::make_unique<RenderQueue>(*m_frameAllocator, 1024);
+        m_simulationAllocator = std::make_unique<LinearAllocator>(1024 * 1024);
+        m_framePipeline = std::make_unique<FramePipeline<RenderSnapshot>>(simulateFrame,
+                                                                          renderFrame, this);
+
+        MeshRendererComponent cubeMeshRenderer;
+        cubeMeshRenderer.vertexArray = m_vao.get();
+        cubeMeshRenderer.shaderProgram = m_shaderProgram.get();
+        cubeMeshRenderer.textures = { textureSmile, textureQuads };
+
+        for (const glm::vec3 &position : cubePositions) {
+            const Entity cube = commands.createEntity();
+
+            const TransformHierarchy::Handle node = transforms.create();
+
+            transforms.setPosition(node, position);
+            commands.addComponent<TransformComponent>(cube, node);
+            commands.addComponent<MeshRendererComponent>(cube, cubeMeshRenderer);
+            commands.addComponent<BoundingSphereComponent>(cube, glm::sqrt(3.0f));
+        }
+
+        MeshRendererComponent atlasMeshRenderer;
+        atlasMeshRenderer.vertexArray = m_vao.get();
+        atlasMeshRenderer.shaderProgram = m_atlasShaderProgram.get();
+        atlasMeshRenderer.textureArray = &m_textureAtlas->getTexture();
+
+        for (const glm::vec3 &position : atlasCubePositions) {
+            const Entity cube = commands.createEntity();
+
+            const TransformHierarchy::Handle node = transforms.create();
+
+            transforms.setPosition(node, position);
+            commands.addComponent<TransformComponent>(cube, node);
+            commands.addComponent<MeshRendererComponent>(cube, atlasMeshRenderer);
+            commands.addComponent<BoundingSphereComponent>(cube, glm::sqrt(3.0f));
+        }
 
-        p_vao->addVertexBuffer(*p_cubePositionsVBO);
-        p_vao->setIndexBuffer(*p_cubeIndexBuffer);
+        commands.execute(registry);
 
         RendererOpenGL::enableDepthTest();
 
+        m_gpuProfiler = std::make_unique<GpuProfiler>(GpuQueryFunctions::fromOpenGL());
+        GpuProfiler::setActive(m_gpuProfiler.get());
+
+        const ProgramBinaryCache::Statistics &programCacheStatistics = ProgramBinaryCache::getStatistics();
+        m_startupStatistics.milliseconds = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - startupBegin).count();
+        m_startupStatistics.programCacheHits = programCacheStatistics.hitsCount;
+        m_startupStatistics.programCacheMisses = programCacheStatistics.missesCount;
+        m_startupStatistics.programCompileMilliseconds = programCacheStatistics.compileMilliseconds;
+        m_startupStatistics.programCacheSavedMilliseconds = programCacheStatistics.savedMilliseconds;
+
+        LOG_INFO("Startup took {:.1f} ms, program cache: {} hits, {} misses, {:.1f} ms compiling, {:.1f} ms saved",
+                 m_startupStatistics.milliseconds, m_startupStatistics.programCacheHits,
+                 m_startupStatistics.programCacheMisses, m_startupStatistics.programCompileMilliseconds,
+                 m_startupStatistics.programCacheSavedMilliseconds);
+
+        Profiler::init();
+        m_previousCameraPosition = camera.getPosition();
+        m_previousCameraRotation = camera.getRotation();
+        m_frameClock.start();
+        AllocationTracker::resetTotals();
+
+        uint64_t framesCount = 0;
+
         while (!m_isCloseWindow) {
+            {
+                MemoryTagScope eventsScope(MemoryTag::Events);
+                m_window->pollEvents();
+                m_eventBus.dispatchQueued();
+            }
+
+            Input::beginFrame(m_frameClock.getFrameIndex());
+
             draw();
+            Profiler::endFrame();
+
+            // Startup work (pool chunks, first uploads, lazily grown arrays) lands in the first
+            // frames, so the totals only cover the steady state after them.
+            if (++framesCount == s_allocationWarmupFramesCount) {
+                AllocationTracker::resetTotals();
+            }
+
+            if (framesLimit != 0 && framesCount >= framesLimit) {
+                close();
+            }
         }
 
+        m_framePipeline = nullptr;
+        m_gpuProfiler = nullptr;
+        m_textureStreamer = nullptr;
+        m_staticGeometry = nullptr;
+        m_textureAtlas = nullptr;
+        m_loadedTexture = nullptr;
+        m_renderQueue = nullptr;
+        m_frameAllocator = nullptr;
+        m_simulationAllocator = nullptr;
+        m_vao = nullptr;
+        m_streamingBuffer = nullptr;
+        m_cubeIndexBuffer = nullptr;
+        m_cubePositionsVBO = nullptr;
+        m_atlasShaderProgram = nullptr;
+        m_staticShaderProgram = nullptr;
+        m_shaderProgram = nullptr;
+
+        JobSystem::shutdown();
+        Profiler::shutdown();
+        m_window->setEventBus(nullptr);
         m_window = nullptr;
 
         return 0;
     }
 
+    FrameStatistics App::getFrameStatistics() const {
+        const RendererOpenGL::Statistics &renderStatistics = RendererOpenGL::getStatistics();
+        const RendererOpenGL::MemoryStatistics &memoryStatistics = RendererOpenGL::getMemoryStatistics();
+
+        FrameStatistics statistics;
+        statistics.drawCalls = renderStatistics.drawCalls;
+        statistics.instances = renderStatistics.instances;
+        statistics.stateChangesIssued = renderStatistics.stateChangesIssued;
+        statistics.stateChangesFiltered = renderStatistics.stateChangesFiltered;
+        statistics.bufferBytes = memoryStatistics.bufferBytes;
+        statistics.buffersCount = memoryStatistics.buffersCount;
+        statistics.textureBytes = memoryStatistics.textureBytes;
+        statistics.texturesCount = memoryStatistics.texturesCount;
+
+        if (m_textureStreamer != nullptr) {
+            statistics.textureStreaming = m_textureStreamer->getStatistics();
+        }
+
+        if (m_gpuProfiler != nullptr) {
+            statistics.gpuFrameMilliseconds = m_gpuProfiler->getLatestFrameMilliseconds();
+            statistics.gpuDroppedFramesCount = m_gpuProfiler->getDroppedFramesCount();
+        }
+
+        return statistics;
+    }
+
+    const std::vector<GpuProfiler::Timing> &App::getGpuTimings() const {
+        static const std::vector<GpuProfiler::Timing> s_noTimings;
+
+        return m_gpuProfiler != nullptr ? m_gpuProfiler->getLatestTimings() : s_noTimings;
+    }
+
     glm::vec2 App::getCurrentCursorPosition() const {
         return m_window->getCurrentCursorPosition();
     }
@@ -1,4 +1,5 @@
 #include "GameEngineCore/Camera.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
 
 #include "glm/trigonometric.hpp"
 #include "glm/gtc/matrix_transform.hpp"
@@ -20,7 +21,13 @@ namespace GameEngine {
         return m_viewMatrix;
     }
 
+    Frustum Camera::getFrustum() {
+        return Frustum::fromMatrix(m_projectionMatrix * getViewMatrix());
+    }
+
     void Camera::updateViewMatrix() {
+        PROFILE_SCOPE("Camera::updateViewMatrix");
+
         const float rollInRadians = glm::radians(m_rotation.x);
         const float pitchInRadians = glm::radians(m_rotation.y);
         const float yawInRadians = glm::radians(m_rotation.z);
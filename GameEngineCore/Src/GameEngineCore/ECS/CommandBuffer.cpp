@@ -0,0 +1,79 @@
+#include "GameEngineCore/ECS/CommandBuffer.hpp"
+
+namespace GameEngine {
+    CommandBuffer::CommandBuffer(const size_t payloadCapacity)
+        : m_payloads{payloadCapacity} {}
+
+    CommandBuffer::~CommandBuffer() {
+        clear();
+    }
+
+    Entity CommandBuffer::createEntity() {
+        Entity entity;
+        entity.index = m_deferredCount++;
+        entity.generation = Entity::s_deferredGeneration;
+
+        Command command;
+        command.type = CommandType::CreateEntity;
+        command.entity = entity;
+        m_commands.push_back(command);
+
+        return entity;
+    }
+
+    void CommandBuffer::destroyEntity(const Entity entity) {
+        Command command;
+        command.type = CommandType::DestroyEntity;
+        command.entity = entity;
+        m_commands.push_back(command);
+    }
+
+    void CommandBuffer::execute(Registry &registry) {
+        m_createdEntities.resize(m_deferredCount);
+
+        for (Command &command : m_commands) {
+            switch (command.type) {
+                case CommandType::CreateEntity:
+                    m_createdEntities[command.entity.index] = registry.createEntity();
+                    break;
+                case CommandType::DestroyEntity:
+                    registry.destroyEntity(resolve(command.entity));
+                    break;
+                case CommandType::AddComponent:
+                case CommandType::RemoveComponent: {
+                    const Entity target = resolve(command.entity);
+
+                    if (registry.isAlive(target)) {
+                        command.apply(registry, target, command.payload);
+                    } else if (command.discard != nullptr) {
+                        command.discard(command.payload);
+                    }
+
+                    command.discard = nullptr;
+                    break;
+                }
+            }
+        }
+
+        m_commands.clear();
+        m_createdEntities.clear();
+        m_payloads.reset();
+        m_deferredCount = 0;
+    }
+
+    void CommandBuffer::clear() {
+        for (const Command &command : m_commands) {
+            if (command.discard != nullptr) {
+                command.discard(command.payload);
+            }
+        }
+
+        m_commands.clear();
+        m_payloads.reset();
+        m_deferredCount = 0;
+    }
+
+    Entity CommandBuffer::resolve(const Entity entity) const {
+        return entity.isDeferred() ? m_createdEntities[entity.index] : entity;
+    }
+}
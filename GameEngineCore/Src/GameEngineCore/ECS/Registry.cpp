@@ -0,0 +1,64 @@
+#include "GameEngineCore/ECS/Registry.hpp"
+
+#include <algorithm>
+
+namespace GameEngine {
+    Entity Registry::createEntity() {
+        Entity entity;
+
+        if (!m_freeIndices.empty()) {
+            entity.index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+        } else {
+            entity.index = static_cast<uint32_t>(m_generations.size());
+            m_generations.push_back(0);
+        }
+
+        entity.generation = m_generations[entity.index];
+        ++m_aliveCount;
+
+        return entity;
+    }
+
+    void Registry::createEntities(Entity *entities, const size_t count) {
+        const size_t reused = std::min(count, m_freeIndices.size());
+
+        m_generations.reserve(m_generations.size() + count - reused);
+
+        for (size_t i = 0; i < count; ++i) {
+            entities[i] = createEntity();
+        }
+    }
+
+    void Registry::destroyEntity(const Entity entity) {
+        if (!isAlive(entity)) {
+            return;
+        }
+
+        for (const std::unique_ptr<IComponentPool> &pool : m_pools) {
+            if (pool != nullptr) {
+                pool->remove(entity);
+            }
+        }
+
+        uint32_t &generation = m_generations[entity.index];
+        generation = generation + 1 == Entity::s_deferredGeneration ? 0 : generation + 1;
+
+        m_freeIndices.push_back(entity.index);
+        --m_aliveCount;
+    }
+
+    void Registry::destroyEntities(const Entity *entities, const size_t count) {
+        m_freeIndices.reserve(m_freeIndices.size() + count);
+
+        for (size_t i = 0; i < count; ++i) {
+            destroyEntity(entities[i]);
+        }
+    }
+
+    bool Registry::isAlive(const Entity entity) const {
+        return entity.index < m_generations.size() &&
+               !entity.isDeferred() &&
+               m_generations[entity.index] == entity.generation;
+    }
+}
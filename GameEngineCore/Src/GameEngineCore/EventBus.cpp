@@ -0,0 +1,108 @@
+#include "GameEngineCore/EventBus.hpp"
+
+namespace GameEngine {
+    EventBus::EventBus() = default;
+
+    void EventBus::unsubscribe(const ListenerId id) {
+        if (id == s_invalidListener) {
+            return;
+        }
+
+        switch (static_cast<EventType>(id & 0xFF)) {
+            case EventType::WindowResize:
+                removeListener(getChannel<EventWindowResize>(), id, m_isDispatching);
+                break;
+            case EventType::WindowClose:
+                removeListener(getChannel<EventWindowClose>(), id, m_isDispatching);
+                break;
+            case EventType::KeyPressed:
+                removeListener(getChannel<EventKeyPressed>(), id, m_isDispatching);
+                break;
+            case EventType::KeyReleased:
+                removeListener(getChannel<EventKeyReleased>(), id, m_isDispatching);
+                break;
+            case EventType::MouseButtonPressed:
+                removeListener(getChannel<EventMouseButtonPressed>(), id, m_isDispatching);
+                break;
+            case EventType::MouseButtonReleased:
+                removeListener(getChannel<EventMouseButtonReleased>(), id, m_isDispatching);
+                break;
+            case EventType::MouseMoved:
+                removeListener(getChannel<EventMouseMoved>(), id, m_isDispatching);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void EventBus::dispatchQueued() {
+        if (m_isDispatching) {
+            return;
+        }
+
+        const uint32_t runsEnd = m_runsTail;
+        m_firstOpenRun = runsEnd;
+        m_isDispatching = true;
+
+        while (m_runsHead != runsEnd) {
+            const EventRun run = m_runs[m_runsHead % s_runsQueueCapacity];
+            ++m_runsHead;
+
+            dispatchRun(run);
+        }
+
+        m_isDispatching = false;
+        flushPendingListeners();
+    }
+
+    bool EventBus::appendRun(const EventType type) {
+        if (isLastRunOpen(type)) {
+            ++m_runs[(m_runsTail - 1) % s_runsQueueCapacity].count;
+
+            return true;
+        }
+
+        if (m_runsTail - m_runsHead >= s_runsQueueCapacity) {
+            return false;
+        }
+
+        m_runs[m_runsTail % s_runsQueueCapacity] = { type, 1 };
+        ++m_runsTail;
+
+        return true;
+    }
+
+    void EventBus::dispatchRun(const EventRun &run) {
+        switch (run.type) {
+            case EventType::WindowResize:
+                dispatchRun<EventWindowResize>(run.count);
+                break;
+            case EventType::WindowClose:
+                dispatchRun<EventWindowClose>(run.count);
+                break;
+            case EventType::KeyPressed:
+                dispatchRun<EventKeyPressed>(run.count);
+                break;
+            case EventType::KeyReleased:
+                dispatchRun<EventKeyReleased>(run.count);
+                break;
+            case EventType::MouseButtonPressed:
+                dispatchRun<EventMouseButtonPressed>(run.count);
+                break;
+            case EventType::MouseButtonReleased:
+                dispatchRun<EventMouseButtonReleased>(run.count);
+                break;
+            case EventType::MouseMoved:
+                dispatchRun<EventMouseMoved>(run.count);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void EventBus::flushPendingListeners() {
+        std::apply([](auto &...channels) {
+            (flushChannelListeners(channels), ...);
+        }, m_channels);
+    }
+}
@@ -0,0 +1,26 @@
+#include "GameEngineCore/FrameClock.hpp"
+
+namespace GameEngine {
+    void FrameClock::start() {
+        m_startTime = Clock::now();
+        m_lastTime = m_startTime;
+        m_deltaTime = 0.0;
+        m_totalTime = 0.0;
+        m_frameIndex = 0;
+    }
+
+    double FrameClock::tick() {
+        const Clock::time_point currentTime = Clock::now();
+
+        m_deltaTime = std::chrono::duration<double>(currentTime - m_lastTime).count();
+        m_totalTime = std::chrono::duration<double>(currentTime - m_startTime).count();
+        m_lastTime = currentTime;
+        ++m_frameIndex;
+
+        return m_deltaTime;
+    }
+
+    double FrameClock::getSecondsSince(const Clock::time_point &timePoint) {
+        return std::chrono::duration<double>(Clock::now() - timePoint).count();
+    }
+}
@@ -1,30 +1,203 @@
 #include "GameEngineCore/Input.hpp"
+#include "GameEngineCore/Jobs/SpscRingBuffer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 
 namespace GameEngine {
-    bool Input::m_keysPressed[static_cast<size_t>(KeyCode::KEY_LAST) + 1] = {};
-    bool Input::m_mouseButtonsPressed[static_cast<size_t>(MouseButton::MOUSE_BUTTON_LAST) + 1] = {};
+    namespace {
+        constexpr double s_latencySmoothing = 0.05;
 
-    bool Input::isKeyPressed(const KeyCode keyCode) {
-        return m_keysPressed[static_cast<size_t>(keyCode)];
+        SpscRingBuffer<InputEvent, 4096> s_events;
+        std::atomic<size_t> s_droppedEventsCount{0};
+
+        std::array<InputSnapshot, 2> s_snapshots;
+        std::atomic<size_t> s_publishedSnapshot{0};
+        bool s_hasCursorPosition = false;
+
+        InputLatencyStats s_latencyStats;
+
+        bool isValidKey(const int code) {
+            return code >= 0 && static_cast<size_t>(code) < InputSnapshot::s_keysCount;
+        }
+
+        bool isValidMouseButton(const int code) {
+            return code >= 0 && static_cast<size_t>(code) < InputSnapshot::s_mouseButtonsCount;
+        }
+    }
+
+    bool InputSnapshot::isKeyPressed(const KeyCode keyCode) const {
+        return isValidKey(static_cast<int>(keyCode)) && keysDown.test(static_cast<size_t>(keyCode));
+    }
+
+    bool InputSnapshot::wasKeyJustPressed(const KeyCode keyCode) const {
+        return isValidKey(static_cast<int>(keyCode)) && keysPressed.test(static_cast<size_t>(keyCode));
+    }
+
+    bool InputSnapshot::wasKeyJustReleased(const KeyCode keyCode) const {
+        return isValidKey(static_cast<int>(keyCode)) && keysReleased.test(static_cast<size_t>(keyCode));
+    }
+
+    bool InputSnapshot::isMouseButtonPressed(const MouseButton mouseButton) const {
+        return mouseButtonsDown.test(static_cast<size_t>(mouseButton));
+    }
+
+    bool InputSnapshot::wasMouseButtonJustPressed(const MouseButton mouseButton) const {
+        return mouseButtonsPressed.test(static_cast<size_t>(mouseButton));
     }
 
-    void Input::pressKey(const KeyCode keyCode) {
-        m_keysPressed[static_cast<size_t>(keyCode)] = true;
+    bool InputSnapshot::wasMouseButtonJustReleased(const MouseButton mouseButton) const {
+        return mouseButtonsReleased.test(static_cast<size_t>(mouseButton));
     }
 
-    void Input::releaseKey(const KeyCode keyCode) {
-        m_keysPressed[static_cast<size_t>(keyCode)] = false;
+    bool Input::isKeyPressed(const KeyCode keyCode) {
+        return getSnapshot().isKeyPressed(keyCode);
     }
 
     bool Input::isMouseButtonPressed(const MouseButton mouseButton) {
-        return m_mouseButtonsPressed[static_cast<size_t>(mouseButton)];
+        return getSnapshot().isMouseButtonPressed(mouseButton);
+    }
+
+    void Input::recordKey(const KeyCode keyCode, const bool pressed) {
+        InputEvent event;
+        event.type = pressed ? InputEvent::Type::KeyPressed : InputEvent::Type::KeyReleased;
+        event.code = static_cast<int>(keyCode);
+
+        pushEvent(event);
+    }
+
+    void Input::recordMouseButton(const MouseButton mouseButton, const bool pressed,
+                                  const double positionX, const double positionY) {
+        InputEvent event;
+        event.type = pressed ? InputEvent::Type::MouseButtonPressed : InputEvent::Type::MouseButtonReleased;
+        event.code = static_cast<int>(mouseButton);
+        event.cursorPosition = { positionX, positionY };
+
+        pushEvent(event);
+    }
+
+    void Input::recordCursorPosition(const double positionX, const double positionY) {
+        InputEvent event;
+        event.type = InputEvent::Type::CursorMoved;
+        event.cursorPosition = { positionX, positionY };
+
+        pushEvent(event);
+    }
+
+    void Input::pushEvent(const InputEvent &event) {
+        InputEvent timestampedEvent = event;
+        timestampedEvent.timestamp = getTimestamp();
+
+        if (!s_events.tryPush(timestampedEvent)) {
+            s_droppedEventsCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void Input::beginFrame(const uint64_t frameIndex) {
+        const size_t previousIndex = s_publishedSnapshot.load(std::memory_order_relaxed);
+        const InputSnapshot &previous = s_snapshots[previousIndex];
+        InputSnapshot &snapshot = s_snapshots[1 - previousIndex];
+
+        snapshot.keysDown = previous.keysDown;
+        snapshot.keysPressed.reset();
+        snapshot.keysReleased.reset();
+        snapshot.mouseButtonsDown = previous.mouseButtonsDown;
+        snapshot.mouseButtonsPressed.reset();
+        snapshot.mouseButtonsReleased.reset();
+        snapshot.cursorPosition = previous.cursorPosition;
+        snapshot.cursorDelta = { 0.0f, 0.0f };
+        snapshot.frameIndex = frameIndex;
+        snapshot.oldestEventTimestamp = 0;
+        snapshot.eventsCount = 0;
+
+        InputEvent event;
+
+        while (s_events.tryPop(event)) {
+            if (snapshot.eventsCount++ == 0) {
+                snapshot.oldestEventTimestamp = event.timestamp;
+            }
+
+            switch (event.type) {
+                case InputEvent::Type::KeyPressed:
+                    if (isValidKey(event.code)) {
+                        snapshot.keysDown.set(event.code);
+                        snapshot.keysPressed.set(event.code);
+                    }
+                    break;
+
+                case InputEvent::Type::KeyReleased:
+                    if (isValidKey(event.code)) {
+                        snapshot.keysDown.reset(event.code);
+                        snapshot.keysReleased.set(event.code);
+                    }
+                    break;
+
+                case InputEvent::Type::MouseButtonPressed:
+                    if (isValidMouseButton(event.code)) {
+                        snapshot.mouseButtonsDown.set(event.code);
+                        snapshot.mouseButtonsPressed.set(event.code);
+                    }
+                    break;
+
+                case InputEvent::Type::MouseButtonReleased:
+                    if (isValidMouseButton(event.code)) {
+                        snapshot.mouseButtonsDown.reset(event.code);
+                        snapshot.mouseButtonsReleased.set(event.code);
+                    }
+                    break;
+
+                case InputEvent::Type::CursorMoved:
+                    if (s_hasCursorPosition) {
+                        snapshot.cursorDelta += event.cursorPosition - snapshot.cursorPosition;
+                    }
+
+                    snapshot.cursorPosition = event.cursorPosition;
+                    s_hasCursorPosition = true;
+                    break;
+            }
+        }
+
+        s_publishedSnapshot.store(1 - previousIndex, std::memory_order_release);
+    }
+
+    const InputSnapshot &Input::getSnapshot() {
+        return s_snapshots[s_publishedSnapshot.load(std::memory_order_acquire)];
+    }
+
+    uint64_t Input::getTimestamp() {
+        const auto timeSinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(timeSinceEpoch).count());
+    }
+
+    void Input::onFramePresented(const uint64_t oldestEventTimestamp) {
+        if (oldestEventTimestamp == 0) {
+            return;
+        }
+
+        const double latency = static_cast<double>(getTimestamp() - oldestEventTimestamp) / 1.0e6;
+
+        s_latencyStats.lastMilliseconds = latency;
+        s_latencyStats.maxMilliseconds = std::max(s_latencyStats.maxMilliseconds, latency);
+        s_latencyStats.averageMilliseconds = s_latencyStats.samplesCount == 0
+            ? latency
+            : s_latencyStats.averageMilliseconds +
+              (latency - s_latencyStats.averageMilliseconds) * s_latencySmoothing;
+        ++s_latencyStats.samplesCount;
+    }
+
+    InputLatencyStats Input::getLatencyStats() {
+        return s_latencyStats;
     }
 
-    void Input::pressMouseButton(const MouseButton mouseButton) {
-        m_mouseButtonsPressed[static_cast<size_t>(mouseButton)] = true;
+    void Input::resetLatencyStats() {
+        s_latencyStats = InputLatencyStats{};
     }
 
-    void Input::releaseMouseButton(const MouseButton mouseButton) {
-        m_mouseButtonsPressed[static_cast<size_t>(mouseButton)] = false;
+    size_t Input::getDroppedEventsCount() {
+        return s_droppedEventsCount.load(std::memory_order_relaxed);
     }
 }
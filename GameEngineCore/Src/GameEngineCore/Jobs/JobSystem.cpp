@@ -0,0 +1,281 @@
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+#include "GameEngineCore/Jobs/WorkStealingDeque.hpp"
+
+#include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Memory/AllocationTracker.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GameEngine {
+    // A slot stays queued from run() until whichever worker takes it has copied the
+    // job out, so run() never overwrites a job that still sits in a deque or is being
+    // stolen, no matter how many jobs are in flight.
+    struct JobSlot {
+        Job job;
+        std::atomic<bool> isQueued{false};
+    };
+
+    namespace {
+        struct WorkerState {
+            WorkStealingDeque<JobSlot, JobSystem::s_jobsPerWorker> deque;
+            std::array<JobSlot, JobSystem::s_jobsPerWorker> slots;
+            // Jobs taken by this worker whose dependency was not done yet. Only the owning
+            // thread touches it; they are retried before new work is taken.
+            std::vector<JobSlot*> parked;
+            size_t nextSlot = 0;
+            uint32_t randomState = 0;
+        };
+
+        constexpr size_t s_invalidWorker = std::numeric_limits<size_t>::max();
+
+        std::vector<std::unique_ptr<WorkerState>> s_workers;
+        std::vector<std::thread> s_threads;
+        std::atomic<bool> s_quit{false};
+        std::atomic<int64_t> s_pendingJobs{0};
+        std::atomic<uint32_t> s_sleepingWorkers{0};
+        std::mutex s_wakeUpMutex;
+        std::condition_variable s_wakeUp;
+
+        thread_local size_t s_workerIndex = s_invalidWorker;
+
+        uint32_t nextRandom(uint32_t &state) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            return state;
+        }
+    }
+
+    size_t JobSystem::s_workersCount = 0;
+
+    bool JobSystem::init(const size_t workersCount) {
+        if (isInitialized()) {
+            LOG_WARNING_TO(LogSubsystem::Jobs,
+                           "JobSystem: already initialized with {0} workers", s_workersCount);
+
+            return true;
+        }
+
+        size_t count = workersCount > 0 ? workersCount : std::thread::hardware_concurrency();
+        count = std::min(std::max(count, size_t{1}), s_maxWorkers);
+
+        s_quit.store(false);
+        s_pendingJobs.store(0);
+
+        for (size_t i = 0; i < count; ++i) {
+            s_workers.push_back(std::make_unique<WorkerState>());
+            s_workers.back()->parked.reserve(s_jobsPerWorker);
+            s_workers.back()->randomState = static_cast<uint32_t>(i * 2654435761u + 1);
+        }
+
+        s_workersCount = count;
+        s_workerIndex = 0;
+
+        for (size_t i = 1; i < count; ++i) {
+            s_threads.emplace_back(workerLoop, i);
+        }
+
+        LOG_INFO_TO(LogSubsystem::Jobs, "JobSystem: started with {0} workers", count);
+
+        return true;
+    }
+
+    void JobSystem::shutdown() {
+        if (!isInitialized()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(s_wakeUpMutex);
+            s_quit.store(true);
+        }
+
+        s_wakeUp.notify_all();
+
+        for (std::thread &thread : s_threads) {
+            thread.join();
+        }
+
+        s_threads.clear();
+        s_workers.clear();
+        s_workersCount = 0;
+        s_workerIndex = s_invalidWorker;
+    }
+
+    void JobSystem::run(const Job::Function function, void *data, JobCounter &counter,
+                        const JobCounter *dependency, const size_t begin, const size_t end) {
+        const size_t workerIndex = s_workerIndex;
+
+        if (!isInitialized() || workerIndex == s_invalidWorker) {
+            if (dependency != nullptr) {
+                wait(*dependency);
+            }
+
+            function(data, begin, end);
+
+            return;
+        }
+
+        WorkerState &worker = *s_workers[workerIndex];
+        JobSlot &slot = worker.slots[worker.nextSlot & (s_jobsPerWorker - 1)];
+
+        // Every slot is queued or still being taken: run inline instead of queueing.
+        if (slot.isQueued.load(std::memory_order_acquire)) {
+            if (dependency != nullptr) {
+                wait(*dependency);
+            }
+
+            function(data, begin, end);
+
+            return;
+        }
+
+        slot.job.function = function;
+        slot.job.data = data;
+        slot.job.begin = begin;
+        slot.job.end = end;
+        slot.job.counter = &counter;
+        slot.job.dependency = dependency;
+        slot.isQueued.store(true, std::memory_order_relaxed);
+
+        counter.value.fetch_add(1, std::memory_order_relaxed);
+        s_pendingJobs.fetch_add(1);
+
+        if (!worker.deque.push(&slot)) {
+            slot.isQueued.store(false, std::memory_order_relaxed);
+            counter.value.fetch_sub(1, std::memory_order_relaxed);
+            s_pendingJobs.fetch_sub(1);
+
+            if (dependency != nullptr) {
+                wait(*dependency);
+            }
+
+            function(data, begin, end);
+
+            return;
+        }
+
+        ++worker.nextSlot;
+
+        if (s_sleepingWorkers.load() > 0) {
+            std::lock_guard<std::mutex> lock(s_wakeUpMutex);
+            s_wakeUp.notify_one();
+        }
+    }
+
+    void JobSystem::wait(const JobCounter &counter) {
+        const size_t workerIndex = s_workerIndex;
+
+        while (!counter.isDone()) {
+            if (workerIndex == s_invalidWorker || !executeNext(workerIndex)) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (workerIndex == s_invalidWorker || workerIndex != 0) {
+            return;
+        }
+
+        // The main thread may not wait again for a while, so hand its parked jobs back
+        // to the deque where other workers can steal them.
+        WorkerState &worker = *s_workers[workerIndex];
+
+        while (!worker.parked.empty() && worker.deque.push(worker.parked.back())) {
+            worker.parked.pop_back();
+        }
+    }
+
+    size_t JobSystem::computeGrainSize(const size_t count) {
+        const size_t chunksCount = getWorkersCount() * 4;
+
+        return std::max((count + chunksCount - 1) / chunksCount, size_t{1});
+    }
+
+    bool JobSystem::executeNext(const size_t workerIndex) {
+        WorkerState &worker = *s_workers[workerIndex];
+
+        for (size_t i = 0; i < worker.parked.size(); ++i) {
+            JobSlot *parked = worker.parked[i];
+
+            if (parked->job.dependency->isDone()) {
+                worker.parked[i] = worker.parked.back();
+                worker.parked.pop_back();
+                s_pendingJobs.fetch_sub(1);
+                execute(*parked);
+
+                return true;
+            }
+        }
+
+        JobSlot *slot = worker.deque.pop();
+
+        if (slot == nullptr && s_workersCount > 1) {
+            const size_t first = nextRandom(worker.randomState) % s_workersCount;
+
+            for (size_t i = 0; i < s_workersCount && slot == nullptr; ++i) {
+                const size_t victim = (first + i) % s_workersCount;
+
+                if (victim != workerIndex) {
+                    slot = s_workers[victim]->deque.steal();
+                }
+            }
+        }
+
+        if (slot == nullptr) {
+            return false;
+        }
+
+        // Park instead of requeueing: pushing it back onto this LIFO deque would pop it
+        // again right away and starve the dependency queued underneath it.
+        if (slot->job.dependency != nullptr && !slot->job.dependency->isDone()) {
+            if (worker.parked.size() < worker.parked.capacity()) {
+                worker.parked.push_back(slot);
+
+                return true;
+            }
+
+            wait(*slot->job.dependency);
+        }
+
+        s_pendingJobs.fetch_sub(1);
+        execute(*slot);
+
+        return true;
+    }
+
+    void JobSystem::execute(JobSlot &slot) {
+        // Copy before releasing the slot, run() may refill it while the job executes.
+        const Job job = slot.job;
+        slot.isQueued.store(false, std::memory_order_release);
+
+        job.function(job.data, job.begin, job.end);
+        job.counter->value.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void JobSystem::workerLoop(const size_t workerIndex) {
+        s_workerIndex = workerIndex;
+        AllocationTracker::setThreadTag(MemoryTag::Jobs);
+
+        const std::string threadName = "Worker " + std::to_string(workerIndex);
+        Profiler::setThreadName(threadName.c_str());
+
+        while (!s_quit.load(std::memory_order_acquire)) {
+            if (executeNext(workerIndex)) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(s_wakeUpMutex);
+            s_sleepingWorkers.fetch_add(1);
+            s_wakeUp.wait(lock, [] { return s_pendingJobs.load() > 0 || s_quit.load(); });
+            s_sleepingWorkers.fetch_sub(1);
+        }
+    }
+}
@@ -0,0 +1,129 @@
+#include "GameEngineCore/Log.hpp"
+
+#include "spdlog/async.h"
+#include "spdlog/sinks/stdout_color_sinks.h"
+
+#include <array>
+#include <memory>
+
+namespace GameEngine {
+    namespace {
+        constexpr size_t s_subsystemsCount = static_cast<size_t>(LogSubsystem::SubsystemsCount);
+
+        const char *s_subsystemNames[] {
+            "Core",
+            "Window",
+            "Input",
+            "Rendering",
+            "Scene",
+            "Jobs",
+            "Memory"
+        };
+
+        std::array<std::shared_ptr<spdlog::logger>, s_subsystemsCount> s_loggers;
+        std::array<spdlog::logger*, s_subsystemsCount> s_loggerPointers{};
+        bool s_isInitialized = false;
+    }
+
+    bool Log::init(const LogConfig &config) {
+        if (s_isInitialized) {
+            return true;
+        }
+
+        std::shared_ptr<spdlog::sinks::sink> sink = config.sink;
+
+        if (!sink) {
+            sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        }
+
+        if (config.asynchronous) {
+            spdlog::init_thread_pool(config.queueSize, config.threadsCount);
+        }
+
+        const spdlog::async_overflow_policy overflowPolicy = config.blockOnOverflow
+            ? spdlog::async_overflow_policy::block
+            : spdlog::async_overflow_policy::overrun_oldest;
+
+        for (size_t i = 0; i < s_subsystemsCount; ++i) {
+            std::shared_ptr<spdlog::logger> logger;
+
+            if (config.asynchronous) {
+                logger = std::make_shared<spdlog::async_logger>(s_subsystemNames[i], sink,
+                                                                spdlog::thread_pool(), overflowPolicy);
+            } else {
+                logger = std::make_shared<spdlog::logger>(s_subsystemNames[i], sink);
+            }
+
+            logger->set_level(config.level);
+            logger->flush_on(spdlog::level::err);
+
+            s_loggers[i] = logger;
+            s_loggerPointers[i] = logger.get();
+        }
+
+        spdlog::set_default_logger(s_loggers[static_cast<size_t>(LogSubsystem::Core)]);
+        s_isInitialized = true;
+
+        return true;
+    }
+
+    void Log::shutdown() {
+        if (!s_isInitialized) {
+            return;
+        }
+
+        flush();
+
+        s_loggerPointers.fill(nullptr);
+        s_loggers.fill(nullptr);
+        s_isInitialized = false;
+
+        spdlog::shutdown();
+        spdlog::set_default_logger(std::make_shared<spdlog::logger>(
+            s_subsystemNames[0], std::make_shared<spdlog::sinks::stdout_color_sink_mt>()));
+    }
+
+    bool Log::isInitialized() {
+        return s_isInitialized;
+    }
+
+    spdlog::logger *Log::getLogger(const LogSubsystem subsystem) {
+        spdlog::logger *logger = s_loggerPointers[static_cast<size_t>(subsystem)];
+
+        return logger != nullptr ? logger : spdlog::default_logger_raw();
+    }
+
+    void Log::setLevel(const LogSubsystem subsystem, const spdlog::level::level_enum level) {
+        getLogger(subsystem)->set_level(level);
+    }
+
+    void Log::setLevel(const spdlog::level::level_enum level) {
+        for (size_t i = 0; i < s_subsystemsCount; ++i) {
+            setLevel(static_cast<LogSubsystem>(i), level);
+        }
+    }
+
+    void Log::flush() {
+        for (spdlog::logger *logger : s_loggerPointers) {
+            if (logger != nullptr) {
+                logger->flush();
+            }
+        }
+    }
+
+    size_t Log::getDroppedMessagesCount() {
+        if (!s_isInitialized) {
+            return 0;
+        }
+
+        const std::shared_ptr<spdlog::details::thread_pool> threadPool = spdlog::thread_pool();
+
+        return threadPool ? threadPool->overrun_counter() + threadPool->discard_counter() : 0;
+    }
+
+    const char *Log::getSubsystemName(const LogSubsystem subsystem) {
+        return subsystem < LogSubsystem::SubsystemsCount
+            ? s_subsystemNames[static_cast<size_t>(subsystem)]
+            : "Unknown";
+    }
+}
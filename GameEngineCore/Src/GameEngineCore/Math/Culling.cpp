@@ -0,0 +1,207 @@
+#include "GameEngineCore/Math/Culling.hpp"
+
+#if defined(__AVX__)
+    #define CULLING_AVX
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CULLING_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace GameEngine {
+    size_t cullSpheresScalar(const Frustum &frustum, const BoundingSpheres &spheres,
+                             uint32_t *visibleIndices, const size_t first) {
+        size_t visibleCount = 0;
+
+        for (size_t i = first; i < spheres.count; ++i) {
+            bool isVisible = true;
+
+            for (const glm::vec4 &plane : frustum.planes) {
+                const float distance = plane.x * spheres.centerX[i] + plane.y * spheres.centerY[i] +
+                                       plane.z * spheres.centerZ[i] + plane.w;
+
+                isVisible = isVisible && distance >= -spheres.radius[i];
+            }
+
+            visibleIndices[visibleCount] = static_cast<uint32_t>(i);
+            visibleCount += isVisible ? 1 : 0;
+        }
+
+        return visibleCount;
+    }
+
+    size_t cullBoxesScalar(const Frustum &frustum, const BoundingBoxes &boxes,
+                           uint32_t *visibleIndices, const size_t first) {
+        size_t visibleCount = 0;
+
+        for (size_t i = first; i < boxes.count; ++i) {
+            bool isVisible = true;
+
+            for (const glm::vec4 &plane : frustum.planes) {
+                const float x = plane.x >= 0.0f ? boxes.maxX[i] : boxes.minX[i];
+                const float y = plane.y >= 0.0f ? boxes.maxY[i] : boxes.minY[i];
+                const float z = plane.z >= 0.0f ? boxes.maxZ[i] : boxes.minZ[i];
+
+                isVisible = isVisible && plane.x * x + plane.y * y + plane.z * z + plane.w >= 0.0f;
+            }
+
+            visibleIndices[visibleCount] = static_cast<uint32_t>(i);
+            visibleCount += isVisible ? 1 : 0;
+        }
+
+        return visibleCount;
+    }
+
+#if defined(CULLING_AVX)
+    constexpr size_t s_laneCount = 8;
+
+    static size_t compactLanes(const int mask, const size_t first, uint32_t *visibleIndices) {
+        size_t visibleCount = 0;
+
+        for (size_t lane = 0; lane < s_laneCount; ++lane) {
+            visibleIndices[visibleCount] = static_cast<uint32_t>(first + lane);
+            visibleCount += (mask >> lane) & 1;
+        }
+
+        return visibleCount;
+    }
+
+    size_t cullSpheres(const Frustum &frustum, const BoundingSpheres &spheres,
+                       uint32_t *visibleIndices) {
+        size_t visibleCount = 0;
+        size_t i = 0;
+
+        for (; i + s_laneCount <= spheres.count; i += s_laneCount) {
+            const __m256 centerX = _mm256_loadu_ps(spheres.centerX + i);
+            const __m256 centerY = _mm256_loadu_ps(spheres.centerY + i);
+            const __m256 centerZ = _mm256_loadu_ps(spheres.centerZ + i);
+            const __m256 negativeRadius = _mm256_sub_ps(_mm256_setzero_ps(),
+                                                        _mm256_loadu_ps(spheres.radius + i));
+            __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            for (const glm::vec4 &plane : frustum.planes) {
+                __m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.x), centerX);
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.y), centerY));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.z), centerZ));
+                distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+
+                visible = _mm256_and_ps(visible, _mm256_cmp_ps(distance, negativeRadius, _CMP_GE_OQ));
+            }
+
+            visibleCount += compactLanes(_mm256_movemask_ps(visible), i,
+                                         visibleIndices + visibleCount);
+        }
+
+        return visibleCount + cullSpheresScalar(frustum, spheres, visibleIndices + visibleCount, i);
+    }
+
+    size_t cullBoxes(const Frustum &frustum, const BoundingBoxes &boxes,
+                     uint32_t *visibleIndices) {
+        size_t visibleCount = 0;
+        size_t i = 0;
+
+        for (; i + s_laneCount <= boxes.count; i += s_laneCount) {
+            __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+            for (const glm::vec4 &plane : frustum.planes) {
+                const __m256 x = _mm256_loadu_ps((plane.x >= 0.0f ? boxes.maxX : boxes.minX) + i);
+                const __m256 y = _mm256_loadu_ps((plane.y >= 0.0f ? boxes.maxY : boxes.minY) + i);
+                const __m256 z = _mm256_loadu_ps((plane.z >= 0.0f ? boxes.maxZ : boxes.minZ) + i);
+
+                __m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.x), x);
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.y), y));
+                distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.z), z));
+                distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+
+                visible = _mm256_and_ps(visible, _mm256_cmp_ps(distance, _mm256_setzero_ps(),
+                                                               _CMP_GE_OQ));
+            }
+
+            visibleCount += compactLanes(_mm256_movemask_ps(visible), i,
+                                         visibleIndices + visibleCount);
+        }
+
+        return visibleCount + cullBoxesScalar(frustum, boxes, visibleIndices + visibleCount, i);
+    }
+#elif defined(CULLING_SSE)
+    constexpr size_t s_laneCount = 4;
+
+    static size_t compactLanes(const int mask, const size_t first, uint32_t *visibleIndices) {
+        size_t visibleCount = 0;
+
+        for (size_t lane = 0; lane < s_laneCount; ++lane) {
+            visibleIndices[visibleCount] = static_cast<uint32_t>(first + lane);
+            visibleCount += (mask >> lane) & 1;
+        }
+
+        return visibleCount;
+    }
+
+    size_t cullSpheres(const Frustum &frustum, const BoundingSpheres &spheres,
+                       uint32_t *visibleIndices) {
+        size_t visibleCount = 0;
+        size_t i = 0;
+
+        for (; i + s_laneCount <= spheres.count; i += s_laneCount) {
+            const __m128 centerX = _mm_loadu_ps(spheres.centerX + i);
+            const __m128 centerY = _mm_loadu_ps(spheres.centerY + i);
+            const __m128 centerZ = _mm_loadu_ps(spheres.centerZ + i);
+            const __m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(),
+                                                     _mm_loadu_ps(spheres.radius + i));
+            __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+            for (const glm::vec4 &plane : frustum.planes) {
+                __m128 distance = _mm_mul_ps(_mm_set1_ps(plane.x), centerX);
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), centerY));
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), centerZ));
+                distance = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+
+                visible = _mm_and_ps(visible, _mm_cmpge_ps(distance, negativeRadius));
+            }
+
+            visibleCount += compactLanes(_mm_movemask_ps(visible), i,
+                                         visibleIndices + visibleCount);
+        }
+
+        return visibleCount + cullSpheresScalar(frustum, spheres, visibleIndices + visibleCount, i);
+    }
+
+    size_t cullBoxes(const Frustum &frustum, const BoundingBoxes &boxes,
+                     uint32_t *visibleIndices) {
+        size_t visibleCount = 0;
+        size_t i = 0;
+
+        for (; i + s_laneCount <= boxes.count; i += s_laneCount) {
+            __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+            for (const glm::vec4 &plane : frustum.planes) {
+                const __m128 x = _mm_loadu_ps((plane.x >= 0.0f ? boxes.maxX : boxes.minX) + i);
+                const __m128 y = _mm_loadu_ps((plane.y >= 0.0f ? boxes.maxY : boxes.minY) + i);
+                const __m128 z = _mm_loadu_ps((plane.z >= 0.0f ? boxes.maxZ : boxes.minZ) + i);
+
+                __m128 distance = _mm_mul_ps(_mm_set1_ps(plane.x), x);
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), y));
+                distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), z));
+                distance = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+
+                visible = _mm_and_ps(visible, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+            }
+
+            visibleCount += compactLanes(_mm_movemask_ps(visible), i,
+                                         visibleIndices + visibleCount);
+        }
+
+        return visibleCount + cullBoxesScalar(frustum, boxes, visibleIndices + visibleCount, i);
+    }
+#else
+    size_t cullSpheres(const Frustum &frustum, const BoundingSpheres &spheres,
+                       uint32_t *visibleIndices) {
+        return cullSpheresScalar(frustum, spheres, visibleIndices);
+    }
+
+    size_t cullBoxes(const Frustum &frustum, const BoundingBoxes &boxes,
+                     uint32_t *visibleIndices) {
+        return cullBoxesScalar(frustum, boxes, visibleIndices);
+    }
+#endif
+}
@@ -0,0 +1,195 @@
+#include "GameEngineCore/Memory/AllocationTracker.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace GameEngine {
+    namespace {
+        constexpr size_t s_tagsCount = static_cast<size_t>(MemoryTag::TagsCount);
+
+        std::array<std::atomic<size_t>, s_tagsCount> s_currentBytes{};
+        std::array<std::atomic<size_t>, s_tagsCount> s_currentAllocations{};
+        std::array<AllocationTracker::Counters, s_tagsCount> s_frameCounters{};
+        std::array<AllocationTracker::Counters, s_tagsCount> s_totalCounters{};
+        size_t s_totalFramesCount = 0;
+        size_t s_framesWithAllocationsCount = 0;
+
+        thread_local MemoryTag s_threadTag = MemoryTag::General;
+
+        const char *s_tagNames[] {
+            "General",
+            "Events",
+            "Scene",
+            "Rendering",
+            "UI",
+            "Jobs",
+            "Assets"
+        };
+    }
+
+    void AllocationTracker::recordAllocation(const size_t size) {
+        const size_t tag = static_cast<size_t>(s_threadTag);
+
+        s_currentBytes[tag].fetch_add(size, std::memory_order_relaxed);
+        s_currentAllocations[tag].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AllocationTracker::endFrame() {
+        size_t frameAllocations = 0;
+
+        for (size_t tag = 0; tag < s_tagsCount; ++tag) {
+            s_frameCounters[tag].bytes = s_currentBytes[tag].exchange(0, std::memory_order_relaxed);
+            s_frameCounters[tag].allocations =
+                s_currentAllocations[tag].exchange(0, std::memory_order_relaxed);
+
+            s_totalCounters[tag].bytes += s_frameCounters[tag].bytes;
+            s_totalCounters[tag].allocations += s_frameCounters[tag].allocations;
+            frameAllocations += s_frameCounters[tag].allocations;
+        }
+
+        ++s_totalFramesCount;
+
+        if (frameAllocations > 0) {
+            ++s_framesWithAllocationsCount;
+        }
+    }
+
+    AllocationTracker::Counters AllocationTracker::getFrameCounters(const MemoryTag tag) {
+        return s_frameCounters[static_cast<size_t>(tag)];
+    }
+
+    AllocationTracker::Counters AllocationTracker::getFrameTotal() {
+        Counters total;
+
+        for (const Counters &counters : s_frameCounters) {
+            total.bytes += counters.bytes;
+            total.allocations += counters.allocations;
+        }
+
+        return total;
+    }
+
+    void AllocationTracker::resetTotals() {
+        s_totalCounters.fill(Counters{});
+        s_totalFramesCount = 0;
+        s_framesWithAllocationsCount = 0;
+    }
+
+    AllocationTracker::Counters AllocationTracker::getTotalCounters(const MemoryTag tag) {
+        return s_totalCounters[static_cast<size_t>(tag)];
+    }
+
+    size_t AllocationTracker::getTotalFramesCount() {
+        return s_totalFramesCount;
+    }
+
+    size_t AllocationTracker::getFramesWithAllocationsCount() {
+        return s_framesWithAllocationsCount;
+    }
+
+    MemoryTag AllocationTracker::getThreadTag() {
+        return s_threadTag;
+    }
+
+    MemoryTag AllocationTracker::setThreadTag(const MemoryTag tag) {
+        const MemoryTag previousTag = s_threadTag;
+        s_threadTag = tag;
+
+        return previousTag;
+    }
+
+    const char *AllocationTracker::getTagName(const MemoryTag tag) {
+        return tag < MemoryTag::TagsCount ? s_tagNames[static_cast<size_t>(tag)] : "Unknown";
+    }
+}
+
+#if defined(GAME_ENGINE_TRACK_ALLOCATIONS)
+static void *trackedAllocate(const std::size_t size) {
+    GameEngine::AllocationTracker::recordAllocation(size);
+
+    if (void *memory = std::malloc(size > 0 ? size : 1)) {
+        return memory;
+    }
+
+    throw std::bad_alloc();
+}
+
+static void *trackedAllocateAligned(const std::size_t size, const std::align_val_t alignment) {
+    GameEngine::AllocationTracker::recordAllocation(size);
+
+    const std::size_t alignmentValue = static_cast<std::size_t>(alignment);
+    const std::size_t alignedSize = ((size > 0 ? size : 1) + alignmentValue - 1) & ~(alignmentValue - 1);
+
+#if defined(_MSC_VER)
+    void *memory = _aligned_malloc(alignedSize, alignmentValue);
+#else
+    void *memory = std::aligned_alloc(alignmentValue, alignedSize);
+#endif
+
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+static void trackedFreeAligned(void *memory) noexcept {
+#if defined(_MSC_VER)
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+void *operator new(std::size_t size) { return trackedAllocate(size); }
+void *operator new[](std::size_t size) { return trackedAllocate(size); }
+void *operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    GameEngine::AllocationTracker::recordAllocation(size);
+    return std::malloc(size > 0 ? size : 1);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    GameEngine::AllocationTracker::recordAllocation(size);
+    return std::malloc(size > 0 ? size : 1);
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    return trackedAllocateAligned(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return trackedAllocateAligned(size, alignment);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return trackedAllocateAligned(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return trackedAllocateAligned(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void *memory, std::align_val_t) noexcept { trackedFreeAligned(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { trackedFreeAligned(memory); }
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept { trackedFreeAligned(memory); }
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept { trackedFreeAligned(memory); }
+void operator delete(void *memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void *memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t, const std::nothrow_t&) noexcept { trackedFreeAligned(memory); }
+void operator delete[](void *memory, std::align_val_t, const std::nothrow_t&) noexcept { trackedFreeAligned(memory); }
+#endif
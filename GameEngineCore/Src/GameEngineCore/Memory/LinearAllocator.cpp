@@ -0,0 +1,33 @@
+#include "GameEngineCore/Memory/LinearAllocator.hpp"
+
+#include "GameEngineCore/Log.hpp"
+
+#include <cstdint>
+#include <new>
+
+namespace GameEngine {
+    LinearAllocator::LinearAllocator(const size_t capacity)
+        : m_data{static_cast<unsigned char*>(::operator new(capacity))}, m_capacity{capacity} {}
+
+    LinearAllocator::~LinearAllocator() {
+        ::operator delete(m_data);
+    }
+
+    void *LinearAllocator::allocate(const size_t size, const size_t alignment) {
+        const uintptr_t current = reinterpret_cast<uintptr_t>(m_data) + m_offset;
+        const uintptr_t aligned = (current + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        const size_t newOffset = static_cast<size_t>(aligned - reinterpret_cast<uintptr_t>(m_data)) + size;
+
+        if (newOffset > m_capacity) {
+            LOG_ERROR_TO(LogSubsystem::Memory,
+                         "LinearAllocator: out of memory ({0} of {1} bytes requested)",
+                         newOffset, m_capacity);
+
+            return nullptr;
+        }
+
+        m_offset = newOffset;
+
+        return reinterpret_cast<void*>(aligned);
+    }
+}
@@ -0,0 +1,71 @@
+#include "GameEngineCore/Memory/PoolAllocator.hpp"
+
+#include "GameEngineCore/Log.hpp"
+
+namespace GameEngine {
+    PoolAllocator::PoolAllocator(const size_t blockSize, const size_t blockAlignment,
+                                 const size_t blocksPerChunk)
+        : m_blockAlignment{std::max(blockAlignment, alignof(FreeBlock))},
+          m_blocksPerChunk{std::max(blocksPerChunk, size_t{1})} {
+        m_blockSize = (std::max(blockSize, sizeof(FreeBlock)) + m_blockAlignment - 1) &
+                      ~(m_blockAlignment - 1);
+    }
+
+    PoolAllocator::~PoolAllocator() {
+        if (m_allocatedCount > 0) {
+            LOG_WARNING_TO(LogSubsystem::Memory,
+                           "PoolAllocator: destroyed with {0} live blocks", m_allocatedCount);
+        }
+
+        for (void *chunk : m_chunks) {
+            ::operator delete(chunk, std::align_val_t{m_blockAlignment});
+        }
+    }
+
+    void *PoolAllocator::allocate() {
+        if (m_freeList == nullptr && !addChunk()) {
+            return nullptr;
+        }
+
+        FreeBlock *block = m_freeList;
+        m_freeList = block->next;
+        ++m_allocatedCount;
+
+        return block;
+    }
+
+    void PoolAllocator::deallocate(void *block) {
+        if (block == nullptr) {
+            return;
+        }
+
+        FreeBlock *freeBlock = static_cast<FreeBlock*>(block);
+        freeBlock->next = m_freeList;
+        m_freeList = freeBlock;
+        --m_allocatedCount;
+    }
+
+    bool PoolAllocator::addChunk() {
+        void *chunk = ::operator new(m_blockSize * m_blocksPerChunk,
+                                     std::align_val_t{m_blockAlignment}, std::nothrow);
+
+        if (chunk == nullptr) {
+            LOG_ERROR_TO(LogSubsystem::Memory,
+                         "PoolAllocator: failed to allocate chunk of {0} blocks", m_blocksPerChunk);
+
+            return false;
+        }
+
+        m_chunks.push_back(chunk);
+
+        unsigned char *blocks = static_cast<unsigned char*>(chunk);
+
+        for (size_t i = m_blocksPerChunk; i > 0; --i) {
+            FreeBlock *block = reinterpret_cast<FreeBlock*>(blocks + (i - 1) * m_blockSize);
+            block->next = m_freeList;
+            m_freeList = block;
+        }
+
+        return true;
+    }
+}
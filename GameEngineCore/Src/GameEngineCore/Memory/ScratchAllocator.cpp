@@ -0,0 +1,19 @@
+#include "GameEngineCore/Memory/ScratchAllocator.hpp"
+
+#include <memory>
+
+namespace GameEngine {
+    LinearAllocator &getThreadScratchAllocator() {
+        thread_local std::unique_ptr<LinearAllocator> scratchAllocator =
+            std::make_unique<LinearAllocator>(ScratchScope::s_threadScratchCapacity);
+
+        return *scratchAllocator;
+    }
+
+    ScratchScope::ScratchScope()
+        : m_allocator{getThreadScratchAllocator()}, m_marker{m_allocator.getUsed()} {}
+
+    ScratchScope::~ScratchScope() {
+        m_allocator.rewind(m_marker);
+    }
+}
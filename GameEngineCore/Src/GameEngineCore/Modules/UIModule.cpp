@@ -1,4 +1,5 @@
 #include "GameEngineCore/Modules/UIModule.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
 
 #include <imgui/imgui.h>
 #include <imgui/backends/imgui_impl_opengl3.h>
@@ -26,12 +27,16 @@ namespace GameEngine {
     }
 
     void UIModule::onUIDrawBegin() {
+        PROFILE_SCOPE("UIModule::onUIDrawBegin");
+
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
     }
 
     void UIModule::onUIDrawEnd() {
+        PROFILE_SCOPE("UIModule::onUIDrawEnd");
+
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
@@ -0,0 +1,300 @@
+#include "GameEngineCore/Profiling/Profiler.hpp"
+#include "GameEngineCore/Log.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+namespace GameEngine {
+    namespace {
+        struct TreeNode {
+            ProfileNode node;
+            int32_t firstChild = -1;
+            int32_t lastChild = -1;
+            int32_t nextSibling = -1;
+        };
+
+        std::mutex s_threadsMutex;
+        std::vector<std::unique_ptr<Profiler::ThreadBuffer>> s_threadBuffers;
+
+        std::vector<ProfileRecord> s_frameRecords;
+        std::vector<TreeNode> s_tree;
+        std::vector<int32_t> s_treeStack;
+        std::vector<ProfileNode> s_frameNodes;
+
+        std::vector<ProfileRecord> s_captureRecords;
+        bool s_isCapturing = false;
+        uint64_t s_captureStart = 0;
+
+        std::chrono::steady_clock::time_point s_calibrationTime;
+        uint64_t s_calibrationTicks = 0;
+        double s_nanosecondsPerTick = 1.0;
+
+        void calibrate() {
+#if defined(GAME_ENGINE_PROFILER_RDTSC)
+            const auto now = std::chrono::steady_clock::now();
+            const uint64_t ticks = Profiler::getTimestamp();
+            const double elapsedNanoseconds =
+                std::chrono::duration<double, std::nano>(now - s_calibrationTime).count();
+
+            if (ticks > s_calibrationTicks && elapsedNanoseconds > 0.0) {
+                s_nanosecondsPerTick = elapsedNanoseconds / static_cast<double>(ticks - s_calibrationTicks);
+            }
+#endif
+        }
+
+        int32_t findOrAddChild(const int32_t parent, const ProfileRecord &record) {
+            int32_t child = parent >= 0 ? s_tree[parent].firstChild : -1;
+
+            while (child >= 0) {
+                const TreeNode &current = s_tree[child];
+
+                if (current.node.name == record.name && current.node.threadIndex == record.threadIndex) {
+                    return child;
+                }
+
+                child = current.nextSibling;
+            }
+
+            TreeNode node;
+            node.node.name = record.name;
+            node.node.depth = record.depth;
+            node.node.threadIndex = record.threadIndex;
+
+            const int32_t index = static_cast<int32_t>(s_tree.size());
+            s_tree.push_back(node);
+
+            if (parent >= 0) {
+                if (s_tree[parent].lastChild >= 0) {
+                    s_tree[s_tree[parent].lastChild].nextSibling = index;
+                } else {
+                    s_tree[parent].firstChild = index;
+                }
+
+                s_tree[parent].lastChild = index;
+            }
+
+            return index;
+        }
+
+        void flattenTree(const int32_t index, const uint32_t depth) {
+            for (int32_t child = index; child >= 0; child = s_tree[child].nextSibling) {
+                ProfileNode node = s_tree[child].node;
+                node.depth = depth;
+                s_frameNodes.push_back(node);
+
+                flattenTree(s_tree[child].firstChild, depth + 1);
+            }
+        }
+
+        void buildFrameNodes() {
+            std::sort(s_frameRecords.begin(), s_frameRecords.end(),
+                [](const ProfileRecord &left, const ProfileRecord &right) {
+                    if (left.threadIndex != right.threadIndex) {
+                        return left.threadIndex < right.threadIndex;
+                    }
+
+                    return left.begin != right.begin ? left.begin < right.begin : left.depth < right.depth;
+                });
+
+            s_tree.clear();
+            s_frameNodes.clear();
+
+            TreeNode root;
+            s_tree.push_back(root);
+
+            uint32_t currentThread = UINT32_MAX;
+            int32_t threadRoot = -1;
+
+            for (const ProfileRecord &record : s_frameRecords) {
+                if (record.threadIndex != currentThread) {
+                    ProfileRecord threadRecord;
+                    threadRecord.threadIndex = record.threadIndex;
+
+                    currentThread = record.threadIndex;
+                    threadRoot = findOrAddChild(0, threadRecord);
+                    s_treeStack.clear();
+                }
+
+                const size_t depth = std::min<size_t>(record.depth, s_treeStack.size());
+                s_treeStack.resize(depth);
+
+                const int32_t parent = s_treeStack.empty() ? threadRoot : s_treeStack.back();
+                const int32_t index = findOrAddChild(parent, record);
+
+                s_tree[index].node.totalMilliseconds += Profiler::toMilliseconds(record.end - record.begin);
+                ++s_tree[index].node.callsCount;
+
+                s_treeStack.push_back(index);
+            }
+
+            for (int32_t thread = s_tree[0].firstChild; thread >= 0; thread = s_tree[thread].nextSibling) {
+                flattenTree(s_tree[thread].firstChild, 0);
+            }
+        }
+
+        void writeEscaped(std::ofstream &stream, const char *text) {
+            for (const char *character = text; *character != '\0'; ++character) {
+                if (*character == '"' || *character == '\\') {
+                    stream << '\\';
+                }
+
+                stream << *character;
+            }
+        }
+    }
+
+    void Profiler::init() {
+        s_calibrationTime = std::chrono::steady_clock::now();
+        s_calibrationTicks = getTimestamp();
+
+#if defined(GAME_ENGINE_PROFILER_RDTSC)
+        while (std::chrono::steady_clock::now() - s_calibrationTime < std::chrono::milliseconds(2)) {
+        }
+
+        calibrate();
+#endif
+
+        setThreadName("Main");
+    }
+
+    void Profiler::shutdown() {
+        s_isCapturing = false;
+        s_captureRecords.clear();
+        s_frameRecords.clear();
+        s_frameNodes.clear();
+        s_tree.clear();
+    }
+
+    Profiler::ThreadBuffer *Profiler::registerThread() {
+        std::lock_guard<std::mutex> lock(s_threadsMutex);
+
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->threadIndex = static_cast<uint32_t>(s_threadBuffers.size());
+        buffer->name = "Thread " + std::to_string(buffer->threadIndex);
+
+        s_threadBuffers.push_back(std::move(buffer));
+
+        return s_threadBuffers.back().get();
+    }
+
+    void Profiler::setThreadName(const char *name) {
+        if (s_threadBuffer == nullptr) {
+            s_threadBuffer = registerThread();
+        }
+
+        std::lock_guard<std::mutex> lock(s_threadsMutex);
+        s_threadBuffer->name = name;
+    }
+
+    void Profiler::endFrame() {
+        calibrate();
+
+        s_frameRecords.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(s_threadsMutex);
+
+            for (const std::unique_ptr<ThreadBuffer> &buffer : s_threadBuffers) {
+                ProfileRecord record;
+
+                while (buffer->records.tryPop(record)) {
+                    s_frameRecords.push_back(record);
+                }
+            }
+        }
+
+        if (s_isCapturing) {
+            s_captureRecords.insert(s_captureRecords.end(), s_frameRecords.begin(), s_frameRecords.end());
+        }
+
+        buildFrameNodes();
+    }
+
+    const std::vector<ProfileNode> &Profiler::getFrameNodes() {
+        return s_frameNodes;
+    }
+
+    size_t Profiler::getDroppedRecordsCount() {
+        std::lock_guard<std::mutex> lock(s_threadsMutex);
+
+        size_t droppedCount = 0;
+
+        for (const std::unique_ptr<ThreadBuffer> &buffer : s_threadBuffers) {
+            droppedCount += buffer->droppedCount.load(std::memory_order_relaxed);
+        }
+
+        return droppedCount;
+    }
+
+    void Profiler::startCapture() {
+        s_captureRecords.clear();
+        s_captureStart = getTimestamp();
+        s_isCapturing = true;
+    }
+
+    bool Profiler::stopCapture(const std::string &path) {
+        if (!s_isCapturing) {
+            return false;
+        }
+
+        s_isCapturing = false;
+
+        std::ofstream stream(path);
+
+        if (!stream) {
+            LOG_ERROR("Profiler: can't open {0} for writing", path);
+
+            return false;
+        }
+
+        stream << std::fixed << std::setprecision(3) << "{\"traceEvents\":[\n";
+
+        bool isFirstEvent = true;
+
+        {
+            std::lock_guard<std::mutex> lock(s_threadsMutex);
+
+            for (const std::unique_ptr<ThreadBuffer> &buffer : s_threadBuffers) {
+                stream << (isFirstEvent ? "" : ",\n")
+                       << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadIndex
+                       << ",\"args\":{\"name\":\"";
+                writeEscaped(stream, buffer->name.c_str());
+                stream << "\"}}";
+
+                isFirstEvent = false;
+            }
+        }
+
+        for (const ProfileRecord &record : s_captureRecords) {
+            if (record.begin < s_captureStart) {
+                continue;
+            }
+
+            stream << (isFirstEvent ? "" : ",\n") << "{\"name\":\"";
+            writeEscaped(stream, record.name);
+            stream << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << record.threadIndex
+                   << ",\"ts\":" << toMilliseconds(record.begin - s_captureStart) * 1000.0
+                   << ",\"dur\":" << toMilliseconds(record.end - record.begin) * 1000.0 << "}";
+
+            isFirstEvent = false;
+        }
+
+        stream << "\n]}\n";
+
+        LOG_INFO("Profiler: wrote {0} events to {1}", s_captureRecords.size(), path);
+        s_captureRecords.clear();
+
+        return static_cast<bool>(stream);
+    }
+
+    bool Profiler::isCapturing() {
+        return s_isCapturing;
+    }
+
+    double Profiler::toMilliseconds(const uint64_t ticks) {
+        return static_cast<double>(ticks) * s_nanosecondsPerTick / 1.0e6;
+    }
+}
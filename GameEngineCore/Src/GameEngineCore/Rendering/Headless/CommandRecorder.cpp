@@ -0,0 +1,123 @@
+#include "GameEngineCore/Rendering/Headless/CommandRecorder.hpp"
+
+#include <fstream>
+
+namespace GameEngine {
+    namespace {
+        const char *s_commandNames[] {
+            "CreateBuffer",
+            "DeleteBuffer",
+            "BufferData",
+            "BufferStorage",
+            "BufferSubData",
+            "MapBuffer",
+            "UnmapBuffer",
+            "BindBuffer",
+            "BindBufferRange",
+            "CreateTexture",
+            "DeleteTexture",
+            "TextureStorage",
+            "TextureSubImage",
+            "CompressedTextureSubImage",
+            "TextureParameter",
+            "GenerateMipmap",
+            "CopyImageSubData",
+            "PixelStore",
+            "BindTextureUnit",
+            "CreateVertexArray",
+            "DeleteVertexArray",
+            "VertexArrayVertexBuffer",
+            "VertexArrayElementBuffer",
+            "VertexArrayAttribFormat",
+            "VertexArrayAttribBinding",
+            "VertexArrayBindingDivisor",
+            "EnableVertexArrayAttrib",
+            "BindVertexArray",
+            "CreateShader",
+            "DeleteShader",
+            "CreateProgram",
+            "LinkProgram",
+            "DeleteProgram",
+            "UseProgram",
+            "UniformBlockBinding",
+            "SetUniform",
+            "Enable",
+            "Disable",
+            "BlendFunc",
+            "ClearColor",
+            "Clear",
+            "Viewport",
+            "DrawElements",
+            "DrawElementsInstanced",
+            "MultiDrawElementsIndirect",
+            "FenceSync",
+            "ClientWaitSync",
+            "DeleteSync",
+            "QueryCounter",
+            "Present"
+        };
+
+        static_assert(sizeof(s_commandNames) / sizeof(s_commandNames[0]) ==
+                      static_cast<size_t>(RecordedCommand::CommandsCount));
+    }
+
+    void CommandRecorder::clear() {
+        m_calls.clear();
+        m_callsCounts.fill(0);
+    }
+
+    void CommandRecorder::record(const RecordedCommand command,
+                                 std::initializer_list<uint32_t> arguments) {
+        RecordedCall call;
+        call.command = command;
+
+        for (const uint32_t argument : arguments) {
+            if (call.argumentsCount == RecordedCall::s_maxArguments) {
+                break;
+            }
+
+            call.arguments[call.argumentsCount++] = argument;
+        }
+
+        m_calls.push_back(call);
+        ++m_callsCounts[static_cast<size_t>(command)];
+    }
+
+    void CommandRecorder::write(std::ostream &stream) const {
+        for (const RecordedCall &call : m_calls) {
+            stream << getCommandName(call.command);
+
+            for (uint8_t i = 0; i < call.argumentsCount; ++i) {
+                stream << ' ' << call.arguments[i];
+            }
+
+            stream << '\n';
+        }
+    }
+
+    void CommandRecorder::writeSummary(std::ostream &stream) const {
+        for (size_t i = 0; i < s_commandsCount; ++i) {
+            if (m_callsCounts[i] != 0) {
+                stream << s_commandNames[i] << ": " << m_callsCounts[i] << '\n';
+            }
+        }
+    }
+
+    bool CommandRecorder::saveToFile(const std::string &path) const {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+
+        if (!file.is_open()) {
+            return false;
+        }
+
+        write(file);
+
+        return file.good();
+    }
+
+    const char *CommandRecorder::getCommandName(const RecordedCommand command) {
+        const size_t index = static_cast<size_t>(command);
+
+        return index < s_commandsCount ? s_commandNames[index] : "Unknown";
+    }
+}
@@ -0,0 +1,578 @@
+#include "GameEngineCore/Rendering/Headless/HeadlessContext.hpp"
+
+#include "glad/glad.h"
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace GameEngine {
+    namespace {
+        RenderBackend s_backend = RenderBackend::OpenGL;
+        uint64_t s_presentedFramesCount = 0;
+        CommandRecorder s_recorder;
+
+        GLuint s_nextObjectId = 1;
+        uintptr_t s_nextSyncId = 1;
+        std::unordered_map<GLuint, std::vector<unsigned char>> s_mappedBuffers;
+
+        void record(const RecordedCommand command, std::initializer_list<uint32_t> arguments = {}) {
+            if (s_backend == RenderBackend::Recording) {
+                s_recorder.record(command, arguments);
+            }
+        }
+
+        uint32_t toArgument(const GLintptr value) {
+            return static_cast<uint32_t>(value);
+        }
+
+        uint32_t toArgument(const GLfloat value) {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            return bits;
+        }
+
+        uint32_t toArgument(const GLsync sync) {
+            return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(sync));
+        }
+
+        void createObjects(const RecordedCommand command, const GLsizei count, GLuint *ids) {
+            for (GLsizei i = 0; i < count; ++i) {
+                ids[i] = s_nextObjectId++;
+                record(command, { ids[i] });
+            }
+        }
+
+        void deleteObjects(const RecordedCommand command, const GLsizei count, const GLuint *ids) {
+            for (GLsizei i = 0; i < count; ++i) {
+                if (ids[i] != 0) {
+                    record(command, { ids[i] });
+                }
+            }
+        }
+
+        const GLubyte *APIENTRY headlessGetString(GLenum name) {
+            const char *value = "";
+
+            switch (name) {
+                case GL_VENDOR: value = "GameEngine"; break;
+                case GL_RENDERER:
+                    value = s_backend == RenderBackend::Recording ? "Headless Recording" : "Headless Null";
+                    break;
+                case GL_VERSION: value = "4.6.0 Headless"; break;
+                case GL_SHADING_LANGUAGE_VERSION: value = "4.60"; break;
+            }
+
+            return reinterpret_cast<const GLubyte*>(value);
+        }
+
+        void APIENTRY headlessGetIntegerv(GLenum name, GLint *data) {
+            switch (name) {
+                case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT: *data = 256; break;
+                case GL_MAJOR_VERSION: *data = 4; break;
+                case GL_MINOR_VERSION: *data = 6; break;
+                default: *data = 0; break;
+            }
+        }
+
+        void APIENTRY headlessCreateBuffers(GLsizei count, GLuint *ids) {
+            createObjects(RecordedCommand::CreateBuffer, count, ids);
+        }
+
+        void APIENTRY headlessDeleteBuffers(GLsizei count, const GLuint *ids) {
+            for (GLsizei i = 0; i < count; ++i) {
+                s_mappedBuffers.erase(ids[i]);
+            }
+
+            deleteObjects(RecordedCommand::DeleteBuffer, count, ids);
+        }
+
+        void APIENTRY headlessNamedBufferData(GLuint buffer, GLsizeiptr size, const void*, GLenum usage) {
+            record(RecordedCommand::BufferData, { buffer, toArgument(size), usage });
+        }
+
+        void APIENTRY headlessNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void*, GLbitfield flags) {
+            record(RecordedCommand::BufferStorage, { buffer, toArgument(size), flags });
+        }
+
+        void APIENTRY headlessNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void*) {
+            record(RecordedCommand::BufferSubData, { buffer, toArgument(offset), toArgument(size) });
+        }
+
+        void *APIENTRY headlessMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length,
+                                                   GLbitfield access) {
+            record(RecordedCommand::MapBuffer, { buffer, toArgument(offset), toArgument(length), access });
+
+            std::vector<unsigned char> &storage = s_mappedBuffers[buffer];
+
+            if (storage.size() < static_cast<size_t>(offset + length)) {
+                storage.resize(static_cast<size_t>(offset + length));
+            }
+
+            return storage.data() + offset;
+        }
+
+        GLboolean APIENTRY headlessUnmapNamedBuffer(GLuint buffer) {
+            record(RecordedCommand::UnmapBuffer, { buffer });
+
+            return GL_TRUE;
+        }
+
+        void APIENTRY headlessBindBuffer(GLenum target, GLuint buffer) {
+            record(RecordedCommand::BindBuffer, { target, buffer });
+        }
+
+        void APIENTRY headlessBindBufferRange(GLenum target, GLuint index, GLuint buffer,
+                                              GLintptr offset, GLsizeiptr size) {
+            record(RecordedCommand::BindBufferRange,
+                   { target, index, buffer, toArgument(offset), toArgument(size) });
+        }
+
+        void APIENTRY headlessCreateTextures(GLenum, GLsizei count, GLuint *ids) {
+            createObjects(RecordedCommand::CreateTexture, count, ids);
+        }
+
+        void APIENTRY headlessDeleteTextures(GLsizei count, const GLuint *ids) {
+            deleteObjects(RecordedCommand::DeleteTexture, count, ids);
+        }
+
+        void APIENTRY headlessTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalFormat,
+                                               GLsizei width, GLsizei height) {
+            record(RecordedCommand::TextureStorage,
+                   { texture, static_cast<uint32_t>(levels), internalFormat,
+                     static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+        }
+
+        void APIENTRY headlessTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalFormat,
+                                               GLsizei width, GLsizei height, GLsizei) {
+            record(RecordedCommand::TextureStorage,
+                   { texture, static_cast<uint32_t>(levels), internalFormat,
+                     static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+        }
+
+        void APIENTRY headlessTextureSubImage2D(GLuint texture, GLint level, GLint, GLint,
+                                                GLsizei width, GLsizei height, GLenum format,
+                                                GLenum, const void*) {
+            record(RecordedCommand::TextureSubImage,
+                   { texture, static_cast<uint32_t>(level), static_cast<uint32_t>(width),
+                     static_cast<uint32_t>(height), format });
+        }
+
+        void APIENTRY headlessTextureSubImage3D(GLuint texture, GLint level, GLint, GLint, GLint,
+                                                GLsizei width, GLsizei height, GLsizei, GLenum format,
+                                                GLenum, const void*) {
+            record(RecordedCommand::TextureSubImage,
+                   { texture, static_cast<uint32_t>(level), static_cast<uint32_t>(width),
+                     static_cast<uint32_t>(height), format });
+        }
+
+        void APIENTRY headlessCompressedTextureSubImage2D(GLuint texture, GLint level, GLint, GLint,
+                                                          GLsizei width, GLsizei height, GLenum,
+                                                          GLsizei size, const void*) {
+            record(RecordedCommand::CompressedTextureSubImage,
+                   { texture, static_cast<uint32_t>(level), static_cast<uint32_t>(width),
+                     static_cast<uint32_t>(height), static_cast<uint32_t>(size) });
+        }
+
+        void APIENTRY headlessTextureParameteri(GLuint texture, GLenum name, GLint value) {
+            record(RecordedCommand::TextureParameter, { texture, name, static_cast<uint32_t>(value) });
+        }
+
+        void APIENTRY headlessGenerateTextureMipmap(GLuint texture) {
+            record(RecordedCommand::GenerateMipmap, { texture });
+        }
+
+        void APIENTRY headlessCopyImageSubData(GLuint sourceName, GLenum, GLint sourceLevel, GLint, GLint, GLint,
+                                               GLuint destinationName, GLenum, GLint destinationLevel,
+                                               GLint, GLint, GLint, GLsizei width, GLsizei, GLsizei) {
+            record(RecordedCommand::CopyImageSubData,
+                   { sourceName, static_cast<uint32_t>(sourceLevel), destinationName,
+                     static_cast<uint32_t>(destinationLevel), static_cast<uint32_t>(width) });
+        }
+
+        void APIENTRY headlessPixelStorei(GLenum name, GLint value) {
+            record(RecordedCommand::PixelStore, { name, static_cast<uint32_t>(value) });
+        }
+
+        void APIENTRY headlessBindTextureUnit(GLuint unit, GLuint texture) {
+            record(RecordedCommand::BindTextureUnit, { unit, texture });
+        }
+
+        void APIENTRY headlessCreateVertexArrays(GLsizei count, GLuint *ids) {
+            createObjects(RecordedCommand::CreateVertexArray, count, ids);
+        }
+
+        void APIENTRY headlessDeleteVertexArrays(GLsizei count, const GLuint *ids) {
+            deleteObjects(RecordedCommand::DeleteVertexArray, count, ids);
+        }
+
+        void APIENTRY headlessVertexArrayVertexBuffer(GLuint vertexArray, GLuint bindingIndex,
+                                                      GLuint buffer, GLintptr offset, GLsizei stride) {
+            record(RecordedCommand::VertexArrayVertexBuffer,
+                   { vertexArray, bindingIndex, buffer, toArgument(offset), static_cast<uint32_t>(stride) });
+        }
+
+        void APIENTRY headlessVertexArrayElementBuffer(GLuint vertexArray, GLuint buffer) {
+            record(RecordedCommand::VertexArrayElementBuffer, { vertexArray, buffer });
+        }
+
+        void APIENTRY headlessVertexArrayAttribFormat(GLuint vertexArray, GLuint attribIndex, GLint size,
+                                                      GLenum type, GLboolean, GLuint relativeOffset) {
+            record(RecordedCommand::VertexArrayAttribFormat,
+                   { vertexArray, attribIndex, static_cast<uint32_t>(size), type, relativeOffset });
+        }
+
+        void APIENTRY headlessVertexArrayAttribBinding(GLuint vertexArray, GLuint attribIndex,
+                                                       GLuint bindingIndex) {
+            record(RecordedCommand::VertexArrayAttribBinding, { vertexArray, attribIndex, bindingIndex });
+        }
+
+        void APIENTRY headlessVertexArrayBindingDivisor(GLuint vertexArray, GLuint bindingIndex,
+                                                        GLuint divisor) {
+            record(RecordedCommand::VertexArrayBindingDivisor, { vertexArray, bindingIndex, divisor });
+        }
+
+        void APIENTRY headlessEnableVertexArrayAttrib(GLuint vertexArray, GLuint index) {
+            record(RecordedCommand::EnableVertexArrayAttrib, { vertexArray, index });
+        }
+
+        void APIENTRY headlessBindVertexArray(GLuint vertexArray) {
+            record(RecordedCommand::BindVertexArray, { vertexArray });
+        }
+
+        GLuint APIENTRY headlessCreateShader(GLenum type) {
+            const GLuint id = s_nextObjectId++;
+            record(RecordedCommand::CreateShader, { id, type });
+
+            return id;
+        }
+
+        void APIENTRY headlessDeleteShader(GLuint shader) {
+            if (shader != 0) {
+                record(RecordedCommand::DeleteShader, { shader });
+            }
+        }
+
+        void APIENTRY headlessShaderSource(GLuint, GLsizei, const GLchar *const*, const GLint*) {}
+        void APIENTRY headlessCompileShader(GLuint) {}
+        void APIENTRY headlessAttachShader(GLuint, GLuint) {}
+        void APIENTRY headlessDetachShader(GLuint, GLuint) {}
+
+        void APIENTRY headlessGetShaderiv(GLuint, GLenum name, GLint *value) {
+            *value = name == GL_COMPILE_STATUS ? GL_TRUE : 0;
+        }
+
+        void APIENTRY headlessGetInfoLog(GLuint, GLsizei size, GLsizei *length, GLchar *log) {
+            if (length != nullptr) {
+                *length = 0;
+            }
+
+            if (size > 0) {
+                log[0] = '\0';
+            }
+        }
+
+        GLuint APIENTRY headlessCreateProgram() {
+            const GLuint id = s_nextObjectId++;
+            record(RecordedCommand::CreateProgram, { id });
+
+            return id;
+        }
+
+        void APIENTRY headlessLinkProgram(GLuint program) {
+            record(RecordedCommand::LinkProgram, { program });
+        }
+
+        void APIENTRY headlessDeleteProgram(GLuint program) {
+            if (program != 0) {
+                record(RecordedCommand::DeleteProgram, { program });
+            }
+        }
+
+        void APIENTRY headlessUseProgram(GLuint program) {
+            record(RecordedCommand::UseProgram, { program });
+        }
+
+        void APIENTRY headlessGetProgramiv(GLuint, GLenum name, GLint *value) {
+            *value = name == GL_LINK_STATUS ? GL_TRUE : 0;
+        }
+
+        void APIENTRY headlessGetActiveUniform(GLuint, GLuint, GLsizei size, GLsizei *length,
+                                               GLint *uniformSize, GLenum *type, GLchar *name) {
+            headlessGetInfoLog(0, size, length, name);
+            *uniformSize = 0;
+            *type = GL_FLOAT;
+        }
+
+        void APIENTRY headlessGetActiveUniformName(GLuint, GLuint, GLsizei size, GLsizei *length,
+                                                   GLchar *name) {
+            headlessGetInfoLog(0, size, length, name);
+        }
+
+        void APIENTRY headlessGetActiveUniformBlockName(GLuint, GLuint, GLsizei size, GLsizei *length,
+                                                        GLchar *name) {
+            headlessGetInfoLog(0, size, length, name);
+        }
+
+        void APIENTRY headlessGetActiveUniformBlockiv(GLuint, GLuint, GLenum, GLint *value) {
+            *value = 0;
+        }
+
+        void APIENTRY headlessGetActiveUniformsiv(GLuint, GLsizei count, const GLuint*, GLenum,
+                                                  GLint *values) {
+            for (GLsizei i = 0; i < count; ++i) {
+                values[i] = 0;
+            }
+        }
+
+        GLint APIENTRY headlessGetUniformLocation(GLuint, const GLchar*) {
+            return -1;
+        }
+
+        void APIENTRY headlessUniformBlockBinding(GLuint program, GLuint blockIndex, GLuint binding) {
+            record(RecordedCommand::UniformBlockBinding, { program, blockIndex, binding });
+        }
+
+        void recordUniform(const GLuint program, const GLint location, const GLsizei count) {
+            record(RecordedCommand::SetUniform,
+                   { program, static_cast<uint32_t>(location), static_cast<uint32_t>(count) });
+        }
+
+        void APIENTRY headlessProgramUniform1f(GLuint program, GLint location, GLfloat) {
+            recordUniform(program, location, 1);
+        }
+
+        void APIENTRY headlessProgramUniform1i(GLuint program, GLint location, GLint) {
+            recordUniform(program, location, 1);
+        }
+
+        void APIENTRY headlessProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint*) {
+            recordUniform(program, location, count);
+        }
+
+        void APIENTRY headlessProgramUniformfv(GLuint program, GLint location, GLsizei count, const GLfloat*) {
+            recordUniform(program, location, count);
+        }
+
+        void APIENTRY headlessProgramUniformMatrixfv(GLuint program, GLint location, GLsizei count,
+                                                     GLboolean, const GLfloat*) {
+            recordUniform(program, location, count);
+        }
+
+        void APIENTRY headlessEnable(GLenum capability) {
+            record(RecordedCommand::Enable, { capability });
+        }
+
+        void APIENTRY headlessDisable(GLenum capability) {
+            record(RecordedCommand::Disable, { capability });
+        }
+
+        void APIENTRY headlessBlendFunc(GLenum source, GLenum destination) {
+            record(RecordedCommand::BlendFunc, { source, destination });
+        }
+
+        void APIENTRY headlessClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+            record(RecordedCommand::ClearColor,
+                   { toArgument(red), toArgument(green), toArgument(blue), toArgument(alpha) });
+        }
+
+        void APIENTRY headlessClear(GLbitfield mask) {
+            record(RecordedCommand::Clear, { mask });
+        }
+
+        void APIENTRY headlessViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+            record(RecordedCommand::Viewport,
+                   { static_cast<uint32_t>(x), static_cast<uint32_t>(y),
+                     static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+        }
+
+        void APIENTRY headlessDrawElements(GLenum mode, GLsizei count, GLenum type, const void*) {
+            record(RecordedCommand::DrawElements, { mode, static_cast<uint32_t>(count), type });
+        }
+
+        void APIENTRY headlessDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type,
+                                                                const void*, GLsizei instancesCount,
+                                                                GLuint baseInstance) {
+            record(RecordedCommand::DrawElementsInstanced,
+                   { mode, static_cast<uint32_t>(count), type,
+                     static_cast<uint32_t>(instancesCount), baseInstance });
+        }
+
+        void APIENTRY headlessMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect,
+                                                        GLsizei drawCount, GLsizei stride) {
+            record(RecordedCommand::MultiDrawElementsIndirect,
+                   { mode, type, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(indirect)),
+                     static_cast<uint32_t>(drawCount), static_cast<uint32_t>(stride) });
+        }
+
+        GLsync APIENTRY headlessFenceSync(GLenum, GLbitfield) {
+            const GLsync sync = reinterpret_cast<GLsync>(s_nextSyncId++);
+            record(RecordedCommand::FenceSync, { toArgument(sync) });
+
+            return sync;
+        }
+
+        GLenum APIENTRY headlessClientWaitSync(GLsync sync, GLbitfield, GLuint64) {
+            record(RecordedCommand::ClientWaitSync, { toArgument(sync) });
+
+            return GL_ALREADY_SIGNALED;
+        }
+
+        void APIENTRY headlessDeleteSync(GLsync sync) {
+            if (sync != nullptr) {
+                record(RecordedCommand::DeleteSync, { toArgument(sync) });
+            }
+        }
+
+        void APIENTRY headlessCreateQueries(GLenum, GLsizei count, GLuint *ids) {
+            for (GLsizei i = 0; i < count; ++i) {
+                ids[i] = s_nextObjectId++;
+            }
+        }
+
+        void APIENTRY headlessDeleteQueries(GLsizei, const GLuint*) {}
+
+        void APIENTRY headlessQueryCounter(GLuint id, GLenum) {
+            record(RecordedCommand::QueryCounter, { id });
+        }
+
+        void APIENTRY headlessGetQueryObjectiv(GLuint, GLenum name, GLint *value) {
+            *value = name == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+        }
+
+        void APIENTRY headlessGetQueryObjectui64v(GLuint, GLenum, GLuint64 *value) {
+            *value = 0;
+        }
+
+        void loadFunctions() {
+            glGetString = headlessGetString;
+            glGetIntegerv = headlessGetIntegerv;
+
+            glCreateBuffers = headlessCreateBuffers;
+            glDeleteBuffers = headlessDeleteBuffers;
+            glNamedBufferData = headlessNamedBufferData;
+            glNamedBufferStorage = headlessNamedBufferStorage;
+            glNamedBufferSubData = headlessNamedBufferSubData;
+            glMapNamedBufferRange = headlessMapNamedBufferRange;
+            glUnmapNamedBuffer = headlessUnmapNamedBuffer;
+            glBindBuffer = headlessBindBuffer;
+            glBindBufferRange = headlessBindBufferRange;
+
+            glCreateTextures = headlessCreateTextures;
+            glDeleteTextures = headlessDeleteTextures;
+            glTextureStorage2D = headlessTextureStorage2D;
+            glTextureStorage3D = headlessTextureStorage3D;
+            glTextureSubImage2D = headlessTextureSubImage2D;
+            glTextureSubImage3D = headlessTextureSubImage3D;
+            glCompressedTextureSubImage2D = headlessCompressedTextureSubImage2D;
+            glTextureParameteri = headlessTextureParameteri;
+            glGenerateTextureMipmap = headlessGenerateTextureMipmap;
+            glCopyImageSubData = headlessCopyImageSubData;
+            glPixelStorei = headlessPixelStorei;
+            glBindTextureUnit = headlessBindTextureUnit;
+
+            glCreateVertexArrays = headlessCreateVertexArrays;
+            glDeleteVertexArrays = headlessDeleteVertexArrays;
+            glVertexArrayVertexBuffer = headlessVertexArrayVertexBuffer;
+            glVertexArrayElementBuffer = headlessVertexArrayElementBuffer;
+            glVertexArrayAttribFormat = headlessVertexArrayAttribFormat;
+            glVertexArrayAttribBinding = headlessVertexArrayAttribBinding;
+            glVertexArrayBindingDivisor = headlessVertexArrayBindingDivisor;
+            glEnableVertexArrayAttrib = headlessEnableVertexArrayAttrib;
+            glBindVertexArray = headlessBindVertexArray;
+
+            glCreateShader = headlessCreateShader;
+            glDeleteShader = headlessDeleteShader;
+            glShaderSource = headlessShaderSource;
+            glCompileShader = headlessCompileShader;
+            glGetShaderiv = headlessGetShaderiv;
+            glGetShaderInfoLog = headlessGetInfoLog;
+            glAttachShader = headlessAttachShader;
+            glDetachShader = headlessDetachShader;
+            glCreateProgram = headlessCreateProgram;
+            glLinkProgram = headlessLinkProgram;
+            glDeleteProgram = headlessDeleteProgram;
+            glUseProgram = headlessUseProgram;
+            glGetProgramiv = headlessGetProgramiv;
+            glGetProgramInfoLog = headlessGetInfoLog;
+            glGetActiveUniform = headlessGetActiveUniform;
+            glGetActiveUniformName = headlessGetActiveUniformName;
+            glGetActiveUniformBlockName = headlessGetActiveUniformBlockName;
+            glGetActiveUniformBlockiv = headlessGetActiveUniformBlockiv;
+            glGetActiveUniformsiv = headlessGetActiveUniformsiv;
+            glGetUniformLocation = headlessGetUniformLocation;
+            glUniformBlockBinding = headlessUniformBlockBinding;
+            glProgramUniform1f = headlessProgramUniform1f;
+            glProgramUniform1i = headlessProgramUniform1i;
+            glProgramUniform1iv = headlessProgramUniform1iv;
+            glProgramUniform1fv = headlessProgramUniformfv;
+            glProgramUniform2fv = headlessProgramUniformfv;
+            glProgramUniform3fv = headlessProgramUniformfv;
+            glProgramUniform4fv = headlessProgramUniformfv;
+            glProgramUniformMatrix3fv = headlessProgramUniformMatrixfv;
+            glProgramUniformMatrix4fv = headlessProgramUniformMatrixfv;
+
+            glEnable = headlessEnable;
+            glBlendFunc = headlessBlendFunc;
+            glDisable = headlessDisable;
+            glClearColor = headlessClearColor;
+            glClear = headlessClear;
+            glViewport = headlessViewport;
+
+            glDrawElements = headlessDrawElements;
+            glDrawElementsInstancedBaseInstance = headlessDrawElementsInstancedBaseInstance;
+            glMultiDrawElementsIndirect = headlessMultiDrawElementsIndirect;
+
+            glFenceSync = headlessFenceSync;
+            glClientWaitSync = headlessClientWaitSync;
+            glDeleteSync = headlessDeleteSync;
+
+            glCreateQueries = headlessCreateQueries;
+            glDeleteQueries = headlessDeleteQueries;
+            glQueryCounter = headlessQueryCounter;
+            glGetQueryObjectiv = headlessGetQueryObjectiv;
+            glGetQueryObjectui64v = headlessGetQueryObjectui64v;
+        }
+    }
+
+    bool HeadlessContext::init(const RenderBackend backend) {
+        if (!isHeadless(backend)) {
+            return false;
+        }
+
+        s_backend = backend;
+        s_presentedFramesCount = 0;
+        s_nextObjectId = 1;
+        s_nextSyncId = 1;
+        s_mappedBuffers.clear();
+        s_recorder.clear();
+
+        loadFunctions();
+
+        return true;
+    }
+
+    void HeadlessContext::shutdown() {
+        s_mappedBuffers.clear();
+        s_backend = RenderBackend::OpenGL;
+    }
+
+    void HeadlessContext::present() {
+        record(RecordedCommand::Present, { static_cast<uint32_t>(s_presentedFramesCount) });
+        ++s_presentedFramesCount;
+    }
+
+    RenderBackend HeadlessContext::getBackend() {
+        return s_backend;
+    }
+
+    uint64_t HeadlessContext::getPresentedFramesCount() {
+        return s_presentedFramesCount;
+    }
+
+    const CommandRecorder &HeadlessContext::getRecorder() {
+        return s_recorder;
+    }
+}
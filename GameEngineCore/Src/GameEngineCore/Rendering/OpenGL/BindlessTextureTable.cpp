@@ -0,0 +1,156 @@
+#include "GameEngineCore/Rendering/OpenGL/BindlessTextureTable.hpp"
+#include "GameEngineCore/Rendering/OpenGL/Texture2D.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+#include "GameEngineCore/Rendering/UniformBlocks.hpp"
+
+#include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "glad/glad.h"
+
+namespace GameEngine {
+    namespace {
+        // glad is generated without extensions, so the ARB_bindless_texture entry points
+        // are resolved by hand.
+        using GetTextureHandleProc = GLuint64 (APIENTRYP)(GLuint texture);
+        using MakeTextureHandleResidentProc = void (APIENTRYP)(GLuint64 handle);
+        using MakeTextureHandleNonResidentProc = void (APIENTRYP)(GLuint64 handle);
+
+        GetTextureHandleProc s_getTextureHandle = nullptr;
+        MakeTextureHandleResidentProc s_makeTextureHandleResident = nullptr;
+        MakeTextureHandleNonResidentProc s_makeTextureHandleNonResident = nullptr;
+
+        bool hasExtension(const char *name) {
+            GLint extensionsCount = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &extensionsCount);
+
+            for (GLint i = 0; i < extensionsCount; ++i) {
+                const GLubyte *extension = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i));
+
+                if (extension != nullptr && std::strcmp(reinterpret_cast<const char*>(extension), name) == 0) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }
+
+    bool BindlessTextureTable::loadFunctions(GetProcAddress getProcAddress) {
+        s_getTextureHandle = nullptr;
+        s_makeTextureHandleResident = nullptr;
+        s_makeTextureHandleNonResident = nullptr;
+
+        if (getProcAddress == nullptr || !hasExtension("GL_ARB_bindless_texture")) {
+            LOG_INFO_TO(LogSubsystem::Rendering, "Bindless textures: not supported");
+
+            return false;
+        }
+
+        s_getTextureHandle = reinterpret_cast<GetTextureHandleProc>(getProcAddress("glGetTextureHandleARB"));
+        s_makeTextureHandleResident =
+            reinterpret_cast<MakeTextureHandleResidentProc>(getProcAddress("glMakeTextureHandleResidentARB"));
+        s_makeTextureHandleNonResident =
+            reinterpret_cast<MakeTextureHandleNonResidentProc>(getProcAddress("glMakeTextureHandleNonResidentARB"));
+
+        LOG_INFO_TO(LogSubsystem::Rendering, "Bindless textures: {}", isSupported() ? "supported" : "not supported");
+
+        return isSupported();
+    }
+
+    bool BindlessTextureTable::isSupported() {
+        return s_getTextureHandle != nullptr && s_makeTextureHandleResident != nullptr &&
+               s_makeTextureHandleNonResident != nullptr;
+    }
+
+    BindlessTextureTable::~BindlessTextureTable() {
+        for (size_t i = 0; i < m_handles.size(); ++i) {
+            releaseHandle(i);
+        }
+
+        if (m_bufferId != 0) {
+            RendererOpenGL::onBufferReleased(m_bufferSize);
+            StateCacheOpenGL::onBufferDeleted(m_bufferId);
+            glDeleteBuffers(1, &m_bufferId);
+        }
+    }
+
+    uint32_t BindlessTextureTable::add(const Texture2D &texture) {
+        if (!isSupported()) {
+            return s_invalidIndex;
+        }
+
+        m_entries.push_back({ &texture, 0 });
+        m_handles.push_back(0);
+        m_isDirty = true;
+
+        return static_cast<uint32_t>(m_entries.size() - 1);
+    }
+
+    void BindlessTextureTable::releaseHandle(const size_t index) {
+        if (m_handles[index] != 0 && s_makeTextureHandleNonResident != nullptr) {
+            s_makeTextureHandleNonResident(m_handles[index]);
+        }
+
+        m_handles[index] = 0;
+        m_entries[index].textureId = 0;
+    }
+
+    void BindlessTextureTable::update() {
+        PROFILE_SCOPE("BindlessTextureTable::update");
+
+        // A handle is tied to the GL object, so textures that TextureStreamer reallocated
+        // need a new one; non-resident textures map to handle 0.
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            const unsigned int textureId = m_entries[i].texture->getId();
+
+            if (textureId == m_entries[i].textureId) {
+                continue;
+            }
+
+            releaseHandle(i);
+
+            if (textureId != 0) {
+                m_handles[i] = s_getTextureHandle(textureId);
+                s_makeTextureHandleResident(m_handles[i]);
+                m_entries[i].textureId = textureId;
+            }
+
+            m_isDirty = true;
+        }
+
+        if (!m_isDirty) {
+            return;
+        }
+
+        const size_t size = sizeof(uint64_t) * m_handles.size();
+
+        if (size > m_bufferSize) {
+            if (m_bufferId != 0) {
+                RendererOpenGL::onBufferReleased(m_bufferSize);
+                StateCacheOpenGL::onBufferDeleted(m_bufferId);
+                glDeleteBuffers(1, &m_bufferId);
+            }
+
+            m_bufferSize = std::max(size, m_bufferSize * 2);
+            glCreateBuffers(1, &m_bufferId);
+            glNamedBufferData(m_bufferId, static_cast<GLsizeiptr>(m_bufferSize), nullptr, GL_DYNAMIC_DRAW);
+            RendererOpenGL::onBufferAllocated(m_bufferSize);
+        }
+
+        glNamedBufferSubData(m_bufferId, 0, static_cast<GLsizeiptr>(size), m_handles.data());
+        m_isDirty = false;
+    }
+
+    void BindlessTextureTable::bind() const {
+        if (m_bufferId != 0) {
+            StateCacheOpenGL::bindBufferRange(GL_SHADER_STORAGE_BUFFER,
+                                              static_cast<unsigned int>(StorageBlockBinding::BindlessTextures),
+                                              m_bufferId, 0, m_bufferSize);
+        }
+    }
+}
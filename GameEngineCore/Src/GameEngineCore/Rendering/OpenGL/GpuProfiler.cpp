@@ -0,0 +1,144 @@
+#include "GameEngineCore/Rendering/OpenGL/GpuProfiler.hpp"
+
+namespace GameEngine {
+    namespace {
+        constexpr unsigned int s_glTimestamp = 0x8E28;
+        constexpr unsigned int s_glQueryResult = 0x8866;
+        constexpr unsigned int s_glQueryResultAvailable = 0x8867;
+    }
+
+    GpuProfiler *GpuProfiler::s_active = nullptr;
+
+    GpuProfiler::GpuProfiler(const GpuQueryFunctions &functions)
+        : m_functions{functions} {
+        m_queries.resize(s_framesInFlight * s_maxScopesPerFrame * 2);
+        m_functions.createQueries(s_glTimestamp, static_cast<int>(m_queries.size()), m_queries.data());
+    }
+
+    GpuProfiler::~GpuProfiler() {
+        m_functions.deleteQueries(static_cast<int>(m_queries.size()), m_queries.data());
+
+        if (s_active == this) {
+            s_active = nullptr;
+        }
+    }
+
+    void GpuProfiler::beginFrame() {
+        collectPendingFrames();
+
+        m_currentSlot = static_cast<size_t>(m_frameIndex % s_framesInFlight);
+        Frame &frame = m_frames[m_currentSlot];
+
+        if (frame.isPending) {
+            ++m_droppedFramesCount;
+        }
+
+        frame.scopesCount = 0;
+        frame.frameIndex = m_frameIndex;
+        frame.isPending = false;
+
+        m_isFrameOpen = true;
+        m_depth = 0;
+        m_frameScope = beginScope("Frame");
+    }
+
+    void GpuProfiler::endFrame() {
+        if (!m_isFrameOpen) {
+            return;
+        }
+
+        endScope(m_frameScope);
+
+        m_frames[m_currentSlot].isPending = true;
+        m_isFrameOpen = false;
+        ++m_frameIndex;
+    }
+
+    int32_t GpuProfiler::beginScope(const char *name) {
+        Frame &frame = m_frames[m_currentSlot];
+
+        if (!m_isFrameOpen || frame.scopesCount >= s_maxScopesPerFrame) {
+            ++m_droppedScopesCount;
+
+            return s_invalidScope;
+        }
+
+        const uint32_t index = frame.scopesCount++;
+
+        Scope &scope = frame.scopes[index];
+        scope.name = name;
+        scope.depth = m_depth++;
+        scope.isClosed = false;
+
+        m_functions.queryCounter(getBeginQuery(m_currentSlot, index), s_glTimestamp);
+
+        return static_cast<int32_t>(index);
+    }
+
+    void GpuProfiler::endScope(const int32_t scope) {
+        if (scope == s_invalidScope || !m_isFrameOpen) {
+            return;
+        }
+
+        --m_depth;
+
+        m_functions.queryCounter(getEndQuery(m_currentSlot, static_cast<size_t>(scope)), s_glTimestamp);
+        m_frames[m_currentSlot].scopes[scope].isClosed = true;
+    }
+
+    unsigned int GpuProfiler::getBeginQuery(const size_t frame, const size_t scope) const {
+        return m_queries[(frame * s_maxScopesPerFrame + scope) * 2];
+    }
+
+    unsigned int GpuProfiler::getEndQuery(const size_t frame, const size_t scope) const {
+        return m_queries[(frame * s_maxScopesPerFrame + scope) * 2 + 1];
+    }
+
+    bool GpuProfiler::collectFrame(Frame &frame, const size_t frameSlot) {
+        int available = 0;
+        m_functions.getQueryObjectiv(getEndQuery(frameSlot, 0), s_glQueryResultAvailable, &available);
+
+        if (available == 0) {
+            return false;
+        }
+
+        m_latestTimings.clear();
+
+        for (uint32_t i = 0; i < frame.scopesCount; ++i) {
+            const Scope &scope = frame.scopes[i];
+
+            if (!scope.isClosed) {
+                continue;
+            }
+
+            uint64_t begin = 0;
+            uint64_t end = 0;
+            m_functions.getQueryObjectui64v(getBeginQuery(frameSlot, i), s_glQueryResult, &begin);
+            m_functions.getQueryObjectui64v(getEndQuery(frameSlot, i), s_glQueryResult, &end);
+
+            Timing timing;
+            timing.name = scope.name;
+            timing.depth = scope.depth;
+            timing.milliseconds = end > begin ? static_cast<double>(end - begin) / 1.0e6 : 0.0;
+
+            m_latestTimings.push_back(timing);
+        }
+
+        m_latestFrameMilliseconds = m_latestTimings.empty() ? 0.0 : m_latestTimings.front().milliseconds;
+        m_latestFrameIndex = frame.frameIndex;
+        frame.isPending = false;
+
+        return true;
+    }
+
+    void GpuProfiler::collectPendingFrames() {
+        for (size_t i = 0; i < s_framesInFlight; ++i) {
+            const size_t slot = static_cast<size_t>((m_frameIndex + i) % s_framesInFlight);
+            Frame &frame = m_frames[slot];
+
+            if (frame.isPending && !collectFrame(frame, slot)) {
+                break;
+            }
+        }
+    }
+}
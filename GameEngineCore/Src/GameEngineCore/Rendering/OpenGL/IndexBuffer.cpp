@@ -1,6 +1,8 @@
 #include "GameEngineCore/Rendering/OpenGL/IndexBuffer.hpp"
 
 #include "GameEngineCore/log.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
 
 #include "glad/glad.h"
 
@@ -12,43 +14,81 @@ namespace GameEngine {
             case VertexBuffer::TypeDrawUsage::Stream: return GL_STREAM_DRAW;
         }
 
-        LOG_ERROR("Unknown VertexBuffer usage");
+        LOG_ERROR_TO(LogSubsystem::Rendering, "Unknown VertexBuffer usage");
 
         return GL_STREAM_DRAW;
     }
 
     IndexBuffer::IndexBuffer(const void *data, const size_t count,
                              const VertexBuffer::TypeDrawUsage usage)
-        : m_count{count} {
-        glGenBuffers(1, &m_id);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(GLuint), data, usageToGLenum(usage));
+        : m_count{count}, m_usedCount{data != nullptr ? count : 0} {
+        glCreateBuffers(1, &m_id);
+        glNamedBufferData(m_id, static_cast<GLsizeiptr>(count * sizeof(GLuint)), data,
+                          usageToGLenum(usage));
+        RendererOpenGL::onBufferAllocated(m_count * sizeof(GLuint));
     }
 
     IndexBuffer::~IndexBuffer() {
-        glDeleteBuffers(1, &m_id);
+        release();
+    }
+
+    void IndexBuffer::release() {
+        if (m_id != 0) {
+            RendererOpenGL::onBufferReleased(m_count * sizeof(GLuint));
+            StateCacheOpenGL::onBufferDeleted(m_id);
+            glDeleteBuffers(1, &m_id);
+        }
+
+        m_id = 0;
     }
 
     IndexBuffer &IndexBuffer::operator=(IndexBuffer &&indexBuffer) noexcept {
+        release();
+
         m_id = indexBuffer.m_id;
         m_count = indexBuffer.m_count;
+        m_usedCount = indexBuffer.m_usedCount;
         indexBuffer.m_id = 0;
         indexBuffer.m_count = 0;
+        indexBuffer.m_usedCount = 0;
 
         return *this;        
     }
 
     IndexBuffer::IndexBuffer(IndexBuffer &&indexBuffer) noexcept
-        : m_id{indexBuffer.m_id}, m_count{indexBuffer.m_count} {
+        : m_id{indexBuffer.m_id}, m_count{indexBuffer.m_count},
+          m_usedCount{indexBuffer.m_usedCount} {
         indexBuffer.m_id = 0;
         indexBuffer.m_count = 0;
+        indexBuffer.m_usedCount = 0;
+    }
+
+    bool IndexBuffer::allocate(const size_t count, size_t &firstIndex) {
+        if (m_usedCount + count > m_count) {
+            LOG_ERROR_TO(LogSubsystem::Rendering,
+                         "IndexBuffer: cannot allocate {0} indices, {1} of {2} used",
+                         count, m_usedCount, m_count);
+
+            return false;
+        }
+
+        firstIndex = m_usedCount;
+        m_usedCount += count;
+
+        return true;
+    }
+
+    void IndexBuffer::setData(const unsigned int *indices, const size_t count,
+                              const size_t firstIndex) {
+        glNamedBufferSubData(m_id, static_cast<GLintptr>(firstIndex * sizeof(GLuint)),
+                             static_cast<GLsizeiptr>(count * sizeof(GLuint)), indices);
     }
 
     void IndexBuffer::bind() const {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
+        StateCacheOpenGL::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_id);
     }
 
     void IndexBuffer::unbind() {
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        StateCacheOpenGL::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 }
@@ -0,0 +1,221 @@
+#include "GameEngineCore/Rendering/OpenGL/ProgramBinaryCache.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+
+#include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+#include "glad/glad.h"
+
+namespace GameEngine {
+    bool ProgramBinaryCache::s_isEnabled = false;
+    uint64_t ProgramBinaryCache::s_driverHash = 0;
+    std::string ProgramBinaryCache::s_directory;
+    ProgramBinaryCache::Statistics ProgramBinaryCache::s_statistics;
+
+    namespace {
+        constexpr char s_magic[4] = { 'G', 'E', 'P', 'B' };
+        // Upper bound for a sane entry, anything bigger is treated as corrupt.
+        constexpr uint32_t s_maxBinarySize = 64 * 1024 * 1024;
+
+        struct ProgramBinaryHeader {
+            char magic[4];
+            uint32_t version;
+            uint64_t driverHash;
+            uint64_t key;
+            uint32_t binaryFormat;
+            uint32_t binarySize;
+            double compileMilliseconds;
+        };
+
+        uint64_t hashString(uint64_t hash, const char *string) {
+            if (string == nullptr) {
+                string = "";
+            }
+
+            // The terminator is hashed too, so ("ab", "c") and ("a", "bc") differ.
+            do {
+                hash ^= static_cast<unsigned char>(*string);
+                hash *= 1099511628211ull;
+            } while (*string++ != '\0');
+
+            return hash;
+        }
+
+        constexpr uint64_t s_hashBasis = 14695981039346656037ull;
+
+        double getMillisecondsSince(const std::chrono::steady_clock::time_point begin) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        }
+    }
+
+    bool ProgramBinaryCache::init(const std::string &directory) {
+        shutdown();
+
+        GLint formatsCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatsCount);
+
+        if (directory.empty() || formatsCount <= 0) {
+            LOG_INFO_TO(LogSubsystem::Rendering, "Program binary cache: disabled");
+
+            return false;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+
+        if (error) {
+            LOG_WARNING_TO(LogSubsystem::Rendering, "Program binary cache: failed to create {}: {}",
+                           directory, error.message());
+
+            return false;
+        }
+
+        s_driverHash = hashString(s_hashBasis, RendererOpenGL::getVendorStr());
+        s_driverHash = hashString(s_driverHash, RendererOpenGL::getRendererStr());
+        s_driverHash = hashString(s_driverHash, RendererOpenGL::getVersionStr());
+        s_directory = directory;
+        s_isEnabled = true;
+
+        LOG_INFO_TO(LogSubsystem::Rendering, "Program binary cache: {} ({} binary formats)", directory, formatsCount);
+
+        return true;
+    }
+
+    void ProgramBinaryCache::shutdown() {
+        s_isEnabled = false;
+        s_driverHash = 0;
+        s_directory.clear();
+        s_statistics = Statistics{};
+    }
+
+    uint64_t ProgramBinaryCache::makeKey(const char *vertexShaderSrc, const char *fragmentShaderSrc) {
+        uint64_t hash = hashString(s_hashBasis, vertexShaderSrc);
+        hash = hashString(hash, fragmentShaderSrc);
+
+        return hashString(hash ^ s_driverHash, "");
+    }
+
+    std::string ProgramBinaryCache::getEntryPath(const uint64_t key) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+
+        return (std::filesystem::path(s_directory) / name).string();
+    }
+
+    bool ProgramBinaryCache::load(const uint64_t key, const unsigned int programId) {
+        if (!s_isEnabled) {
+            return false;
+        }
+
+        PROFILE_SCOPE("ProgramBinaryCache::load");
+
+        const auto begin = std::chrono::steady_clock::now();
+        const std::string path = getEntryPath(key);
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+
+        if (!file.is_open()) {
+            ++s_statistics.missesCount;
+
+            return false;
+        }
+
+        ProgramBinaryHeader header{};
+        std::vector<char> binary;
+
+        bool isValid = file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+                       std::memcmp(header.magic, s_magic, sizeof(s_magic)) == 0 &&
+                       header.version == s_version && header.driverHash == s_driverHash &&
+                       header.key == key && header.binarySize > 0 && header.binarySize <= s_maxBinarySize;
+
+        if (isValid) {
+            binary.resize(header.binarySize);
+            isValid = static_cast<bool>(file.read(binary.data(), static_cast<std::streamsize>(binary.size())));
+        }
+
+        if (isValid) {
+            glProgramBinary(programId, header.binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+
+            GLint linkStatus = GL_FALSE;
+            glGetProgramiv(programId, GL_LINK_STATUS, &linkStatus);
+            isValid = linkStatus == GL_TRUE;
+        }
+
+        if (!isValid) {
+            LOG_INFO_TO(LogSubsystem::Rendering, "Program binary cache: rejected {}", path);
+            ++s_statistics.rejectedCount;
+            ++s_statistics.missesCount;
+
+            return false;
+        }
+
+        const double loadMilliseconds = getMillisecondsSince(begin);
+
+        ++s_statistics.hitsCount;
+        s_statistics.loadMilliseconds += loadMilliseconds;
+        s_statistics.savedMilliseconds += header.compileMilliseconds - loadMilliseconds;
+
+        return true;
+    }
+
+    void ProgramBinaryCache::store(const uint64_t key, const unsigned int programId,
+                                   const double compileMilliseconds) {
+        if (!s_isEnabled) {
+            return;
+        }
+
+        PROFILE_SCOPE("ProgramBinaryCache::store");
+
+        GLint binarySize = 0;
+        glGetProgramiv(programId, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+        if (binarySize <= 0 || static_cast<uint32_t>(binarySize) > s_maxBinarySize) {
+            return;
+        }
+
+        std::vector<char> binary(static_cast<size_t>(binarySize));
+        GLsizei writtenSize = 0;
+        GLenum binaryFormat = 0;
+        glGetProgramBinary(programId, binarySize, &writtenSize, &binaryFormat, binary.data());
+
+        if (writtenSize <= 0) {
+            return;
+        }
+
+        ProgramBinaryHeader header{};
+        std::memcpy(header.magic, s_magic, sizeof(s_magic));
+        header.version = s_version;
+        header.driverHash = s_driverHash;
+        header.key = key;
+        header.binaryFormat = binaryFormat;
+        header.binarySize = static_cast<uint32_t>(writtenSize);
+        header.compileMilliseconds = compileMilliseconds;
+
+        const std::string path = getEntryPath(key);
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open()) {
+            LOG_WARNING_TO(LogSubsystem::Rendering, "Program binary cache: failed to open {} for writing", path);
+
+            return;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), writtenSize);
+
+        if (file.good()) {
+            ++s_statistics.storesCount;
+        }
+    }
+
+    void ProgramBinaryCache::onCompiled(const double compileMilliseconds) {
+        s_statistics.compileMilliseconds += compileMilliseconds;
+    }
+}
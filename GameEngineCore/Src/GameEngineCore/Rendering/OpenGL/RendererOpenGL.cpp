@@ -4,35 +4,222 @@
 #include "GLFW/glfw3.h"
 
 #include "GameEngineCore/Rendering/OpenGL/VertexArray.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/ShaderProgram.hpp"
+#include "GameEngineCore/Rendering/OpenGL/Texture2D.hpp"
+#include "GameEngineCore/Rendering/OpenGL/Texture2DArray.hpp"
+#include "GameEngineCore/Rendering/OpenGL/BindlessTextureTable.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StreamingBuffer.hpp"
+#include "GameEngineCore/Rendering/OpenGL/GpuProfiler.hpp"
+#include "GameEngineCore/Rendering/Headless/HeadlessContext.hpp"
+#include "GameEngineCore/Rendering/RenderQueue.hpp"
+#include "GameEngineCore/Rendering/UniformBlocks.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
 #include "GameEngineCore/Log.hpp"
 
 namespace GameEngine {
+    RendererOpenGL::Statistics RendererOpenGL::s_statistics;
+    RendererOpenGL::MemoryStatistics RendererOpenGL::s_memoryStatistics;
+    size_t RendererOpenGL::s_uniformBufferOffsetAlignment = 256;
+
+    static bool bindUniformBlock(StreamingBuffer &uniformsRing, const UniformBlockBinding binding,
+                                 const void *data, const size_t size) {
+        const StreamingBuffer::Allocation allocation = uniformsRing.allocate(
+            size, RendererOpenGL::getUniformBufferOffsetAlignment());
+
+        if (!allocation.isValid()) {
+            return false;
+        }
+
+        std::memcpy(allocation.data, data, size);
+        StateCacheOpenGL::bindBufferRange(GL_UNIFORM_BUFFER, static_cast<unsigned int>(binding),
+                                          uniformsRing.getId(), allocation.offset, size);
+
+        return true;
+    }
+
+    GpuQueryFunctions GpuQueryFunctions::fromOpenGL() {
+        GpuQueryFunctions functions;
+
+        functions.createQueries = [](unsigned int target, int count, unsigned int *ids) {
+            glCreateQueries(target, count, ids);
+        };
+        functions.deleteQueries = [](int count, const unsigned int *ids) {
+            glDeleteQueries(count, ids);
+        };
+        functions.queryCounter = [](unsigned int id, unsigned int target) {
+            glQueryCounter(id, target);
+        };
+        functions.getQueryObjectiv = [](unsigned int id, unsigned int parameter, int *value) {
+            glGetQueryObjectiv(id, parameter, value);
+        };
+        functions.getQueryObjectui64v = [](unsigned int id, unsigned int parameter, uint64_t *value) {
+            GLuint64 result = 0;
+            glGetQueryObjectui64v(id, parameter, &result);
+            *value = static_cast<uint64_t>(result);
+        };
+
+        return functions;
+    }
+
     bool RendererOpenGL::init(GLFWwindow *window) {
         glfwMakeContextCurrent(window);
 
         if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
-            LOG_CRITICAL("Failed to initialize GLAD");
+            LOG_CRITICAL_TO(LogSubsystem::Rendering, "Failed to initialize GLAD");
+
+            return false;
+        }
+
+        if (!onContextLoaded()) {
+            return false;
+        }
+
+        BindlessTextureTable::loadFunctions(
+            reinterpret_cast<BindlessTextureTable::GetProcAddress>(glfwGetProcAddress));
+
+        return true;
+    }
+
+    bool RendererOpenGL::initHeadless(const RenderBackend backend) {
+        if (!HeadlessContext::init(backend)) {
+            LOG_CRITICAL_TO(LogSubsystem::Rendering, "Failed to initialize headless render backend");
 
             return false;
         }
 
-        LOG_INFO("OpenGL context initialized:");
-        LOG_INFO("Vendor: {0}", getVendorStr());
-        LOG_INFO("Renderer: {0}", getRendererStr());
-        LOG_INFO("Version: {0}", getVersionStr());
+        if (!onContextLoaded()) {
+            return false;
+        }
+
+        BindlessTextureTable::loadFunctions(nullptr);
+
+        return true;
+    }
+
+    bool RendererOpenGL::onContextLoaded() {
+        StateCacheOpenGL::invalidate();
+
+        GLint uniformBufferOffsetAlignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformBufferOffsetAlignment);
+        if (uniformBufferOffsetAlignment > 0) {
+            s_uniformBufferOffsetAlignment = static_cast<size_t>(uniformBufferOffsetAlignment);
+        }
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        LOG_INFO_TO(LogSubsystem::Rendering, "OpenGL context initialized:");
+        LOG_INFO_TO(LogSubsystem::Rendering, "Vendor: {0}", getVendorStr());
+        LOG_INFO_TO(LogSubsystem::Rendering, "Renderer: {0}", getRendererStr());
+        LOG_INFO_TO(LogSubsystem::Rendering, "Version: {0}", getVersionStr());
 
         return true;
     }
 
     void RendererOpenGL::draw(const VertexArray &vertexArray) {
+        PROFILE_SCOPE("RendererOpenGL::draw");
+
         vertexArray.bind();
         glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(vertexArray.getIndicesCount()),
                        GL_UNSIGNED_INT, nullptr);
+
+        ++s_statistics.drawCalls;
+        ++s_statistics.instances;
+    }
+
+    void RendererOpenGL::drawInstanced(const VertexArray &vertexArray,
+                                       const size_t instanceCount,
+                                       const size_t baseInstance) {
+        if (instanceCount == 0) {
+            return;
+        }
+
+        vertexArray.bind();
+        glDrawElementsInstancedBaseInstance(GL_TRIANGLES,
+                                            static_cast<GLsizei>(vertexArray.getIndicesCount()),
+                                            GL_UNSIGNED_INT, nullptr,
+                                            static_cast<GLsizei>(instanceCount),
+                                            static_cast<GLuint>(baseInstance));
+
+        ++s_statistics.drawCalls;
+        s_statistics.instances += instanceCount;
+    }
+
+    void RendererOpenGL::multiDrawIndirect(const VertexArray &vertexArray,
+                                           const unsigned int indirectBufferId,
+                                           const size_t indirectOffset, const size_t drawCount,
+                                           const size_t instancesCount) {
+        if (drawCount == 0) {
+            return;
+        }
+
+        vertexArray.bind();
+        StateCacheOpenGL::bindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBufferId);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                    reinterpret_cast<const void*>(indirectOffset),
+                                    static_cast<GLsizei>(drawCount), 0);
+
+        ++s_statistics.drawCalls;
+        s_statistics.instances += instancesCount;
+    }
+
+    void RendererOpenGL::setFrameUniforms(StreamingBuffer &uniformsRing,
+                                          const FrameUniforms &frameUniforms) {
+        bindUniformBlock(uniformsRing, UniformBlockBinding::Frame,
+                         &frameUniforms, sizeof(frameUniforms));
+    }
+
+    void RendererOpenGL::submit(RenderQueue &renderQueue, StreamingBuffer &uniformsRing) {
+        PROFILE_GPU_SCOPE("RendererOpenGL::submit");
+
+        renderQueue.sort();
+
+        ShaderProgram *currentProgram = nullptr;
+
+        for (size_t i = 0; i < renderQueue.getCount(); ++i) {
+            const DrawCommand &command = renderQueue.getSortedCommand(i);
+
+            if (command.vertexArray == nullptr || command.shaderProgram == nullptr) {
+                continue;
+            }
+
+            if (command.shaderProgram != currentProgram) {
+                currentProgram = command.shaderProgram;
+                currentProgram->bind();
+            }
+
+            for (size_t unit = 0; unit < command.textures.size(); ++unit) {
+                if (command.textures[unit] != nullptr) {
+                    command.textures[unit]->bind(static_cast<unsigned int>(unit));
+                }
+            }
+
+            if (command.textureArray != nullptr) {
+                command.textureArray->bind(DrawCommand::s_textureArrayUnit);
+            }
+
+            const ObjectUniforms objectUniforms{ command.modelMatrix };
+            if (!bindUniformBlock(uniformsRing, UniformBlockBinding::Object,
+                                  &objectUniforms, sizeof(objectUniforms))) {
+                continue;
+            }
+
+            StateCacheOpenGL::setBlending(command.transparent);
+
+            if (command.transparent) {
+                StateCacheOpenGL::setBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            }
+
+            drawInstanced(*command.vertexArray, command.instanceCount, command.baseInstance);
+        }
     }
 
     void RendererOpenGL::setClearColor(const float red, const float green,
                                        const float blue, const float alpha) {
-        glClearColor(red, green, blue, alpha);
+        StateCacheOpenGL::setClearColor(red, green, blue, alpha);
     }
 
     void RendererOpenGL::clear() {
@@ -46,11 +233,11 @@ namespace GameEngine {
     }
 
     void RendererOpenGL::enableDepthTest() {
-        glEnable(GL_DEPTH_TEST);
+        StateCacheOpenGL::setDepthTest(true);
     }
 
     void RendererOpenGL::disableDepthTest() {
-        glDisable(GL_DEPTH_TEST);
+        StateCacheOpenGL::setDepthTest(false);
     }
 
     const char *RendererOpenGL::getVendorStr() {
@@ -64,4 +251,28 @@ namespace GameEngine {
     const char *RendererOpenGL::getVersionStr() {
         return reinterpret_cast<const char*>(glGetString(GL_VERSION));
     }
+
+    void RendererOpenGL::resetStatistics() {
+        s_statistics = Statistics{};
+    }
+
+    void RendererOpenGL::onBufferAllocated(const size_t size) {
+        s_memoryStatistics.bufferBytes += size;
+        ++s_memoryStatistics.buffersCount;
+    }
+
+    void RendererOpenGL::onBufferReleased(const size_t size) {
+        s_memoryStatistics.bufferBytes -= std::min(size, s_memoryStatistics.bufferBytes);
+        s_memoryStatistics.buffersCount -= s_memoryStatistics.buffersCount > 0 ? 1 : 0;
+    }
+
+    void RendererOpenGL::onTextureAllocated(const size_t size) {
+        s_memoryStatistics.textureBytes += size;
+        ++s_memoryStatistics.texturesCount;
+    }
+
+    void RendererOpenGL::onTextureReleased(const size_t size) {
+        s_memoryStatistics.textureBytes -= std::min(size, s_memoryStatistics.textureBytes);
+        s_memoryStatistics.texturesCount -= s_memoryStatistics.texturesCount > 0 ? 1 : 0;
+    }
 }
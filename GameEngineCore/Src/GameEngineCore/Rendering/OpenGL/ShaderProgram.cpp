@@ -1,11 +1,56 @@
 #include "GameEngineCore/Rendering/OpenGL/ShaderProgram.hpp"
 
 #include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Memory/ScratchAllocator.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/ProgramBinaryCache.hpp"
+#include "GameEngineCore/Rendering/UniformBlocks.hpp"
 
 #include "glad/glad.h"
 #include "glm/gtc/type_ptr.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 namespace GameEngine {
+    constexpr size_t uniformTypeSize(const GLenum type) {
+        switch (type) {
+            case GL_FLOAT: return sizeof(GLfloat);
+            case GL_FLOAT_VEC2: return sizeof(GLfloat) * 2;
+            case GL_FLOAT_VEC3: return sizeof(GLfloat) * 3;
+            case GL_FLOAT_VEC4: return sizeof(GLfloat) * 4;
+            case GL_FLOAT_MAT2: return sizeof(GLfloat) * 4;
+            case GL_FLOAT_MAT3: return sizeof(GLfloat) * 9;
+            case GL_FLOAT_MAT4: return sizeof(GLfloat) * 16;
+            case GL_INT_VEC2:
+            case GL_UNSIGNED_INT_VEC2:
+            case GL_BOOL_VEC2:
+                return sizeof(GLint) * 2;
+            case GL_INT_VEC3:
+            case GL_UNSIGNED_INT_VEC3:
+            case GL_BOOL_VEC3:
+                return sizeof(GLint) * 3;
+            case GL_INT_VEC4:
+            case GL_UNSIGNED_INT_VEC4:
+            case GL_BOOL_VEC4:
+                return sizeof(GLint) * 4;
+        }
+
+        return sizeof(GLint);
+    }
+
+    constexpr uint32_t hashUniformName(const char *name) {
+        uint32_t hash = 2166136261u;
+
+        for (; *name != '\0'; ++name) {
+            hash ^= static_cast<unsigned char>(*name);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
     bool create_shader(const char *source, const GLenum shaderType, GLuint &shaderId) {
         shaderId = glCreateShader(shaderType);
         glShaderSource(shaderId, 1, &source, nullptr);
@@ -17,7 +62,7 @@ namespace GameEngine {
             char infoLog[1024];
             glGetShaderInfoLog(shaderId, 1024, nullptr, infoLog);
 
-            LOG_CRITICAL("Shader compilation error:\n{}", infoLog);
+            LOG_CRITICAL_TO(LogSubsystem::Rendering, "Shader compilation error:\n{}", infoLog);
 
             return false;
         }
@@ -26,24 +71,77 @@ namespace GameEngine {
     }
 
     ShaderProgram::ShaderProgram(const char *vertexShaderSrc, const char *fragmentShaderSrc) {
+        const bool isCacheEnabled = ProgramBinaryCache::isEnabled();
+        const uint64_t cacheKey = isCacheEnabled ?
+            ProgramBinaryCache::makeKey(vertexShaderSrc, fragmentShaderSrc) : 0;
+
+        if (isCacheEnabled) {
+            m_id = glCreateProgram();
+
+            if (ProgramBinaryCache::load(cacheKey, m_id)) {
+                m_isCompiled = true;
+            } else {
+                glDeleteProgram(m_id);
+                m_id = 0;
+            }
+        }
+
+        const bool isLoadedFromCache = m_isCompiled;
+        double compileMilliseconds = 0.0;
+
+        if (!isLoadedFromCache) {
+            const auto begin = std::chrono::steady_clock::now();
+
+            if (!compileFromSource(vertexShaderSrc, fragmentShaderSrc, isCacheEnabled)) {
+                return;
+            }
+
+            compileMilliseconds =
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+            ProgramBinaryCache::onCompiled(compileMilliseconds);
+        }
+
+        reflectUniforms();
+
+        if (!validateUniformBlocks()) {
+            m_isCompiled = false;
+
+            return;
+        }
+
+        // Stored only once the blocks match the engine layouts, so a mismatching program
+        // is never served from the cache on the next run.
+        if (isCacheEnabled && !isLoadedFromCache) {
+            ProgramBinaryCache::store(cacheKey, m_id, compileMilliseconds);
+        }
+    }
+
+    bool ShaderProgram::compileFromSource(const char *vertexShaderSrc, const char *fragmentShaderSrc,
+                                          const bool isRetrievable) {
         GLuint vertexShaderId = 0;
         if (!create_shader(vertexShaderSrc, GL_VERTEX_SHADER, vertexShaderId)) {
-            LOG_CRITICAL("VERTEX SHADER: compile-time error!");
+            LOG_CRITICAL_TO(LogSubsystem::Rendering, "VERTEX SHADER: compile-time error!");
             glDeleteShader(vertexShaderId);
 
-            return;
+            return false;
         }
 
         GLuint fragmentShaderId = 0;
         if (!create_shader(fragmentShaderSrc, GL_FRAGMENT_SHADER, fragmentShaderId)) {
-            LOG_CRITICAL("FRAGMENT SHADER: compile-time error!");
+            LOG_CRITICAL_TO(LogSubsystem::Rendering, "FRAGMENT SHADER: compile-time error!");
             glDeleteShader(vertexShaderId);
             glDeleteShader(fragmentShaderId);
 
-            return;
+            return false;
         }
 
         m_id = glCreateProgram();
+
+        if (isRetrievable) {
+            glProgramParameteri(m_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+
         glAttachShader(m_id, vertexShaderId);
         glAttachShader(m_id, fragmentShaderId);
         glLinkProgram(m_id);
@@ -53,13 +151,13 @@ namespace GameEngine {
         if (success == GL_FALSE) {
             GLchar info_log[1024];
             glGetProgramInfoLog(m_id, 1024, nullptr, info_log);
-            LOG_CRITICAL("SHADER PROGRAM: Link-time error:\n{0}", info_log);
+            LOG_CRITICAL_TO(LogSubsystem::Rendering, "SHADER PROGRAM: Link-time error:\n{0}", info_log);
             glDeleteProgram(m_id);
             m_id = 0;
             glDeleteShader(vertexShaderId);
             glDeleteShader(fragmentShaderId);
 
-            return;
+            return false;
         } else {
             m_isCompiled = true;
         }
@@ -68,24 +166,225 @@ namespace GameEngine {
         glDetachShader(m_id, fragmentShaderId);
         glDeleteShader(vertexShaderId);
         glDeleteShader(fragmentShaderId);
+
+        return true;
+    }
+
+    bool ShaderProgram::validateUniformBlocks() const {
+        GLint blocksCount = 0;
+        GLint maxBlockNameLength = 0;
+        GLint maxUniformNameLength = 0;
+        glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_BLOCKS, &blocksCount);
+        glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+        glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxUniformNameLength);
+
+        // Name and member arrays are reflection temporaries, so they come from the thread scratch.
+        ScratchScope scratch;
+        GLchar *blockName = scratch.allocateArray<GLchar>(static_cast<size_t>(maxBlockNameLength) + 1);
+        GLchar *uniformName = scratch.allocateArray<GLchar>(static_cast<size_t>(maxUniformNameLength) + 1);
+
+        if (blockName == nullptr || uniformName == nullptr) {
+            return false;
+        }
+
+        bool isValid = true;
+
+        for (GLint blockIndex = 0; blockIndex < blocksCount; ++blockIndex) {
+            glGetActiveUniformBlockName(m_id, static_cast<GLuint>(blockIndex), maxBlockNameLength,
+                                        nullptr, blockName);
+
+            const UniformBlockLayout *layout = findUniformBlockLayout(blockName);
+
+            if (layout == nullptr) {
+                LOG_WARNING_TO(LogSubsystem::Rendering,
+                               "SHADER PROGRAM: unknown uniform block {0}", blockName);
+                continue;
+            }
+
+            GLint dataSize = 0;
+            GLint membersCount = 0;
+            glGetActiveUniformBlockiv(m_id, static_cast<GLuint>(blockIndex),
+                                      GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+            glGetActiveUniformBlockiv(m_id, static_cast<GLuint>(blockIndex),
+                                      GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &membersCount);
+
+            if (static_cast<size_t>(dataSize) > layout->size) {
+                LOG_CRITICAL_TO(LogSubsystem::Rendering,
+                                "SHADER PROGRAM: uniform block {0} is {1} bytes, engine layout is {2}",
+                                layout->name, dataSize, layout->size);
+                isValid = false;
+            }
+
+            ScratchScope membersScratch;
+            GLint *memberIndices = membersScratch.allocateArray<GLint>(static_cast<size_t>(membersCount));
+            GLint *memberOffsets = membersScratch.allocateArray<GLint>(static_cast<size_t>(membersCount));
+
+            if (membersCount > 0 && (memberIndices == nullptr || memberOffsets == nullptr)) {
+                return false;
+            }
+
+            glGetActiveUniformBlockiv(m_id, static_cast<GLuint>(blockIndex),
+                                      GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES,
+                                      memberIndices);
+            glGetActiveUniformsiv(m_id, membersCount,
+                                  reinterpret_cast<const GLuint*>(memberIndices),
+                                  GL_UNIFORM_OFFSET, memberOffsets);
+
+            for (GLint i = 0; i < membersCount; ++i) {
+                glGetActiveUniformName(m_id, static_cast<GLuint>(memberIndices[i]),
+                                       maxUniformNameLength, nullptr, uniformName);
+
+                const UniformBlockMember *member = nullptr;
+                for (size_t j = 0; j < layout->membersCount; ++j) {
+                    if (std::strcmp(layout->members[j].name, uniformName) == 0) {
+                        member = &layout->members[j];
+                        break;
+                    }
+                }
+
+                if (member == nullptr ||
+                    member->offset != static_cast<size_t>(memberOffsets[i])) {
+                    LOG_CRITICAL_TO(LogSubsystem::Rendering,
+                                    "SHADER PROGRAM: member {0} of uniform block {1} does not match "
+                                    "the engine layout", uniformName, layout->name);
+                    isValid = false;
+                }
+            }
+
+            glUniformBlockBinding(m_id, static_cast<GLuint>(blockIndex),
+                                  static_cast<GLuint>(layout->binding));
+        }
+
+        return isValid;
+    }
+
+    void ShaderProgram::reflectUniforms() {
+        GLint uniformsCount = 0;
+        GLint maxNameLength = 0;
+        glGetProgramiv(m_id, GL_ACTIVE_UNIFORMS, &uniformsCount);
+        glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+        ScratchScope scratch;
+        GLchar *nameBuffer = scratch.allocateArray<GLchar>(static_cast<size_t>(maxNameLength) + 1);
+
+        if (nameBuffer == nullptr) {
+            return;
+        }
+
+        size_t shadowSize = 0;
+
+        for (GLint i = 0; i < uniformsCount; ++i) {
+            GLsizei nameLength = 0;
+            GLint arraySize = 0;
+            GLenum type = 0;
+            glGetActiveUniform(m_id, static_cast<GLuint>(i), maxNameLength,
+                               &nameLength, &arraySize, &type, nameBuffer);
+
+            const GLint location = glGetUniformLocation(m_id, nameBuffer);
+
+            if (location < 0) {
+                continue;
+            }
+
+            UniformInfo uniform;
+            uniform.name.assign(nameBuffer, static_cast<size_t>(nameLength));
+            uniform.location = location;
+            uniform.type = type;
+            uniform.arraySize = arraySize;
+            uniform.shadowOffset = shadowSize;
+            uniform.shadowSize = uniformTypeSize(type) * static_cast<size_t>(arraySize);
+
+            const size_t arraySuffix = uniform.name.rfind("[0]");
+            if (arraySuffix != std::string::npos && arraySuffix + 3 == uniform.name.size()) {
+                uniform.name.erase(arraySuffix);
+            }
+
+            shadowSize += uniform.shadowSize;
+            m_uniforms.push_back(std::move(uniform));
+        }
+
+        m_uniformsShadow.assign(shadowSize, 0);
+
+        size_t tableSize = 1;
+        while (tableSize < m_uniforms.size() * 2) {
+            tableSize <<= 1;
+        }
+
+        m_uniformsTable.assign(tableSize, -1);
+
+        for (size_t i = 0; i < m_uniforms.size(); ++i) {
+            size_t slot = hashUniformName(m_uniforms[i].name.c_str()) & (tableSize - 1);
+
+            while (m_uniformsTable[slot] >= 0) {
+                slot = (slot + 1) & (tableSize - 1);
+            }
+
+            m_uniformsTable[slot] = static_cast<int>(i);
+        }
+    }
+
+    UniformHandle ShaderProgram::getUniformHandle(const char *name) const {
+        if (m_uniformsTable.empty()) {
+            return {};
+        }
+
+        const size_t mask = m_uniformsTable.size() - 1;
+        size_t slot = hashUniformName(name) & mask;
+
+        while (m_uniformsTable[slot] >= 0) {
+            const int index = m_uniformsTable[slot];
+
+            if (m_uniforms[index].name == name) {
+                return { m_uniforms[index].location, index };
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        return {};
+    }
+
+    bool ShaderProgram::updateShadow(const UniformHandle handle, const void *data,
+                                     const size_t size) {
+        if (!handle.isValid() || static_cast<size_t>(handle.index) >= m_uniforms.size()) {
+            return false;
+        }
+
+        UniformInfo &uniform = m_uniforms[handle.index];
+        unsigned char *shadow = m_uniformsShadow.data() + uniform.shadowOffset;
+        const size_t comparedSize = std::min(size, uniform.shadowSize);
+
+        if (uniform.hasValue && std::memcmp(shadow, data, comparedSize) == 0) {
+            return false;
+        }
+
+        std::memcpy(shadow, data, comparedSize);
+        uniform.hasValue = true;
+
+        return true;
     }
 
     ShaderProgram::~ShaderProgram() {
+        StateCacheOpenGL::onProgramDeleted(m_id);
         glDeleteProgram(m_id);
     }
 
     void ShaderProgram::bind() const {
-        glUseProgram(m_id);
+        StateCacheOpenGL::useProgram(m_id);
     }
 
     void ShaderProgram::unbind() {
-        glUseProgram(0);
+        StateCacheOpenGL::useProgram(0);
     }
 
     ShaderProgram &ShaderProgram::operator=(ShaderProgram &&shaderProgram) {
+        StateCacheOpenGL::onProgramDeleted(m_id);
         glDeleteProgram(m_id);
         m_id = shaderProgram.m_id;
         m_isCompiled = shaderProgram.m_isCompiled;
+        m_uniforms = std::move(shaderProgram.m_uniforms);
+        m_uniformsTable = std::move(shaderProgram.m_uniformsTable);
+        m_uniformsShadow = std::move(shaderProgram.m_uniformsShadow);
 
         shaderProgram.m_id = 0;
         shaderProgram.m_isCompiled = false;
@@ -93,7 +392,10 @@ namespace GameEngine {
         return *this;
     }
 
-    ShaderProgram::ShaderProgram(ShaderProgram &&shaderProgram) {
+    ShaderProgram::ShaderProgram(ShaderProgram &&shaderProgram)
+        : m_uniforms{std::move(shaderProgram.m_uniforms)},
+          m_uniformsTable{std::move(shaderProgram.m_uniformsTable)},
+          m_uniformsShadow{std::move(shaderProgram.m_uniformsShadow)} {
         m_id = shaderProgram.m_id;
         m_isCompiled = shaderProgram.m_isCompiled;
 
@@ -101,11 +403,87 @@ namespace GameEngine {
         shaderProgram.m_isCompiled = false;
     }
 
-    void ShaderProgram::setMatrix_4(const char *name, const glm::mat4 &matrix) const {
-        glUniformMatrix4fv(glGetUniformLocation(m_id, name), 1, GL_FALSE, glm::value_ptr(matrix));
+    void ShaderProgram::setInt(const UniformHandle handle, const int value) {
+        if (updateShadow(handle, &value, sizeof(value))) {
+            glProgramUniform1i(m_id, handle.location, value);
+        }
+    }
+
+    void ShaderProgram::setSampler(const UniformHandle handle, const int unit) {
+        setInt(handle, unit);
+    }
+
+    void ShaderProgram::setFloat(const UniformHandle handle, const float value) {
+        if (updateShadow(handle, &value, sizeof(value))) {
+            glProgramUniform1f(m_id, handle.location, value);
+        }
+    }
+
+    void ShaderProgram::setVec2(const UniformHandle handle, const glm::vec2 &value) {
+        if (updateShadow(handle, glm::value_ptr(value), sizeof(value))) {
+            glProgramUniform2fv(m_id, handle.location, 1, glm::value_ptr(value));
+        }
+    }
+
+    void ShaderProgram::setVec3(const UniformHandle handle, const glm::vec3 &value) {
+        if (updateShadow(handle, glm::value_ptr(value), sizeof(value))) {
+            glProgramUniform3fv(m_id, handle.location, 1, glm::value_ptr(value));
+        }
+    }
+
+    void ShaderProgram::setVec4(const UniformHandle handle, const glm::vec4 &value) {
+        if (updateShadow(handle, glm::value_ptr(value), sizeof(value))) {
+            glProgramUniform4fv(m_id, handle.location, 1, glm::value_ptr(value));
+        }
+    }
+
+    void ShaderProgram::setMatrix_3(const UniformHandle handle, const glm::mat3 &matrix) {
+        if (updateShadow(handle, glm::value_ptr(matrix), sizeof(matrix))) {
+            glProgramUniformMatrix3fv(m_id, handle.location, 1, GL_FALSE, glm::value_ptr(matrix));
+        }
+    }
+
+    void ShaderProgram::setMatrix_4(const UniformHandle handle, const glm::mat4 &matrix) {
+        if (updateShadow(handle, glm::value_ptr(matrix), sizeof(matrix))) {
+            glProgramUniformMatrix4fv(m_id, handle.location, 1, GL_FALSE, glm::value_ptr(matrix));
+        }
+    }
+
+    void ShaderProgram::setIntArray(const UniformHandle handle, const int *values,
+                                    const size_t count) {
+        if (updateShadow(handle, values, sizeof(int) * count)) {
+            glProgramUniform1iv(m_id, handle.location, static_cast<GLsizei>(count), values);
+        }
+    }
+
+    void ShaderProgram::setFloatArray(const UniformHandle handle, const float *values,
+                                      const size_t count) {
+        if (updateShadow(handle, values, sizeof(float) * count)) {
+            glProgramUniform1fv(m_id, handle.location, static_cast<GLsizei>(count), values);
+        }
+    }
+
+    void ShaderProgram::setVec4Array(const UniformHandle handle, const glm::vec4 *values,
+                                     const size_t count) {
+        if (updateShadow(handle, values, sizeof(glm::vec4) * count)) {
+            glProgramUniform4fv(m_id, handle.location, static_cast<GLsizei>(count),
+                                glm::value_ptr(values[0]));
+        }
+    }
+
+    void ShaderProgram::setMatrix_4Array(const UniformHandle handle, const glm::mat4 *matrices,
+                                         const size_t count) {
+        if (updateShadow(handle, matrices, sizeof(glm::mat4) * count)) {
+            glProgramUniformMatrix4fv(m_id, handle.location, static_cast<GLsizei>(count),
+                                      GL_FALSE, glm::value_ptr(matrices[0]));
+        }
+    }
+
+    void ShaderProgram::setMatrix_4(const char *name, const glm::mat4 &matrix) {
+        setMatrix_4(getUniformHandle(name), matrix);
     }
 
-    void ShaderProgram::setInt(const char *name, const int value) const {
-        glUniform1i(glGetUniformLocation(m_id, name), value);
+    void ShaderProgram::setInt(const char *name, const int value) {
+        setInt(getUniformHandle(name), value);
     }
 }
@@ -0,0 +1,207 @@
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+
+#include "glad/glad.h"
+
+namespace GameEngine {
+    unsigned int StateCacheOpenGL::s_program = StateCacheOpenGL::s_unknown;
+    unsigned int StateCacheOpenGL::s_vertexArray = StateCacheOpenGL::s_unknown;
+    std::array<unsigned int, static_cast<size_t>(StateCacheOpenGL::BufferTarget::TargetsCount)>
+        StateCacheOpenGL::s_buffers;
+    std::array<unsigned int, StateCacheOpenGL::s_maxTextureUnits> StateCacheOpenGL::s_textures;
+    std::array<StateCacheOpenGL::BufferRange, StateCacheOpenGL::s_maxUniformBindings>
+        StateCacheOpenGL::s_uniformBindings;
+    std::array<int, static_cast<size_t>(StateCacheOpenGL::Capability::CapabilitiesCount)>
+        StateCacheOpenGL::s_capabilities;
+    std::array<unsigned int, 2> StateCacheOpenGL::s_blendFunction{ StateCacheOpenGL::s_unknown,
+                                                                   StateCacheOpenGL::s_unknown };
+    std::array<float, 4> StateCacheOpenGL::s_clearColor;
+    bool StateCacheOpenGL::s_clearColorValid = false;
+
+    bool StateCacheOpenGL::filter(const bool changed) {
+        if (changed) {
+            ++RendererOpenGL::s_statistics.stateChangesIssued;
+        } else {
+            ++RendererOpenGL::s_statistics.stateChangesFiltered;
+        }
+
+        return changed;
+    }
+
+    bool StateCacheOpenGL::bufferTargetIndex(const unsigned int target, size_t &index) {
+        switch (target) {
+            case GL_ARRAY_BUFFER: index = static_cast<size_t>(BufferTarget::Array); return true;
+            case GL_UNIFORM_BUFFER: index = static_cast<size_t>(BufferTarget::Uniform); return true;
+            case GL_SHADER_STORAGE_BUFFER: index = static_cast<size_t>(BufferTarget::ShaderStorage); return true;
+            case GL_DRAW_INDIRECT_BUFFER: index = static_cast<size_t>(BufferTarget::DrawIndirect); return true;
+            case GL_PIXEL_UNPACK_BUFFER: index = static_cast<size_t>(BufferTarget::PixelUnpack); return true;
+        }
+
+        return false;
+    }
+
+    void StateCacheOpenGL::useProgram(const unsigned int id) {
+        if (filter(s_program != id)) {
+            glUseProgram(id);
+            s_program = id;
+        }
+    }
+
+    void StateCacheOpenGL::bindVertexArray(const unsigned int id) {
+        if (filter(s_vertexArray != id)) {
+            glBindVertexArray(id);
+            s_vertexArray = id;
+        }
+    }
+
+    void StateCacheOpenGL::bindBuffer(const unsigned int target, const unsigned int id) {
+        size_t index = 0;
+
+        if (!bufferTargetIndex(target, index)) {
+            filter(true);
+            glBindBuffer(target, id);
+
+            return;
+        }
+
+        if (filter(s_buffers[index] != id)) {
+            glBindBuffer(target, id);
+            s_buffers[index] = id;
+        }
+    }
+
+    void StateCacheOpenGL::bindBufferRange(const unsigned int target, const unsigned int index,
+                                           const unsigned int id, const size_t offset,
+                                           const size_t size) {
+        if (target != GL_UNIFORM_BUFFER || index >= s_maxUniformBindings) {
+            filter(true);
+            glBindBufferRange(target, index, id, static_cast<GLintptr>(offset),
+                              static_cast<GLsizeiptr>(size));
+
+            return;
+        }
+
+        const BufferRange range{ id, offset, size };
+
+        if (filter(s_uniformBindings[index] != range)) {
+            glBindBufferRange(target, index, id, static_cast<GLintptr>(offset),
+                              static_cast<GLsizeiptr>(size));
+            s_uniformBindings[index] = range;
+            s_buffers[static_cast<size_t>(BufferTarget::Uniform)] = id;
+        }
+    }
+
+    void StateCacheOpenGL::bindTextureUnit(const unsigned int unit, const unsigned int id) {
+        if (unit >= s_maxTextureUnits) {
+            filter(true);
+            glBindTextureUnit(unit, id);
+
+            return;
+        }
+
+        if (filter(s_textures[unit] != id)) {
+            glBindTextureUnit(unit, id);
+            s_textures[unit] = id;
+        }
+    }
+
+    void StateCacheOpenGL::setCapability(const Capability capability, const bool enabled) {
+        const size_t index = static_cast<size_t>(capability);
+        const int state = enabled ? 1 : 0;
+
+        if (filter(s_capabilities[index] != state)) {
+            GLenum glCapability = GL_DEPTH_TEST;
+
+            switch (capability) {
+                case Capability::Blend: glCapability = GL_BLEND; break;
+                case Capability::CullFace: glCapability = GL_CULL_FACE; break;
+                default: break;
+            }
+
+            if (enabled) {
+                glEnable(glCapability);
+            } else {
+                glDisable(glCapability);
+            }
+
+            s_capabilities[index] = state;
+        }
+    }
+
+    void StateCacheOpenGL::setDepthTest(const bool enabled) {
+        setCapability(Capability::DepthTest, enabled);
+    }
+
+    void StateCacheOpenGL::setBlending(const bool enabled) {
+        setCapability(Capability::Blend, enabled);
+    }
+
+    void StateCacheOpenGL::setBlendFunction(const unsigned int source, const unsigned int destination) {
+        const std::array<unsigned int, 2> blendFunction{ source, destination };
+
+        if (filter(s_blendFunction != blendFunction)) {
+            glBlendFunc(source, destination);
+            s_blendFunction = blendFunction;
+        }
+    }
+
+    void StateCacheOpenGL::setFaceCulling(const bool enabled) {
+        setCapability(Capability::CullFace, enabled);
+    }
+
+    void StateCacheOpenGL::setClearColor(const float red, const float green,
+                                         const float blue, const float alpha) {
+        const std::array<float, 4> color{ red, green, blue, alpha };
+
+        if (filter(!s_clearColorValid || s_clearColor != color)) {
+            glClearColor(red, green, blue, alpha);
+            s_clearColor = color;
+            s_clearColorValid = true;
+        }
+    }
+
+    void StateCacheOpenGL::onProgramDeleted(const unsigned int id) {
+        if (s_program == id) {
+            s_program = s_unknown;
+        }
+    }
+
+    void StateCacheOpenGL::onVertexArrayDeleted(const unsigned int id) {
+        if (s_vertexArray == id) {
+            s_vertexArray = s_unknown;
+        }
+    }
+
+    void StateCacheOpenGL::onBufferDeleted(const unsigned int id) {
+        for (unsigned int &buffer : s_buffers) {
+            if (buffer == id) {
+                buffer = s_unknown;
+            }
+        }
+
+        for (BufferRange &range : s_uniformBindings) {
+            if (range.id == id) {
+                range.id = s_unknown;
+            }
+        }
+    }
+
+    void StateCacheOpenGL::onTextureDeleted(const unsigned int id) {
+        for (unsigned int &texture : s_textures) {
+            if (texture == id) {
+                texture = s_unknown;
+            }
+        }
+    }
+
+    void StateCacheOpenGL::invalidate() {
+        s_program = s_unknown;
+        s_vertexArray = s_unknown;
+        s_buffers.fill(s_unknown);
+        s_textures.fill(s_unknown);
+        s_uniformBindings.fill({ s_unknown, 0, 0 });
+        s_capabilities.fill(-1);
+        s_blendFunction.fill(s_unknown);
+        s_clearColorValid = false;
+    }
+}
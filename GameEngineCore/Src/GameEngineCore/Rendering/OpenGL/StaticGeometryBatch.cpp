@@ -0,0 +1,201 @@
+#include "GameEngineCore/Rendering/OpenGL/StaticGeometryBatch.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+#include "GameEngineCore/Rendering/UniformBlocks.hpp"
+
+#include "GameEngineCore/Log.hpp"
+
+#include "glad/glad.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace GameEngine {
+    StaticGeometryBatch::StaticGeometryBatch(BufferLayout bufferLayout,
+                                             const size_t verticesCapacity,
+                                             const size_t indicesCapacity)
+        : m_vertexBuffer{nullptr, verticesCapacity * bufferLayout.getStride(), bufferLayout},
+          m_indexBuffer{nullptr, indicesCapacity} {
+        m_vertexArray.addVertexBuffer(m_vertexBuffer);
+        m_vertexArray.setIndexBuffer(m_indexBuffer);
+    }
+
+    StaticGeometryBatch::~StaticGeometryBatch() {
+        releaseBuffers();
+    }
+
+    void StaticGeometryBatch::releaseBuffers() {
+        if (m_indirectBufferId != 0) {
+            RendererOpenGL::onBufferReleased(m_indirectBufferSize);
+            StateCacheOpenGL::onBufferDeleted(m_indirectBufferId);
+            glDeleteBuffers(1, &m_indirectBufferId);
+            m_indirectBufferId = 0;
+        }
+
+        if (m_drawDataBufferId != 0) {
+            RendererOpenGL::onBufferReleased(m_drawDataSize);
+            StateCacheOpenGL::onBufferDeleted(m_drawDataBufferId);
+            glDeleteBuffers(1, &m_drawDataBufferId);
+            m_drawDataBufferId = 0;
+        }
+    }
+
+    bool StaticGeometryBatch::addMesh(const void *vertices, const size_t verticesCount,
+                                      const unsigned int *indices, const size_t indicesCount,
+                                      uint32_t &meshId) {
+        const size_t stride = m_vertexBuffer.getLayout().getStride();
+        size_t verticesOffset = 0;
+        size_t firstIndex = 0;
+
+        if (!m_vertexBuffer.allocate(verticesCount * stride, verticesOffset) ||
+            !m_indexBuffer.allocate(indicesCount, firstIndex)) {
+            return false;
+        }
+
+        m_vertexBuffer.setData(vertices, verticesCount * stride, verticesOffset);
+        m_indexBuffer.setData(indices, indicesCount, firstIndex);
+
+        MeshRange mesh;
+        mesh.firstIndex = static_cast<uint32_t>(firstIndex);
+        mesh.indicesCount = static_cast<uint32_t>(indicesCount);
+        mesh.baseVertex = static_cast<int32_t>(verticesOffset / stride);
+
+        meshId = static_cast<uint32_t>(m_meshes.size());
+        m_meshes.push_back(mesh);
+
+        return true;
+    }
+
+    void StaticGeometryBatch::addDraw(const uint32_t meshId, const uint32_t materialId,
+                                      const glm::mat4 &modelMatrix) {
+        m_draws.push_back({ meshId, materialId, modelMatrix });
+    }
+
+    void StaticGeometryBatch::buildIndirectCommands(const std::vector<MeshRange> &meshes,
+                                                    const std::vector<DrawInstance> &draws,
+                                                    std::vector<DrawElementsIndirectCommand> &commands,
+                                                    std::vector<glm::mat4> &drawData,
+                                                    std::vector<MaterialRange> &materialRanges) {
+        commands.clear();
+        drawData.clear();
+        materialRanges.clear();
+
+        std::vector<size_t> order(draws.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&draws](const size_t left, const size_t right) {
+            if (draws[left].materialId != draws[right].materialId) {
+                return draws[left].materialId < draws[right].materialId;
+            }
+
+            return draws[left].meshId < draws[right].meshId;
+        });
+
+        drawData.reserve(draws.size());
+
+        for (const size_t drawIndex : order) {
+            const DrawInstance &draw = draws[drawIndex];
+
+            if (draw.meshId >= meshes.size()) {
+                LOG_ERROR_TO(LogSubsystem::Rendering,
+                             "StaticGeometryBatch: draw references unknown mesh {0}", draw.meshId);
+                continue;
+            }
+
+            if (materialRanges.empty() || materialRanges.back().materialId != draw.materialId) {
+                materialRanges.push_back({ draw.materialId, commands.size(), 0, 0 });
+            }
+
+            const MeshRange &mesh = meshes[draw.meshId];
+            const bool sameMesh = materialRanges.back().commandsCount > 0 &&
+                                  commands.back().firstIndex == mesh.firstIndex &&
+                                  commands.back().count == mesh.indicesCount &&
+                                  commands.back().baseVertex == mesh.baseVertex;
+
+            if (sameMesh) {
+                ++commands.back().instanceCount;
+            } else {
+                commands.push_back({ mesh.indicesCount, 1, mesh.firstIndex, mesh.baseVertex,
+                                     static_cast<uint32_t>(drawData.size()) });
+                ++materialRanges.back().commandsCount;
+            }
+
+            ++materialRanges.back().instancesCount;
+            drawData.push_back(draw.modelMatrix);
+        }
+    }
+
+    bool StaticGeometryBatch::validateIndirectCommands(
+        const std::vector<DrawElementsIndirectCommand> &commands,
+        const size_t indicesCount, const size_t verticesCount, const size_t drawDataCount) {
+        for (const DrawElementsIndirectCommand &command : commands) {
+            const bool isValid = command.count > 0 && command.instanceCount > 0 &&
+                                 size_t{command.firstIndex} + command.count <= indicesCount &&
+                                 command.baseVertex >= 0 &&
+                                 static_cast<size_t>(command.baseVertex) < verticesCount &&
+                                 size_t{command.baseInstance} + command.instanceCount <= drawDataCount;
+
+            if (!isValid) {
+                LOG_ERROR_TO(LogSubsystem::Rendering,
+                             "StaticGeometryBatch: invalid indirect command "
+                             "(count {0}, first index {1}, base vertex {2}, base instance {3})",
+                             command.count, command.firstIndex, command.baseVertex,
+                             command.baseInstance);
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool StaticGeometryBatch::build() {
+        std::vector<glm::mat4> drawData;
+        buildIndirectCommands(m_meshes, m_draws, m_commands, drawData, m_materialRanges);
+
+        const size_t stride = m_vertexBuffer.getLayout().getStride();
+        if (!validateIndirectCommands(m_commands, m_indexBuffer.getUsedCount(),
+                                      m_vertexBuffer.getUsedSize() / stride, drawData.size())) {
+            m_commands.clear();
+            m_materialRanges.clear();
+
+            return false;
+        }
+
+        releaseBuffers();
+
+        if (m_commands.empty()) {
+            return true;
+        }
+
+        m_indirectBufferSize = sizeof(DrawElementsIndirectCommand) * m_commands.size();
+        glCreateBuffers(1, &m_indirectBufferId);
+        glNamedBufferStorage(m_indirectBufferId, static_cast<GLsizeiptr>(m_indirectBufferSize),
+                             m_commands.data(), 0);
+        RendererOpenGL::onBufferAllocated(m_indirectBufferSize);
+
+        m_drawDataSize = sizeof(glm::mat4) * drawData.size();
+        glCreateBuffers(1, &m_drawDataBufferId);
+        glNamedBufferStorage(m_drawDataBufferId, static_cast<GLsizeiptr>(m_drawDataSize),
+                             drawData.data(), 0);
+        RendererOpenGL::onBufferAllocated(m_drawDataSize);
+
+        return true;
+    }
+
+    void StaticGeometryBatch::draw(const uint32_t materialId) const {
+        for (const MaterialRange &range : m_materialRanges) {
+            if (range.materialId != materialId) {
+                continue;
+            }
+
+            StateCacheOpenGL::bindBufferRange(GL_SHADER_STORAGE_BUFFER,
+                                              static_cast<unsigned int>(StorageBlockBinding::DrawData),
+                                              m_drawDataBufferId, 0, m_drawDataSize);
+            RendererOpenGL::multiDrawIndirect(m_vertexArray, m_indirectBufferId,
+                                              range.firstCommand * sizeof(DrawElementsIndirectCommand),
+                                              range.commandsCount, range.instancesCount);
+
+            return;
+        }
+    }
+}
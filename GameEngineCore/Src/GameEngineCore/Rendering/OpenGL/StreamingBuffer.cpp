@@ -0,0 +1,142 @@
+#include "GameEngineCore/Rendering/OpenGL/StreamingBuffer.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+
+#include "GameEngineCore/Log.hpp"
+
+#include "glad/glad.h"
+
+namespace GameEngine {
+    constexpr GLbitfield s_storageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT |
+                                          GL_MAP_COHERENT_BIT;
+
+    StreamingBuffer::StreamingBuffer(const size_t regionSize)
+        : m_regionSize{regionSize} {
+        const GLsizeiptr bufferSize = static_cast<GLsizeiptr>(m_regionSize * s_regionsCount);
+
+        glCreateBuffers(1, &m_id);
+        glNamedBufferStorage(m_id, bufferSize, nullptr, s_storageFlags);
+        RendererOpenGL::onBufferAllocated(m_regionSize * s_regionsCount);
+        m_mappedData = static_cast<unsigned char*>(
+            glMapNamedBufferRange(m_id, 0, bufferSize, s_storageFlags));
+
+        if (m_mappedData == nullptr) {
+            LOG_CRITICAL_TO(LogSubsystem::Rendering,
+                            "StreamingBuffer: failed to map {0} bytes persistently", bufferSize);
+        }
+    }
+
+    StreamingBuffer::~StreamingBuffer() {
+        release();
+    }
+
+    StreamingBuffer &StreamingBuffer::operator=(StreamingBuffer &&streamingBuffer) noexcept {
+        release();
+
+        m_id = streamingBuffer.m_id;
+        m_mappedData = streamingBuffer.m_mappedData;
+        m_regionSize = streamingBuffer.m_regionSize;
+        m_regionOffset = streamingBuffer.m_regionOffset;
+        m_currentRegion = streamingBuffer.m_currentRegion;
+        m_fences = streamingBuffer.m_fences;
+
+        streamingBuffer.m_id = 0;
+        streamingBuffer.m_mappedData = nullptr;
+        streamingBuffer.m_fences.fill(nullptr);
+
+        return *this;
+    }
+
+    StreamingBuffer::StreamingBuffer(StreamingBuffer &&streamingBuffer) noexcept
+        : m_id{streamingBuffer.m_id}, m_mappedData{streamingBuffer.m_mappedData},
+          m_regionSize{streamingBuffer.m_regionSize},
+          m_regionOffset{streamingBuffer.m_regionOffset},
+          m_currentRegion{streamingBuffer.m_currentRegion},
+          m_fences{streamingBuffer.m_fences} {
+        streamingBuffer.m_id = 0;
+        streamingBuffer.m_mappedData = nullptr;
+        streamingBuffer.m_fences.fill(nullptr);
+    }
+
+    void StreamingBuffer::release() {
+        for (void *&fence : m_fences) {
+            if (fence != nullptr) {
+                glDeleteSync(static_cast<GLsync>(fence));
+                fence = nullptr;
+            }
+        }
+
+        if (m_id != 0) {
+            glUnmapNamedBuffer(m_id);
+            RendererOpenGL::onBufferReleased(m_regionSize * s_regionsCount);
+            StateCacheOpenGL::onBufferDeleted(m_id);
+            glDeleteBuffers(1, &m_id);
+        }
+
+        m_id = 0;
+        m_mappedData = nullptr;
+    }
+
+    void StreamingBuffer::waitForRegion(const unsigned int region) {
+        GLsync fence = static_cast<GLsync>(m_fences[region]);
+
+        if (fence == nullptr) {
+            return;
+        }
+
+        GLbitfield waitFlags = 0;
+        GLuint64 timeout = 0;
+
+        while (true) {
+            const GLenum result = glClientWaitSync(fence, waitFlags, timeout);
+
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+                break;
+            }
+
+            if (result == GL_WAIT_FAILED) {
+                LOG_ERROR_TO(LogSubsystem::Rendering, "StreamingBuffer: glClientWaitSync failed");
+                break;
+            }
+
+            waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            timeout = 1000000;
+        }
+
+        glDeleteSync(fence);
+        m_fences[region] = nullptr;
+    }
+
+    void StreamingBuffer::beginFrame() {
+        m_currentRegion = (m_currentRegion + 1) % s_regionsCount;
+        m_regionOffset = 0;
+
+        waitForRegion(m_currentRegion);
+    }
+
+    void StreamingBuffer::endFrame() {
+        if (m_fences[m_currentRegion] != nullptr) {
+            glDeleteSync(static_cast<GLsync>(m_fences[m_currentRegion]));
+        }
+
+        m_fences[m_currentRegion] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    StreamingBuffer::Allocation StreamingBuffer::allocate(const size_t size,
+                                                          const size_t alignment) {
+        const size_t regionBegin = m_currentRegion * m_regionSize;
+        const size_t offset = regionBegin + m_regionOffset;
+        const size_t alignedOffset = (offset + alignment - 1) / alignment * alignment;
+
+        if (m_mappedData == nullptr || alignedOffset + size > regionBegin + m_regionSize) {
+            LOG_ERROR_RATE_LIMITED_TO(LogSubsystem::Rendering, 1000,
+                                      "StreamingBuffer: region overflow, {0} bytes requested", size);
+
+            return {};
+        }
+
+        m_regionOffset = alignedOffset + size - regionBegin;
+
+        return { alignedOffset, m_mappedData + alignedOffset };
+    }
+}
@@ -1,52 +1,232 @@
 #include "GameEngineCore/Rendering/OpenGL/Texture2D.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
 
 #include <algorithm>
-#include <cmath>
 
 #include "glad/glad.h"
 
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#endif
+
 namespace GameEngine {
+    namespace {
+        struct FormatOpenGL {
+            GLenum internalFormat;
+            GLenum format;
+        };
+
+        const FormatOpenGL s_formatsOpenGL[] {
+            { GL_RGB8, GL_RGB },
+            { GL_RGBA8, GL_RGBA },
+            { GL_SRGB8_ALPHA8, GL_RGBA },
+            { GL_R8, GL_RED },
+            { GL_RG8, GL_RG },
+            { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 0 },
+            { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 0 },
+            { GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 0 },
+            { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 0 },
+            { GL_COMPRESSED_RED_RGTC1, 0 },
+            { GL_COMPRESSED_RG_RGTC2, 0 },
+            { GL_COMPRESSED_RGBA_BPTC_UNORM, 0 },
+            { GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, 0 }
+        };
+
+        static_assert(sizeof(s_formatsOpenGL) / sizeof(s_formatsOpenGL[0]) ==
+                      static_cast<size_t>(TextureFormat::FormatsCount));
+
+        const FormatOpenGL &getFormatOpenGL(const TextureFormat format) {
+            return s_formatsOpenGL[static_cast<size_t>(format)];
+        }
+    }
+
     Texture2D::Texture2D(const unsigned char *data,
                          const unsigned int width, const unsigned int height)
-        : m_width{width}, m_height{height} {
+        : m_width{width}, m_height{height},
+          m_levelsCount{computeTextureLevelsCount(width, height)} {
         glCreateTextures(GL_TEXTURE_2D, 1, &m_id);
 
-        const GLsizei mipLevels = static_cast<GLsizei>(std::log2(
-            std::max(m_width, m_height))) + 1;
-
-        glTextureStorage2D(m_id, mipLevels, GL_RGB8, m_width, m_height);
+        glTextureStorage2D(m_id, static_cast<GLsizei>(m_levelsCount), GL_RGB8, m_width, m_height);
         glTextureSubImage2D(m_id, 0, 0, 0, m_width, m_height,
                             GL_RGB, GL_UNSIGNED_BYTE, data);
-        glTextureParameteri(m_id, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTextureParameteri(m_id, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glTextureParameteri(m_id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTextureParameteri(m_id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        setParameters();
         glGenerateTextureMipmap(m_id);
+
+        m_memorySize = getLevelsMemorySize(0);
+
+        RendererOpenGL::onTextureAllocated(m_memorySize);
+    }
+
+    Texture2D::Texture2D(const TextureData &data)
+        : m_format{data.format}, m_width{data.width}, m_height{data.height},
+          m_levelsCount{data.getLevelsCount()} {
+        if (m_levelsCount == 0) {
+            return;
+        }
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_id);
+        glTextureStorage2D(m_id, static_cast<GLsizei>(m_levelsCount),
+                           getFormatOpenGL(m_format).internalFormat, m_width, m_height);
+
+        for (unsigned int level = 0; level < m_levelsCount; ++level) {
+            uploadLevelData(level, data.getLevelData(level));
+        }
+
+        setParameters();
+
+        m_memorySize = getLevelsMemorySize(0);
+
+        RendererOpenGL::onTextureAllocated(m_memorySize);
+    }
+
+    Texture2D::Texture2D(const unsigned int width, const unsigned int height,
+                         const TextureFormat format)
+        : m_format{format}, m_width{width}, m_height{height},
+          m_levelsCount{computeTextureLevelsCount(width, height)},
+          m_residentTopLevel{m_levelsCount} {
     }
 
     Texture2D::~Texture2D() {
-        glDeleteTextures(1, &m_id);
+        release();
+    }
+
+    void Texture2D::release() {
+        if (m_id != 0) {
+            RendererOpenGL::onTextureReleased(m_memorySize);
+            StateCacheOpenGL::onTextureDeleted(m_id);
+            glDeleteTextures(1, &m_id);
+        }
+
+        m_id = 0;
+        m_memorySize = 0;
     }
 
     Texture2D &Texture2D::operator=(Texture2D &&texture) noexcept {
-        glDeleteTextures(1, &m_id);
+        release();
 
         m_id = texture.m_id;
+        m_format = texture.m_format;
         m_width = texture.m_width;
         m_height = texture.m_height;
+        m_levelsCount = texture.m_levelsCount;
+        m_residentTopLevel = texture.m_residentTopLevel;
+        m_memorySize = texture.m_memorySize;
         texture.m_id = 0;
+        texture.m_memorySize = 0;
 
         return *this;
     }
 
     Texture2D::Texture2D(Texture2D &&texture) noexcept {
         m_id = texture.m_id;
+        m_format = texture.m_format;
         m_width = texture.m_width;
         m_height = texture.m_height;
+        m_levelsCount = texture.m_levelsCount;
+        m_residentTopLevel = texture.m_residentTopLevel;
+        m_memorySize = texture.m_memorySize;
         texture.m_id = 0;
+        texture.m_memorySize = 0;
+    }
+
+    void Texture2D::setParameters() {
+        glTextureParameteri(m_id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(m_id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureParameteri(m_id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTextureParameteri(m_id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    }
+
+    void Texture2D::setResidentTopLevel(const unsigned int topLevel) {
+        if (topLevel >= m_levelsCount) {
+            release();
+            m_residentTopLevel = m_levelsCount;
+
+            return;
+        }
+
+        if (m_id != 0 && topLevel == m_residentTopLevel) {
+            return;
+        }
+
+        GLuint id = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &id);
+        glTextureStorage2D(id, static_cast<GLsizei>(m_levelsCount - topLevel),
+                           getFormatOpenGL(m_format).internalFormat,
+                           getTextureLevelSize(m_width, topLevel), getTextureLevelSize(m_height, topLevel));
+
+        if (m_id != 0) {
+            for (unsigned int level = std::max(topLevel, m_residentTopLevel); level < m_levelsCount; ++level) {
+                glCopyImageSubData(m_id, GL_TEXTURE_2D, static_cast<GLint>(level - m_residentTopLevel), 0, 0, 0,
+                                   id, GL_TEXTURE_2D, static_cast<GLint>(level - topLevel), 0, 0, 0,
+                                   getTextureLevelSize(m_width, level), getTextureLevelSize(m_height, level), 1);
+            }
+        }
+
+        release();
+
+        m_id = id;
+        m_residentTopLevel = topLevel;
+        m_memorySize = getLevelsMemorySize(topLevel);
+        setParameters();
+
+        RendererOpenGL::onTextureAllocated(m_memorySize);
+    }
+
+    void Texture2D::uploadLevel(const unsigned int level, const unsigned int pixelBufferId,
+                                const size_t offset) {
+        if (m_id == 0 || level < m_residentTopLevel || level >= m_levelsCount) {
+            return;
+        }
+
+        StateCacheOpenGL::bindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBufferId);
+        uploadLevelData(level, reinterpret_cast<const void*>(offset));
+    }
+
+    void Texture2D::uploadLevelData(const unsigned int level, const void *data) {
+        const GLint storageLevel = static_cast<GLint>(level - m_residentTopLevel);
+        const GLsizei width = static_cast<GLsizei>(getTextureLevelSize(m_width, level));
+        const GLsizei height = static_cast<GLsizei>(getTextureLevelSize(m_height, level));
+        const FormatOpenGL &format = getFormatOpenGL(m_format);
+
+        if (getTextureFormatInfo(m_format).isCompressed) {
+            glCompressedTextureSubImage2D(m_id, storageLevel, 0, 0, width, height, format.internalFormat,
+                                          static_cast<GLsizei>(getLevelMemorySize(level)), data);
+        } else {
+            glTextureSubImage2D(m_id, storageLevel, 0, 0, width, height,
+                                format.format, GL_UNSIGNED_BYTE, data);
+        }
+    }
+
+    bool Texture2D::takeUsed() const {
+        const bool isUsed = m_isUsed;
+        m_isUsed = false;
+
+        return isUsed;
     }
 
     void Texture2D::bind(const unsigned int unit) const {
-        glBindTextureUnit(unit, m_id);
+        m_isUsed = true;
+        StateCacheOpenGL::bindTextureUnit(unit, m_id);
+    }
+
+    size_t Texture2D::getLevelMemorySize(const unsigned int level) const {
+        return getTextureLevelMemorySize(m_format, m_width, m_height, level);
+    }
+
+    size_t Texture2D::getLevelsMemorySize(const unsigned int topLevel) const {
+        size_t memorySize = 0;
+
+        for (unsigned int level = topLevel; level < m_levelsCount; ++level) {
+            memorySize += getLevelMemorySize(level);
+        }
+
+        return memorySize;
     }
 }
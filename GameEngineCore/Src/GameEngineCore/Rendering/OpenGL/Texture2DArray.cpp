@@ -0,0 +1,126 @@
+#include "GameEngineCore/Rendering/OpenGL/Texture2DArray.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+
+#include "GameEngineCore/Log.hpp"
+
+#include <algorithm>
+
+#include "glad/glad.h"
+
+namespace GameEngine {
+    namespace {
+        struct FormatOpenGL {
+            GLenum internalFormat;
+            GLenum format;
+        };
+
+        bool getFormatOpenGL(const TextureFormat format, FormatOpenGL &formatOpenGL) {
+            switch (format) {
+                case TextureFormat::RGB8: formatOpenGL = { GL_RGB8, GL_RGB }; return true;
+                case TextureFormat::RGBA8: formatOpenGL = { GL_RGBA8, GL_RGBA }; return true;
+                case TextureFormat::SRGB8_ALPHA8: formatOpenGL = { GL_SRGB8_ALPHA8, GL_RGBA }; return true;
+                case TextureFormat::R8: formatOpenGL = { GL_R8, GL_RED }; return true;
+                case TextureFormat::RG8: formatOpenGL = { GL_RG8, GL_RG }; return true;
+                default: return false;
+            }
+        }
+    }
+
+    Texture2DArray::Texture2DArray(const unsigned int width, const unsigned int height,
+                                   const unsigned int layersCount, const unsigned int levelsCount,
+                                   const TextureFormat format)
+        : m_format{format}, m_width{width}, m_height{height}, m_layersCount{layersCount},
+          m_levelsCount{std::min(std::max(levelsCount, 1u), computeTextureLevelsCount(width, height))} {
+        FormatOpenGL formatOpenGL{};
+
+        if (!getFormatOpenGL(m_format, formatOpenGL)) {
+            LOG_ERROR_TO(LogSubsystem::Rendering, "Texture2DArray does not support {} storage",
+                         getTextureFormatInfo(m_format).name);
+
+            return;
+        }
+
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_id);
+        glTextureStorage3D(m_id, static_cast<GLsizei>(m_levelsCount), formatOpenGL.internalFormat,
+                           static_cast<GLsizei>(m_width), static_cast<GLsizei>(m_height),
+                           static_cast<GLsizei>(m_layersCount));
+        glTextureParameteri(m_id, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_id, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_id, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTextureParameteri(m_id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        for (unsigned int level = 0; level < m_levelsCount; ++level) {
+            m_memorySize += getTextureLevelMemorySize(m_format, m_width, m_height, level) * m_layersCount;
+        }
+
+        RendererOpenGL::onTextureAllocated(m_memorySize);
+    }
+
+    Texture2DArray::~Texture2DArray() {
+        release();
+    }
+
+    void Texture2DArray::release() {
+        if (m_id != 0) {
+            RendererOpenGL::onTextureReleased(m_memorySize);
+            StateCacheOpenGL::onTextureDeleted(m_id);
+            glDeleteTextures(1, &m_id);
+        }
+
+        m_id = 0;
+        m_memorySize = 0;
+    }
+
+    Texture2DArray &Texture2DArray::operator=(Texture2DArray &&textureArray) noexcept {
+        release();
+
+        m_id = textureArray.m_id;
+        m_format = textureArray.m_format;
+        m_width = textureArray.m_width;
+        m_height = textureArray.m_height;
+        m_layersCount = textureArray.m_layersCount;
+        m_levelsCount = textureArray.m_levelsCount;
+        m_memorySize = textureArray.m_memorySize;
+        textureArray.m_id = 0;
+        textureArray.m_memorySize = 0;
+
+        return *this;
+    }
+
+    Texture2DArray::Texture2DArray(Texture2DArray &&textureArray) noexcept {
+        m_id = textureArray.m_id;
+        m_format = textureArray.m_format;
+        m_width = textureArray.m_width;
+        m_height = textureArray.m_height;
+        m_layersCount = textureArray.m_layersCount;
+        m_levelsCount = textureArray.m_levelsCount;
+        m_memorySize = textureArray.m_memorySize;
+        textureArray.m_id = 0;
+        textureArray.m_memorySize = 0;
+    }
+
+    void Texture2DArray::uploadRegion(const unsigned int layer, const unsigned int x, const unsigned int y,
+                                      const unsigned int width, const unsigned int height, const void *data) {
+        FormatOpenGL formatOpenGL{};
+
+        if (m_id == 0 || layer >= m_layersCount || x + width > m_width || y + height > m_height ||
+            !getFormatOpenGL(m_format, formatOpenGL)) {
+            return;
+        }
+
+        glTextureSubImage3D(m_id, 0, static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLint>(layer),
+                            static_cast<GLsizei>(width), static_cast<GLsizei>(height), 1,
+                            formatOpenGL.format, GL_UNSIGNED_BYTE, data);
+    }
+
+    void Texture2DArray::generateMipmaps() {
+        if (m_id != 0 && m_levelsCount > 1) {
+            glGenerateTextureMipmap(m_id);
+        }
+    }
+
+    void Texture2DArray::bind(const unsigned int unit) const {
+        StateCacheOpenGL::bindTextureUnit(unit, m_id);
+    }
+}
@@ -0,0 +1,127 @@
+#include "GameEngineCore/Rendering/OpenGL/TextureAtlas.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+#include "GameEngineCore/Rendering/UniformBlocks.hpp"
+
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "glad/glad.h"
+
+namespace GameEngine {
+    namespace {
+        TextureAtlasPacker::Settings makePackerSettings(const TextureAtlas::Settings &settings) {
+            const unsigned int levelsCount = std::min(std::max(settings.levelsCount, 1u),
+                                                      computeTextureLevelsCount(settings.layerSize, settings.layerSize));
+
+            TextureAtlasPacker::Settings packerSettings;
+            packerSettings.layerWidth = settings.layerSize;
+            packerSettings.layerHeight = settings.layerSize;
+            packerSettings.maxLayersCount = settings.layersCount;
+            packerSettings.alignment = 1u << (levelsCount - 1);
+            packerSettings.padding = packerSettings.alignment;
+
+            return packerSettings;
+        }
+    }
+
+    TextureAtlas::TextureAtlas(const Settings &settings)
+        : m_packer{makePackerSettings(settings)},
+          m_texture{settings.layerSize, settings.layerSize, settings.layersCount,
+                    settings.levelsCount, settings.format} {
+    }
+
+    TextureAtlas::~TextureAtlas() {
+        if (m_regionsBufferId != 0) {
+            RendererOpenGL::onBufferReleased(m_regionsBufferSize);
+            StateCacheOpenGL::onBufferDeleted(m_regionsBufferId);
+            glDeleteBuffers(1, &m_regionsBufferId);
+        }
+    }
+
+    uint32_t TextureAtlas::add(const unsigned char *pixels, const unsigned int width, const unsigned int height) {
+        TextureAtlasPacker::Placement placement;
+
+        if (pixels == nullptr || m_texture.getId() == 0 || !m_packer.pack(width, height, placement)) {
+            return s_invalidRegion;
+        }
+
+        const size_t texelSize = getTextureFormatInfo(m_texture.getFormat()).bytesPerBlock;
+        const unsigned int gutter = m_packer.getSettings().padding;
+        const unsigned int paddedWidth = width + 2 * gutter;
+        const unsigned int paddedHeight = height + 2 * gutter;
+
+        m_scratch.resize(size_t{paddedWidth} * paddedHeight * texelSize);
+
+        for (unsigned int y = 0; y < paddedHeight; ++y) {
+            const unsigned int sourceY = std::min(std::max(y, gutter) - gutter, height - 1);
+            const unsigned char *sourceRow = pixels + size_t{sourceY} * width * texelSize;
+            unsigned char *row = m_scratch.data() + size_t{y} * paddedWidth * texelSize;
+
+            for (unsigned int x = 0; x < gutter; ++x) {
+                std::memcpy(row + x * texelSize, sourceRow, texelSize);
+                std::memcpy(row + (gutter + width + x) * texelSize, sourceRow + (width - 1) * texelSize, texelSize);
+            }
+
+            std::memcpy(row + gutter * texelSize, sourceRow, width * texelSize);
+        }
+
+        m_texture.uploadRegion(placement.layer, placement.x - gutter, placement.y - gutter,
+                               paddedWidth, paddedHeight, m_scratch.data());
+
+        const float layerWidth = static_cast<float>(m_texture.getWidth());
+        const float layerHeight = static_cast<float>(m_texture.getHeight());
+
+        AtlasRegion region;
+        region.uvScaleOffset = glm::vec4(static_cast<float>(width) / layerWidth,
+                                         static_cast<float>(height) / layerHeight,
+                                         static_cast<float>(placement.x) / layerWidth,
+                                         static_cast<float>(placement.y) / layerHeight);
+        region.layer = placement.layer;
+
+        m_regions.push_back(region);
+        m_isDirty = true;
+
+        return static_cast<uint32_t>(m_regions.size() - 1);
+    }
+
+    void TextureAtlas::update() {
+        if (!m_isDirty) {
+            return;
+        }
+
+        PROFILE_SCOPE("TextureAtlas::update");
+
+        m_texture.generateMipmaps();
+
+        const size_t size = sizeof(AtlasRegion) * m_regions.size();
+
+        if (size > m_regionsBufferSize) {
+            if (m_regionsBufferId != 0) {
+                RendererOpenGL::onBufferReleased(m_regionsBufferSize);
+                StateCacheOpenGL::onBufferDeleted(m_regionsBufferId);
+                glDeleteBuffers(1, &m_regionsBufferId);
+            }
+
+            m_regionsBufferSize = std::max(size, m_regionsBufferSize * 2);
+            glCreateBuffers(1, &m_regionsBufferId);
+            glNamedBufferData(m_regionsBufferId, static_cast<GLsizeiptr>(m_regionsBufferSize), nullptr, GL_DYNAMIC_DRAW);
+            RendererOpenGL::onBufferAllocated(m_regionsBufferSize);
+        }
+
+        glNamedBufferSubData(m_regionsBufferId, 0, static_cast<GLsizeiptr>(size), m_regions.data());
+        m_isDirty = false;
+    }
+
+    void TextureAtlas::bind(const unsigned int unit) const {
+        m_texture.bind(unit);
+
+        if (m_regionsBufferId != 0) {
+            StateCacheOpenGL::bindBufferRange(GL_SHADER_STORAGE_BUFFER,
+                                              static_cast<unsigned int>(StorageBlockBinding::AtlasRegions),
+                                              m_regionsBufferId, 0, m_regionsBufferSize);
+        }
+    }
+}
@@ -0,0 +1,256 @@
+#include "GameEngineCore/Rendering/OpenGL/TextureStreamer.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/TextureCompression.hpp"
+
+#include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "glad/glad.h"
+
+namespace GameEngine {
+    constexpr size_t s_bytesPerPixel = 3;
+    constexpr size_t s_stagingAlignment = 16;
+
+    static size_t alignStaging(const size_t size) {
+        return (size + s_stagingAlignment - 1) / s_stagingAlignment * s_stagingAlignment;
+    }
+
+    TextureStreamer::TextureStreamer(const Settings &settings)
+        : m_settings{settings}, m_stagingBuffer{settings.stagingRegionSize} {
+    }
+
+    TextureStreamer::~TextureStreamer() {
+        for (Entry *entry : m_entries) {
+            JobSystem::wait(entry->decodeCounter);
+            m_entryPool.destroy(entry);
+        }
+
+        StateCacheOpenGL::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    Texture2D *TextureStreamer::request(const unsigned int width, const unsigned int height,
+                                        const DecodeFunction decode, void *userData) {
+        if (decode == nullptr || width == 0 || height == 0) {
+            return nullptr;
+        }
+
+        Entry *pooledEntry = m_entryPool.create(width, height);
+
+        if (pooledEntry == nullptr) {
+            return nullptr;
+        }
+
+        m_entries.push_back(pooledEntry);
+        Entry &entry = *pooledEntry;
+        entry.decode = decode;
+        entry.userData = userData;
+        entry.lastUsedFrame = m_frameIndex;
+
+        const unsigned int levelsCount = entry.texture.getLevelsCount();
+        size_t pixelsSize = 0;
+
+        for (unsigned int level = 0; level < levelsCount; ++level) {
+            entry.levelOffsets[level] = pixelsSize;
+            pixelsSize += entry.texture.getLevelMemorySize(level);
+        }
+
+        entry.pixels.resize(pixelsSize);
+
+        if (entry.texture.getLevelMemorySize(0) > m_settings.stagingRegionSize) {
+            LOG_WARNING_TO(LogSubsystem::Rendering,
+                           "TextureStreamer: {0}x{1} texture exceeds the staging region, top mips will not stream",
+                           width, height);
+        }
+
+        JobSystem::run(decodeJob, &entry, entry.decodeCounter);
+
+        return &entry.texture;
+    }
+
+    void TextureStreamer::decodeJob(void *data, const size_t, const size_t) {
+        PROFILE_SCOPE("TextureStreamer::decode");
+
+        Entry &entry = *static_cast<Entry*>(data);
+        const unsigned int width = entry.texture.getWidth();
+        const unsigned int height = entry.texture.getHeight();
+
+        entry.decode(entry.userData, entry.pixels.data(), width, height);
+
+        for (unsigned int level = 1; level < entry.texture.getLevelsCount(); ++level) {
+            downsampleImage(entry.pixels.data() + entry.levelOffsets[level - 1],
+                            getTextureLevelSize(width, level - 1), getTextureLevelSize(height, level - 1),
+                            entry.pixels.data() + entry.levelOffsets[level],
+                            getTextureLevelSize(width, level), getTextureLevelSize(height, level),
+                            s_bytesPerPixel);
+        }
+    }
+
+    void TextureStreamer::update() {
+        PROFILE_SCOPE("TextureStreamer::update");
+
+        ++m_frameIndex;
+        m_streamOrder.clear();
+        m_statistics.pendingDecodesCount = 0;
+
+        bool canDecodeHere = JobSystem::getWorkersCount() == 1;
+
+        for (Entry *entry : m_entries) {
+            // Without worker threads queued decodes only run when this thread waits on them.
+            if (canDecodeHere && !entry->isDecoded && !entry->decodeCounter.isDone()) {
+                JobSystem::wait(entry->decodeCounter);
+                canDecodeHere = false;
+            }
+
+            if (entry->texture.takeUsed()) {
+                entry->lastUsedFrame = m_frameIndex;
+            }
+
+            if (!entry->isDecoded) {
+                entry->isDecoded = entry->decodeCounter.isDone();
+            }
+
+            if (!entry->isDecoded) {
+                ++m_statistics.pendingDecodesCount;
+            } else if (entry->texture.getResidentTopLevel() > 0) {
+                m_streamOrder.push_back(entry);
+            }
+        }
+
+        while (m_statistics.residentBytes > m_settings.memoryBudget &&
+               evictLeastRecentlyUsed(std::numeric_limits<uint64_t>::max())) {
+        }
+
+        std::sort(m_streamOrder.begin(), m_streamOrder.end(),
+                  [](const Entry *left, const Entry *right) {
+                      return left->lastUsedFrame > right->lastUsedFrame;
+                  });
+
+        size_t stagingBytes = 0;
+
+        if (!m_streamOrder.empty()) {
+            m_stagingBuffer.beginFrame();
+
+            for (Entry *entry : m_streamOrder) {
+                streamIn(*entry, stagingBytes);
+            }
+
+            m_stagingBuffer.endFrame();
+        }
+
+        if (stagingBytes > 0) {
+            StateCacheOpenGL::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+
+        m_statistics.memoryBudget = m_settings.memoryBudget;
+        m_statistics.texturesCount = m_entries.size();
+        m_statistics.fullyResidentCount = static_cast<size_t>(std::count_if(
+            m_entries.begin(), m_entries.end(), [](const Entry *entry) {
+                return entry->texture.isResident() && entry->texture.getResidentTopLevel() == 0;
+            }));
+    }
+
+    void TextureStreamer::streamIn(Entry &entry, size_t &stagingBytes) {
+        Texture2D &texture = entry.texture;
+        const unsigned int residentTopLevel = texture.getResidentTopLevel();
+        unsigned int topLevel = residentTopLevel;
+
+        while (topLevel > 0) {
+            const size_t levelSize = texture.getLevelMemorySize(topLevel - 1);
+
+            if (stagingBytes + alignStaging(levelSize) > m_settings.stagingRegionSize ||
+                !reserve(levelSize, entry.lastUsedFrame)) {
+                break;
+            }
+
+            stagingBytes += alignStaging(levelSize);
+            --topLevel;
+        }
+
+        if (topLevel == residentTopLevel) {
+            return;
+        }
+
+        texture.setResidentTopLevel(topLevel);
+
+        for (unsigned int level = topLevel; level < residentTopLevel; ++level) {
+            const size_t levelSize = texture.getLevelMemorySize(level);
+            const StreamingBuffer::Allocation allocation = m_stagingBuffer.allocate(levelSize, s_stagingAlignment);
+
+            if (!allocation.isValid()) {
+                break;
+            }
+
+            std::memcpy(allocation.data, entry.pixels.data() + entry.levelOffsets[level], levelSize);
+            texture.uploadLevel(level, m_stagingBuffer.getId(), allocation.offset);
+
+            ++m_statistics.uploadsCount;
+            m_statistics.uploadedBytes += levelSize;
+        }
+    }
+
+    bool TextureStreamer::reserve(const size_t size, const uint64_t usedBefore) {
+        if (m_statistics.residentBytes + size > m_settings.memoryBudget) {
+            size_t evictableBytes = 0;
+
+            for (Entry *entry : m_entries) {
+                const Texture2D &texture = entry->texture;
+
+                if (texture.isResident() && entry->lastUsedFrame < usedBefore) {
+                    evictableBytes += texture.getMemorySize() -
+                                      texture.getLevelMemorySize(texture.getLevelsCount() - 1);
+                }
+            }
+
+            // Evicting without freeing enough would only let the victims stream back in.
+            if (m_statistics.residentBytes + size > m_settings.memoryBudget + evictableBytes) {
+                return false;
+            }
+        }
+
+        while (m_statistics.residentBytes + size > m_settings.memoryBudget) {
+            if (!evictLeastRecentlyUsed(usedBefore)) {
+                return false;
+            }
+        }
+
+        m_statistics.residentBytes += size;
+
+        return true;
+    }
+
+    bool TextureStreamer::evictLeastRecentlyUsed(const uint64_t usedBefore) {
+        Entry *victim = nullptr;
+
+        for (Entry *entry : m_entries) {
+            const Texture2D &texture = entry->texture;
+
+            if (!texture.isResident() || texture.getResidentTopLevel() + 1 >= texture.getLevelsCount() ||
+                entry->lastUsedFrame >= usedBefore) {
+                continue;
+            }
+
+            if (victim == nullptr || entry->lastUsedFrame < victim->lastUsedFrame ||
+                (entry->lastUsedFrame == victim->lastUsedFrame &&
+                 texture.getMemorySize() > victim->texture.getMemorySize())) {
+                victim = entry;
+            }
+        }
+
+        if (victim == nullptr) {
+            return false;
+        }
+
+        Texture2D &texture = victim->texture;
+        const unsigned int topLevel = texture.getResidentTopLevel();
+
+        m_statistics.residentBytes -= texture.getLevelMemorySize(topLevel);
+        ++m_statistics.evictionsCount;
+        texture.setResidentTopLevel(topLevel + 1);
+
+        return true;
+    }
+}
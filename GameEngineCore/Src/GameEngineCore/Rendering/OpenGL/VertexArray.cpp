@@ -1,60 +1,101 @@
 #include "GameEngineCore/Rendering/OpenGL/VertexArray.hpp"
 
 #include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StreamingBuffer.hpp"
 
 #include "glad/glad.h"
 
 namespace GameEngine {
     VertexArray::VertexArray() {
-        glGenVertexArrays(1, &m_id);
+        glCreateVertexArrays(1, &m_id);
     }
 
     VertexArray::~VertexArray() {
-        glDeleteVertexArrays(1, &m_id);
+        release();
+    }
+
+    void VertexArray::release() {
+        if (m_id != 0) {
+            StateCacheOpenGL::onVertexArrayDeleted(m_id);
+            glDeleteVertexArrays(1, &m_id);
+        }
+
+        m_id = 0;
     }
 
     VertexArray &VertexArray::operator=(VertexArray &&vertexArray) noexcept {
+        if (this == &vertexArray) {
+            return *this;
+        }
+
+        release();
+
         m_id = vertexArray.m_id;
-        m_elementsCount = vertexArray.m_id;
+        m_elementsCount = vertexArray.m_elementsCount;
+        m_buffersCount = vertexArray.m_buffersCount;
+        m_indicesCount = vertexArray.m_indicesCount;
         vertexArray.m_id = 0;
         vertexArray.m_elementsCount = 0;
+        vertexArray.m_buffersCount = 0;
+        vertexArray.m_indicesCount = 0;
 
         return *this;
     }
 
     VertexArray::VertexArray(VertexArray &&vertexArray) noexcept
-        : m_id(vertexArray.m_id), m_elementsCount(vertexArray.m_elementsCount) {
+        : m_id(vertexArray.m_id), m_elementsCount(vertexArray.m_elementsCount),
+          m_buffersCount(vertexArray.m_buffersCount),
+          m_indicesCount(vertexArray.m_indicesCount) {
         vertexArray.m_id = 0;
         vertexArray.m_elementsCount = 0;
+        vertexArray.m_buffersCount = 0;
+        vertexArray.m_indicesCount = 0;
     }
 
     void VertexArray::bind() const {
-        glBindVertexArray(m_id);
+        StateCacheOpenGL::bindVertexArray(m_id);
     }
 
     void VertexArray::unbind() {
-        glBindVertexArray(0);
+        StateCacheOpenGL::bindVertexArray(0);
     }
 
     void VertexArray::addVertexBuffer(const VertexBuffer &vertexBuffer) {
-        bind();
-        vertexBuffer.bind();
-
-        for (const BufferElement &currentElement : vertexBuffer.getLayout().getElements()) {
-            glEnableVertexAttribArray(m_elementsCount);
-            glVertexAttribPointer(m_elementsCount,
-                                  static_cast<GLint>(currentElement.m_componentsCount),
-                                  currentElement.m_componentType, GL_FALSE,
-                                  static_cast<GLsizei>(vertexBuffer.getLayout().getStride()),
-                                  reinterpret_cast<const void*>(currentElement.m_offset));
-
-            ++m_elementsCount;
+        attachBuffer(vertexBuffer.getId(), vertexBuffer.getLayout());
+    }
+
+    void VertexArray::addVertexBuffer(const StreamingBuffer &streamingBuffer,
+                                      const BufferLayout &layout) {
+        attachBuffer(streamingBuffer.getId(), layout);
+    }
+
+    void VertexArray::attachBuffer(const unsigned int bufferId, const BufferLayout &layout) {
+        const GLuint bindingIndex = m_buffersCount++;
+
+        glVertexArrayVertexBuffer(m_id, bindingIndex, bufferId, 0,
+                                  static_cast<GLsizei>(layout.getStride()));
+        glVertexArrayBindingDivisor(m_id, bindingIndex, layout.getInstanceDivisor());
+
+        for (const BufferElement &currentElement : layout) {
+            const size_t columnSize = currentElement.m_size / currentElement.m_columnsCount;
+
+            for (size_t column = 0; column < currentElement.m_columnsCount; ++column) {
+                glEnableVertexArrayAttrib(m_id, m_elementsCount);
+                glVertexArrayAttribFormat(m_id, m_elementsCount,
+                                          static_cast<GLint>(currentElement.m_componentsCount),
+                                          currentElement.m_componentType, GL_FALSE,
+                                          static_cast<GLuint>(currentElement.m_offset +
+                                                              column * columnSize));
+                glVertexArrayAttribBinding(m_id, m_elementsCount, bindingIndex);
+
+                ++m_elementsCount;
+            }
         }
     }
 
     void VertexArray::setIndexBuffer(const IndexBuffer &indexBuffer) {
-        bind();
-        indexBuffer.bind();
+        glVertexArrayElementBuffer(m_id, indexBuffer.getId());
         m_indicesCount = indexBuffer.getCount();
     }
 }
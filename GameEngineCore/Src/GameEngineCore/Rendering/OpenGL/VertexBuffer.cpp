@@ -1,5 +1,7 @@
 #include "GameEngineCore/Rendering/OpenGL/VertexBuffer.hpp"
 #include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Rendering/OpenGL/StateCacheOpenGL.hpp"
+#include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
 
 #include "glad/glad.h"
 
@@ -16,18 +18,33 @@ namespace GameEngine {
 
             case ShaderDataType::Float3:
             case ShaderDataType::Int3:
+            case ShaderDataType::Mat3:
                 return 3;
 
             case ShaderDataType::Float4:
             case ShaderDataType::Int4:
+            case ShaderDataType::Mat4:
                 return 4;
         }
 
-        LOG_ERROR("shaderDataTypeToComponentType: unknown ShaderDataType!");
+        LOG_ERROR_TO(LogSubsystem::Rendering, "shaderDataTypeToComponentType: unknown ShaderDataType!");
 
         return 0;
     }
 
+    constexpr unsigned int shaderDataTypeToColumnsCount(const ShaderDataType type) {
+        switch (type) {
+            case ShaderDataType::Mat3:
+                return 3;
+
+            case ShaderDataType::Mat4:
+                return 4;
+
+            default:
+                return 1;
+        }
+    }
+
     constexpr size_t shaderDataTypeSize(const ShaderDataType type) {
         switch (type) {
             case ShaderDataType::Float:
@@ -36,6 +53,11 @@ namespace GameEngine {
             case ShaderDataType::Float4:
                 return sizeof(GLfloat) * shaderDataTypeToComponentsCount(type);
 
+            case ShaderDataType::Mat3:
+            case ShaderDataType::Mat4:
+                return sizeof(GLfloat) * shaderDataTypeToComponentsCount(type) *
+                    shaderDataTypeToColumnsCount(type);
+
             case ShaderDataType::Int:
             case ShaderDataType::Int2:
             case ShaderDataType::Int3:
@@ -43,7 +65,7 @@ namespace GameEngine {
                 return sizeof(GLint) * shaderDataTypeToComponentsCount(type);
         }
 
-        LOG_ERROR("shaderDataTypeSize: unknown ShaderDataType!");
+        LOG_ERROR_TO(LogSubsystem::Rendering, "shaderDataTypeSize: unknown ShaderDataType!");
 
         return 0;
     }
@@ -54,6 +76,8 @@ namespace GameEngine {
             case ShaderDataType::Float2:
             case ShaderDataType::Float3:
             case ShaderDataType::Float4:
+            case ShaderDataType::Mat3:
+            case ShaderDataType::Mat4:
                 return GL_FLOAT;
 
             case ShaderDataType::Int:
@@ -63,7 +87,7 @@ namespace GameEngine {
                 return GL_INT;
         }
 
-        LOG_ERROR("shaderDataTypeToComponentType: unknown ShaderDataType!");
+        LOG_ERROR_TO(LogSubsystem::Rendering, "shaderDataTypeToComponentType: unknown ShaderDataType!");
 
         return GL_FLOAT;
     }
@@ -75,7 +99,7 @@ namespace GameEngine {
             case VertexBuffer::TypeDrawUsage::Stream: return GL_STREAM_DRAW;
         }
 
-        LOG_ERROR("Unknown VertexBuffer usage");
+        LOG_ERROR_TO(LogSubsystem::Rendering, "Unknown VertexBuffer usage");
 
         return GL_STREAM_DRAW;
     }
@@ -83,39 +107,106 @@ namespace GameEngine {
     BufferElement::BufferElement(const ShaderDataType type)
         : m_type{type}, m_componentType{shaderDataTypeToComponentType(type)},
           m_componentsCount{shaderDataTypeToComponentsCount(type)},
+          m_columnsCount{shaderDataTypeToColumnsCount(type)},
           m_size{shaderDataTypeSize(type)},
           m_offset{0} {}
 
+    BufferLayout::BufferLayout(std::initializer_list<BufferElement> elements,
+                               const unsigned int instanceDivisor)
+        : m_instanceDivisor{instanceDivisor} {
+        if (elements.size() > s_maxElements) {
+            LOG_ERROR_TO(LogSubsystem::Rendering,
+                         "BufferLayout: {0} elements requested, only {1} are supported",
+                         elements.size(), s_maxElements);
+        }
+
+        for (const BufferElement &element : elements) {
+            if (m_elementsCount == s_maxElements) {
+                break;
+            }
+
+            BufferElement &currentElement = m_elements[m_elementsCount++];
+            currentElement = element;
+            currentElement.m_offset = m_stride;
+            m_stride += currentElement.m_size;
+        }
+    }
+
     VertexBuffer::VertexBuffer(const void *data, const size_t size,
                                 BufferLayout bufferLayout, const TypeDrawUsage usage)
-        : m_bufferLayout{std::move(bufferLayout)} {
-        glGenBuffers(1, &m_id);
-        glBindBuffer(GL_ARRAY_BUFFER, m_id);
-        glBufferData(GL_ARRAY_BUFFER, size, data, usageToGLenum(usage));
+        : m_bufferLayout{std::move(bufferLayout)}, m_capacity{size},
+          m_usedSize{data != nullptr ? size : 0} {
+        glCreateBuffers(1, &m_id);
+        glNamedBufferData(m_id, static_cast<GLsizeiptr>(size), data, usageToGLenum(usage));
+        RendererOpenGL::onBufferAllocated(m_capacity);
     }
 
     VertexBuffer::~VertexBuffer() {
-        glDeleteBuffers(1, &m_id);
+        release();
+    }
+
+    void VertexBuffer::release() {
+        if (m_id != 0) {
+            RendererOpenGL::onBufferReleased(m_capacity);
+            StateCacheOpenGL::onBufferDeleted(m_id);
+            glDeleteBuffers(1, &m_id);
+        }
+
+        m_id = 0;
     }
 
     VertexBuffer &VertexBuffer::operator=(VertexBuffer &&vertexBuffer) noexcept {
+        if (this == &vertexBuffer) {
+            return *this;
+        }
+
+        release();
+
         m_id = vertexBuffer.m_id;
+        m_bufferLayout = std::move(vertexBuffer.m_bufferLayout);
+        m_capacity = vertexBuffer.m_capacity;
+        m_usedSize = vertexBuffer.m_usedSize;
         vertexBuffer.m_id = 0;
+        vertexBuffer.m_capacity = 0;
+        vertexBuffer.m_usedSize = 0;
 
         return *this;
     }
 
     VertexBuffer::VertexBuffer(VertexBuffer &&vertexBuffer) noexcept
         : m_id{vertexBuffer.m_id},
-          m_bufferLayout{std::move(vertexBuffer.m_bufferLayout)} {
+          m_bufferLayout{std::move(vertexBuffer.m_bufferLayout)},
+          m_capacity{vertexBuffer.m_capacity}, m_usedSize{vertexBuffer.m_usedSize} {
         vertexBuffer.m_id = 0;
+        vertexBuffer.m_capacity = 0;
+        vertexBuffer.m_usedSize = 0;
     }
 
     void VertexBuffer::bind() const {
-        glBindBuffer(GL_ARRAY_BUFFER, m_id);
+        StateCacheOpenGL::bindBuffer(GL_ARRAY_BUFFER, m_id);
     }
 
     void VertexBuffer::unbind() {
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        StateCacheOpenGL::bindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    bool VertexBuffer::allocate(const size_t size, size_t &offset) {
+        if (m_usedSize + size > m_capacity) {
+            LOG_ERROR_TO(LogSubsystem::Rendering,
+                         "VertexBuffer: cannot allocate {0} bytes, {1} of {2} bytes used",
+                         size, m_usedSize, m_capacity);
+
+            return false;
+        }
+
+        offset = m_usedSize;
+        m_usedSize += size;
+
+        return true;
+    }
+
+    void VertexBuffer::setData(const void *data, const size_t size, const size_t offset) {
+        glNamedBufferSubData(m_id, static_cast<GLintptr>(offset),
+                             static_cast<GLsizeiptr>(size), data);
     }
 }
@@ -0,0 +1,320 @@
+#include "GameEngineCore/Rendering/ProceduralImage.hpp"
+
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define PROCEDURAL_IMAGE_SSE
+    #include <emmintrin.h>
+#endif
+
+namespace GameEngine {
+    namespace {
+        constexpr unsigned int s_patternPixels = 16;
+        constexpr unsigned int s_noiseChunkPixels = 64;
+
+        // 16 pixels of one color: a whole number of 16-byte stores for any channel count.
+        struct SpanPattern {
+            alignas(16) unsigned char bytes[s_patternPixels * 4];
+            unsigned int channelsCount;
+        };
+
+        SpanPattern makeSpanPattern(const ImageColor &color, const unsigned int channelsCount) {
+            const unsigned char channels[4] = { color.red, color.green, color.blue, color.alpha };
+            SpanPattern pattern{};
+            pattern.channelsCount = channelsCount;
+
+            for (unsigned int i = 0; i < s_patternPixels * channelsCount; ++i) {
+                pattern.bytes[i] = channels[i % channelsCount];
+            }
+
+            return pattern;
+        }
+
+        void fillSpan(unsigned char *row, const unsigned int begin, const unsigned int end,
+                      const SpanPattern &pattern) {
+            const size_t chunkSize = size_t{s_patternPixels} * pattern.channelsCount;
+            unsigned char *destination = row + size_t{begin} * pattern.channelsCount;
+            size_t size = size_t{end - begin} * pattern.channelsCount;
+
+#if defined(PROCEDURAL_IMAGE_SSE)
+            const unsigned int storesCount = pattern.channelsCount;
+            __m128i chunk[4];
+
+            for (unsigned int i = 0; i < storesCount; ++i) {
+                chunk[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.bytes) + i);
+            }
+
+            for (; size >= chunkSize; size -= chunkSize, destination += chunkSize) {
+                for (unsigned int i = 0; i < storesCount; ++i) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination) + i, chunk[i]);
+                }
+            }
+#else
+            for (; size >= chunkSize; size -= chunkSize, destination += chunkSize) {
+                std::memcpy(destination, pattern.bytes, chunkSize);
+            }
+#endif
+
+            std::memcpy(destination, pattern.bytes, size);
+        }
+
+        float hashLattice(const int x, const int y, const uint32_t seed) {
+            uint32_t hash = static_cast<uint32_t>(x) * 0x8DA6B343u ^
+                            static_cast<uint32_t>(y) * 0xD8163841u ^ seed * 0xCB1AB31Fu;
+            hash ^= hash >> 13;
+            hash *= 0x5BD1E995u;
+            hash ^= hash >> 15;
+
+            return static_cast<float>(hash & 0xFFFFu) / 65535.0f;
+        }
+
+        float smoothStep(const float t) {
+            return t * t * (3.0f - 2.0f * t);
+        }
+
+        // Writes 8-bit blend weights for count pixels starting at offset within a cell whose
+        // corner values interpolated along y are first and second.
+        void evaluateNoiseWeights(const float first, const float second, const unsigned int offset,
+                                  const unsigned int count, const float inverseCellSize,
+                                  unsigned char *weights) {
+            const float delta = second - first;
+            unsigned int i = 0;
+
+#if defined(PROCEDURAL_IMAGE_SSE)
+            const __m128 lanes = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+            const __m128 scale = _mm_set1_ps(inverseCellSize);
+            const __m128 three = _mm_set1_ps(3.0f);
+            const __m128 two = _mm_set1_ps(2.0f);
+            const __m128 base = _mm_set1_ps(first * 255.0f);
+            const __m128 range = _mm_set1_ps(delta * 255.0f);
+
+            for (; i + 4 <= count; i += 4) {
+                const __m128 t = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(static_cast<float>(offset + i)), lanes), scale);
+                const __m128 smooth = _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(three, _mm_mul_ps(two, t)));
+                const __m128i value = _mm_cvtps_epi32(_mm_add_ps(base, _mm_mul_ps(range, smooth)));
+                const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(value, value), _mm_setzero_si128());
+                const int bytes = _mm_cvtsi128_si32(packed);
+
+                std::memcpy(weights + i, &bytes, 4);
+            }
+#endif
+
+            for (; i < count; ++i) {
+                const float value = first + delta * smoothStep(static_cast<float>(offset + i) * inverseCellSize);
+
+                weights[i] = static_cast<unsigned char>(std::lround(value * 255.0f));
+            }
+        }
+
+        void blendSpan(unsigned char *destination, const unsigned char *weights, const unsigned int count,
+                       const unsigned int channelsCount, const ImageColor &first, const ImageColor &second) {
+            const int base[4] = { first.red, first.green, first.blue, first.alpha };
+            const int delta[4] = { second.red - first.red, second.green - first.green,
+                                   second.blue - first.blue, second.alpha - first.alpha };
+
+            for (unsigned int i = 0; i < count; ++i) {
+                for (unsigned int channel = 0; channel < channelsCount; ++channel) {
+                    destination[i * channelsCount + channel] =
+                        static_cast<unsigned char>(base[channel] + (delta[channel] * weights[i] + 127) / 255);
+                }
+            }
+        }
+    }
+
+    void fillImageSpan(unsigned char *row, const unsigned int begin, const unsigned int end,
+                       const unsigned int channelsCount, const ImageColor &color) {
+        if (begin < end) {
+            fillSpan(row, begin, end, makeSpanPattern(color, channelsCount));
+        }
+    }
+
+    void fillImageSpanScalar(unsigned char *row, const unsigned int begin, const unsigned int end,
+                             const unsigned int channelsCount, const ImageColor &color) {
+        const unsigned char channels[4] = { color.red, color.green, color.blue, color.alpha };
+
+        for (unsigned int x = begin; x < end; ++x) {
+            for (unsigned int channel = 0; channel < channelsCount; ++channel) {
+                row[x * channelsCount + channel] = channels[channel];
+            }
+        }
+    }
+
+    void ProceduralImage::fill(const ImageColor &color) {
+        constexpr int maxCoordinate = std::numeric_limits<int>::max();
+
+        addRect(0, 0, maxCoordinate, maxCoordinate, color);
+    }
+
+    void ProceduralImage::addRect(const int left, const int top, const int right, const int bottom,
+                                  const ImageColor &color) {
+        Shape shape;
+        shape.type = ShapeType::Rect;
+        shape.left = left;
+        shape.top = top;
+        shape.right = right;
+        shape.bottom = bottom;
+        shape.color = color;
+
+        m_shapes.push_back(shape);
+    }
+
+    void ProceduralImage::addCircle(const int centerX, const int centerY, const int radius,
+                                    const ImageColor &color) {
+        if (radius <= 0) {
+            return;
+        }
+
+        Shape shape;
+        shape.type = ShapeType::Circle;
+        shape.left = centerX - radius + 1;
+        shape.top = centerY - radius + 1;
+        shape.right = centerX + radius;
+        shape.bottom = centerY + radius;
+        shape.centerX = centerX;
+        shape.centerY = centerY;
+        shape.radius = radius;
+        shape.color = color;
+
+        m_shapes.push_back(shape);
+    }
+
+    void ProceduralImage::addNoise(const int left, const int top, const int right, const int bottom,
+                                   const unsigned int cellSize, const uint32_t seed,
+                                   const ImageColor &firstColor, const ImageColor &secondColor) {
+        Shape shape;
+        shape.type = ShapeType::Noise;
+        shape.left = left;
+        shape.top = top;
+        shape.right = right;
+        shape.bottom = bottom;
+        shape.cellSize = std::max(cellSize, 1u);
+        shape.seed = seed;
+        shape.color = firstColor;
+        shape.secondColor = secondColor;
+
+        m_shapes.push_back(shape);
+    }
+
+    void ProceduralImage::render(const ImageView &image) const {
+        PROFILE_SCOPE("ProceduralImage::render");
+
+        JobSystem::parallelFor(image.height, [this, &image](const size_t begin, const size_t end) {
+            renderRows(image, static_cast<unsigned int>(begin), static_cast<unsigned int>(end));
+        });
+    }
+
+    void ProceduralImage::renderRows(const ImageView &image, const unsigned int begin,
+                                     const unsigned int end) const {
+        const int width = static_cast<int>(image.width);
+        const unsigned int channelsCount = image.channelsCount;
+        unsigned char weights[s_noiseChunkPixels];
+
+        for (const Shape &shape : m_shapes) {
+            const int top = std::max(shape.top, static_cast<int>(begin));
+            const int bottom = std::min(shape.bottom, static_cast<int>(end));
+            const int left = std::max(shape.left, 0);
+            const int right = std::min(shape.right, width);
+
+            if (top >= bottom || left >= right) {
+                continue;
+            }
+
+            const SpanPattern pattern = makeSpanPattern(shape.color, channelsCount);
+
+            for (int y = top; y < bottom; ++y) {
+                unsigned char *row = image.getRow(static_cast<unsigned int>(y));
+
+                if (shape.type == ShapeType::Rect) {
+                    fillSpan(row, static_cast<unsigned int>(left), static_cast<unsigned int>(right), pattern);
+                } else if (shape.type == ShapeType::Circle) {
+                    const int64_t deltaY = y - shape.centerY;
+                    const int64_t remainder = int64_t{shape.radius} * shape.radius - deltaY * deltaY;
+                    int64_t deltaX = static_cast<int64_t>(std::sqrt(static_cast<double>(remainder)));
+
+                    while (deltaX > 0 && deltaX * deltaX >= remainder) {
+                        --deltaX;
+                    }
+
+                    while ((deltaX + 1) * (deltaX + 1) < remainder) {
+                        ++deltaX;
+                    }
+
+                    const int spanLeft = std::max(static_cast<int>(shape.centerX - deltaX), left);
+                    const int spanRight = std::min(static_cast<int>(shape.centerX + deltaX + 1), right);
+
+                    if (spanLeft < spanRight) {
+                        fillSpan(row, static_cast<unsigned int>(spanLeft), static_cast<unsigned int>(spanRight), pattern);
+                    }
+                } else {
+                    const int cellSize = static_cast<int>(shape.cellSize);
+                    const float inverseCellSize = 1.0f / static_cast<float>(cellSize);
+                    const int localY = y - shape.top;
+                    const int cellY = localY / cellSize;
+                    const float weightY = smoothStep(static_cast<float>(localY % cellSize) * inverseCellSize);
+
+                    const auto columnValue = [&shape, cellY, weightY](const int cellX) {
+                        const float upper = hashLattice(cellX, cellY, shape.seed);
+                        const float lower = hashLattice(cellX, cellY + 1, shape.seed);
+
+                        return upper + (lower - upper) * weightY;
+                    };
+
+                    int x = left;
+
+                    while (x < right) {
+                        const int localX = x - shape.left;
+                        const int cellX = localX / cellSize;
+                        const int cellEnd = std::min(right, x + cellSize - localX % cellSize);
+                        const float first = columnValue(cellX);
+                        const float second = columnValue(cellX + 1);
+
+                        while (x < cellEnd) {
+                            const unsigned int count = std::min(static_cast<unsigned int>(cellEnd - x),
+                                                                s_noiseChunkPixels);
+
+                            evaluateNoiseWeights(first, second, static_cast<unsigned int>((x - shape.left) % cellSize),
+                                                 count, inverseCellSize, weights);
+                            blendSpan(row + static_cast<size_t>(x) * channelsCount, weights, count,
+                                      channelsCount, shape.color, shape.secondColor);
+
+                            x += static_cast<int>(count);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void buildSmileImage(ProceduralImage &image, const unsigned int width, const unsigned int height) {
+        const auto scaled = [](const unsigned int size, const double factor) {
+            return static_cast<int>(static_cast<unsigned int>(size * factor));
+        };
+
+        image.clear();
+        image.fill({ 200, 191, 231 });
+
+        image.addCircle(scaled(width, 0.5), scaled(height, 0.5), scaled(width, 0.4), { 255, 255, 0 });
+
+        image.addCircle(scaled(width, 0.5), scaled(height, 0.4), scaled(width, 0.2), { 0, 0, 0 });
+        image.addCircle(scaled(width, 0.5), scaled(height, 0.45), scaled(width, 0.2), { 255, 255, 0 });
+
+        image.addCircle(scaled(width, 0.35), scaled(height, 0.6), scaled(width, 0.07), { 255, 0, 255 });
+        image.addCircle(scaled(width, 0.65), scaled(height, 0.6), scaled(width, 0.07), { 0, 0, 255 });
+    }
+
+    void buildQuadsImage(ProceduralImage &image, const unsigned int width, const unsigned int height) {
+        const int halfWidth = static_cast<int>(width / 2);
+        const int halfHeight = static_cast<int>(height / 2);
+
+        image.clear();
+        image.fill({ 255, 255, 255 });
+        image.addRect(0, 0, halfWidth, halfHeight, { 0, 0, 0 });
+        image.addRect(halfWidth, halfHeight, static_cast<int>(width), static_cast<int>(height), { 0, 0, 0 });
+    }
+}
@@ -0,0 +1,143 @@
+#include "GameEngineCore/Rendering/RenderQueue.hpp"
+#include "GameEngineCore/Memory/LinearAllocator.hpp"
+#include "GameEngineCore/Log.hpp"
+
+#include "GameEngineCore/Rendering/OpenGL/ShaderProgram.hpp"
+#include "GameEngineCore/Rendering/OpenGL/VertexArray.hpp"
+#include "GameEngineCore/Rendering/OpenGL/Texture2D.hpp"
+#include "GameEngineCore/Rendering/OpenGL/Texture2DArray.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace GameEngine {
+    constexpr uint64_t s_idBits = 12;
+    constexpr uint64_t s_idMask = (uint64_t{1} << s_idBits) - 1;
+    constexpr uint64_t s_depthBits = 24;
+    constexpr uint64_t s_depthMask = (uint64_t{1} << s_depthBits) - 1;
+
+    static uint64_t quantizeDepth(const float depth) {
+        const float clampedDepth = std::max(depth, 0.0f);
+        uint32_t bits = 0;
+        std::memcpy(&bits, &clampedDepth, sizeof(bits));
+
+        return (bits >> (32 - s_depthBits)) & s_depthMask;
+    }
+
+    RenderQueue::RenderQueue(LinearAllocator &frameAllocator, const size_t capacity)
+        : m_frameAllocator{frameAllocator}, m_capacity{capacity} {}
+
+    void RenderQueue::begin() {
+        m_count = 0;
+        m_commands = m_frameAllocator.allocateArray<DrawCommand>(m_capacity);
+        m_keys = m_frameAllocator.allocateArray<uint64_t>(m_capacity);
+        m_sortedIndices = m_frameAllocator.allocateArray<uint32_t>(m_capacity);
+    }
+
+    bool RenderQueue::submit(const DrawCommand &command) {
+        if (m_commands == nullptr || m_count >= m_capacity) {
+            LOG_ERROR_RATE_LIMITED_TO(LogSubsystem::Rendering, 1000,
+                                      "RenderQueue: command dropped, queue capacity is {0}", m_capacity);
+
+            return false;
+        }
+
+        m_commands[m_count] = command;
+        m_keys[m_count] = makeSortKey(command);
+        m_sortedIndices[m_count] = static_cast<uint32_t>(m_count);
+        ++m_count;
+
+        return true;
+    }
+
+    void RenderQueue::sort() {
+        if (m_count < 2) {
+            return;
+        }
+
+        auto *scratchKeys = m_frameAllocator.allocateArray<uint64_t>(m_count);
+        auto *scratchIndices = m_frameAllocator.allocateArray<uint32_t>(m_count);
+
+        if (scratchKeys == nullptr || scratchIndices == nullptr) {
+            return;
+        }
+
+        radixSort(m_keys, m_sortedIndices, scratchKeys, scratchIndices, m_count);
+    }
+
+    uint64_t RenderQueue::makeSortKey(const DrawCommand &command) {
+        const uint64_t program = command.shaderProgram ?
+            command.shaderProgram->getId() & s_idMask : 0;
+        const uint64_t texture = command.textures[0] ? command.textures[0]->getId() & s_idMask :
+                                 command.textureArray ? command.textureArray->getId() & s_idMask : 0;
+        const uint64_t vertexArray = command.vertexArray ?
+            command.vertexArray->getId() & s_idMask : 0;
+        const uint64_t depth = quantizeDepth(command.depth);
+
+        if (command.transparent) {
+            return (uint64_t{1} << 63) |
+                   ((s_depthMask - depth) << (3 * s_idBits)) |
+                   (program << (2 * s_idBits)) |
+                   (texture << s_idBits) |
+                   vertexArray;
+        }
+
+        return (program << (2 * s_idBits + s_depthBits)) |
+               (texture << (s_idBits + s_depthBits)) |
+               (vertexArray << s_depthBits) |
+               depth;
+    }
+
+    void RenderQueue::radixSort(uint64_t *keys, uint32_t *indices,
+                                uint64_t *scratchKeys, uint32_t *scratchIndices,
+                                const size_t count) {
+        constexpr unsigned int digitsCount = sizeof(uint64_t);
+        size_t histograms[digitsCount][256] = {};
+
+        // Every digit is counted in one read pass, so each pass below only scatters.
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t key = keys[i];
+
+            for (unsigned int digit = 0; digit < digitsCount; ++digit) {
+                ++histograms[digit][(key >> (8 * digit)) & 0xFF];
+            }
+        }
+
+        uint64_t *sourceKeys = keys;
+        uint32_t *sourceIndices = indices;
+        uint64_t *targetKeys = scratchKeys;
+        uint32_t *targetIndices = scratchIndices;
+
+        for (unsigned int digit = 0; digit < digitsCount; ++digit) {
+            const unsigned int shift = 8 * digit;
+            size_t *histogram = histograms[digit];
+
+            // A digit shared by every key leaves the order unchanged.
+            if (histogram[(keys[0] >> shift) & 0xFF] == count) {
+                continue;
+            }
+
+            size_t offset = 0;
+            for (size_t bucketIndex = 0; bucketIndex < 256; ++bucketIndex) {
+                const size_t bucketCount = histogram[bucketIndex];
+                histogram[bucketIndex] = offset;
+                offset += bucketCount;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                const size_t position = histogram[(sourceKeys[i] >> shift) & 0xFF]++;
+                targetKeys[position] = sourceKeys[i];
+                targetIndices[position] = sourceIndices[i];
+            }
+
+            std::swap(sourceKeys, targetKeys);
+            std::swap(sourceIndices, targetIndices);
+        }
+
+        if (sourceKeys != keys) {
+            std::memcpy(keys, sourceKeys, sizeof(uint64_t) * count);
+            std::memcpy(indices, sourceIndices, sizeof(uint32_t) * count);
+        }
+    }
+}
@@ -0,0 +1,168 @@
+#include "GameEngineCore/Rendering/TextureAtlasPacker.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace GameEngine {
+    namespace {
+        unsigned int alignUp(const unsigned int value, const unsigned int alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    TextureAtlasPacker::TextureAtlasPacker(const Settings &settings) : m_settings{settings} {
+        m_settings.alignment = std::max(m_settings.alignment, 1u);
+        m_settings.padding = alignUp(m_settings.padding, m_settings.alignment);
+    }
+
+    void TextureAtlasPacker::reset() {
+        m_layers.clear();
+        m_usedArea = 0;
+    }
+
+    double TextureAtlasPacker::getOccupancy() const {
+        const double area = static_cast<double>(m_settings.layerWidth) * m_settings.layerHeight * m_layers.size();
+
+        return area > 0.0 ? static_cast<double>(m_usedArea) / area : 0.0;
+    }
+
+    bool TextureAtlasPacker::pack(const unsigned int width, const unsigned int height, Placement &placement) {
+        placement = Placement{};
+
+        if (width == 0 || height == 0) {
+            return false;
+        }
+
+        const unsigned int paddedWidth = alignUp(width, m_settings.alignment) + 2 * m_settings.padding;
+        const unsigned int paddedHeight = alignUp(height, m_settings.alignment) + 2 * m_settings.padding;
+
+        if (paddedWidth > m_settings.layerWidth || paddedHeight > m_settings.layerHeight) {
+            return false;
+        }
+
+        for (size_t layer = 0; layer <= m_layers.size(); ++layer) {
+            if (layer == m_layers.size()) {
+                if (m_layers.size() >= m_settings.maxLayersCount) {
+                    return false;
+                }
+
+                m_layers.push_back({ SkylineNode{ 0, 0, m_settings.layerWidth } });
+            }
+
+            size_t nodeIndex = 0;
+            unsigned int x = 0;
+            unsigned int y = 0;
+
+            if (!findPosition(m_layers[layer], paddedWidth, paddedHeight, nodeIndex, x, y)) {
+                continue;
+            }
+
+            addSkylineLevel(m_layers[layer], nodeIndex, x, y, paddedWidth, paddedHeight);
+
+            placement.layer = static_cast<unsigned int>(layer);
+            placement.x = x + m_settings.padding;
+            placement.y = y + m_settings.padding;
+            placement.width = width;
+            placement.height = height;
+            placement.isPacked = true;
+            m_usedArea += size_t{width} * height;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    size_t TextureAtlasPacker::packAll(const std::vector<std::pair<unsigned int, unsigned int>> &sizes,
+                                       std::vector<Placement> &placements) {
+        std::vector<uint32_t> order(sizes.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [&sizes](const uint32_t left, const uint32_t right) {
+            return sizes[left].second != sizes[right].second ? sizes[left].second > sizes[right].second :
+                                                               sizes[left].first > sizes[right].first;
+        });
+
+        placements.assign(sizes.size(), Placement{});
+        size_t packedCount = 0;
+
+        for (const uint32_t index : order) {
+            packedCount += pack(sizes[index].first, sizes[index].second, placements[index]) ? 1 : 0;
+        }
+
+        return packedCount;
+    }
+
+    bool TextureAtlasPacker::findPosition(const Skyline &skyline, const unsigned int width,
+                                          const unsigned int height, size_t &nodeIndex,
+                                          unsigned int &x, unsigned int &y) const {
+        unsigned int bestBottom = std::numeric_limits<unsigned int>::max();
+        unsigned int bestWidth = std::numeric_limits<unsigned int>::max();
+
+        for (size_t i = 0; i < skyline.size(); ++i) {
+            const unsigned int left = skyline[i].x;
+
+            if (left + width > m_settings.layerWidth) {
+                break;
+            }
+
+            unsigned int top = 0;
+            unsigned int coveredWidth = 0;
+
+            for (size_t j = i; coveredWidth < width; ++j) {
+                top = std::max(top, skyline[j].y);
+                coveredWidth += skyline[j].width;
+            }
+
+            if (top + height > m_settings.layerHeight) {
+                continue;
+            }
+
+            const unsigned int bottom = top + height;
+
+            if (bottom < bestBottom || (bottom == bestBottom && skyline[i].width < bestWidth)) {
+                bestBottom = bottom;
+                bestWidth = skyline[i].width;
+                nodeIndex = i;
+                x = left;
+                y = top;
+            }
+        }
+
+        return bestBottom != std::numeric_limits<unsigned int>::max();
+    }
+
+    void TextureAtlasPacker::addSkylineLevel(Skyline &skyline, const size_t nodeIndex, const unsigned int x,
+                                             const unsigned int y, const unsigned int width,
+                                             const unsigned int height) {
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(nodeIndex), SkylineNode{ x, y + height, width });
+
+        const unsigned int right = x + width;
+
+        for (size_t i = nodeIndex + 1; i < skyline.size();) {
+            if (skyline[i].x >= right) {
+                break;
+            }
+
+            const unsigned int overlap = right - skyline[i].x;
+
+            if (overlap < skyline[i].width) {
+                skyline[i].x += overlap;
+                skyline[i].width -= overlap;
+
+                break;
+            }
+
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+
+        for (size_t i = 0; i + 1 < skyline.size();) {
+            if (skyline[i].y == skyline[i + 1].y) {
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            } else {
+                ++i;
+            }
+        }
+    }
+}
@@ -0,0 +1,495 @@
+#include "GameEngineCore/Rendering/TextureCompression.hpp"
+
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace GameEngine {
+    namespace {
+        constexpr size_t s_blockTexelsCount = 16;
+        constexpr size_t s_rgbaChannels = 4;
+
+        int clampByte(const float value) {
+            return std::min(std::max(static_cast<int>(value + 0.5f), 0), 255);
+        }
+
+        int squaredDistance(const unsigned char *left, const int *right, const size_t channelsCount) {
+            int distance = 0;
+
+            for (size_t channel = 0; channel < channelsCount; ++channel) {
+                const int delta = static_cast<int>(left[channel]) - right[channel];
+                distance += delta * delta;
+            }
+
+            return distance;
+        }
+
+        // Fits a line through the block colors and returns its extremes over the texels.
+        void findEndpoints(const unsigned char *texels, const size_t channelsCount,
+                           int *minEndpoint, int *maxEndpoint) {
+            float mean[s_rgbaChannels] = {};
+
+            for (size_t i = 0; i < s_blockTexelsCount; ++i) {
+                for (size_t channel = 0; channel < channelsCount; ++channel) {
+                    mean[channel] += texels[i * s_rgbaChannels + channel];
+                }
+            }
+
+            for (size_t channel = 0; channel < channelsCount; ++channel) {
+                mean[channel] /= static_cast<float>(s_blockTexelsCount);
+            }
+
+            float covariance[s_rgbaChannels][s_rgbaChannels] = {};
+
+            for (size_t i = 0; i < s_blockTexelsCount; ++i) {
+                for (size_t row = 0; row < channelsCount; ++row) {
+                    const float rowDelta = texels[i * s_rgbaChannels + row] - mean[row];
+
+                    for (size_t column = 0; column < channelsCount; ++column) {
+                        covariance[row][column] += rowDelta * (texels[i * s_rgbaChannels + column] - mean[column]);
+                    }
+                }
+            }
+
+            float axis[s_rgbaChannels] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+            for (int iteration = 0; iteration < 8; ++iteration) {
+                float next[s_rgbaChannels] = {};
+                float length = 0.0f;
+
+                for (size_t row = 0; row < channelsCount; ++row) {
+                    for (size_t column = 0; column < channelsCount; ++column) {
+                        next[row] += covariance[row][column] * axis[column];
+                    }
+
+                    length = std::max(length, std::fabs(next[row]));
+                }
+
+                if (length < 1e-6f) {
+                    break;
+                }
+
+                for (size_t channel = 0; channel < channelsCount; ++channel) {
+                    axis[channel] = next[channel] / length;
+                }
+            }
+
+            float minProjection = 0.0f;
+            float maxProjection = 0.0f;
+            float axisLength = 0.0f;
+
+            for (size_t channel = 0; channel < channelsCount; ++channel) {
+                axisLength += axis[channel] * axis[channel];
+            }
+
+            for (size_t i = 0; i < s_blockTexelsCount; ++i) {
+                float projection = 0.0f;
+
+                for (size_t channel = 0; channel < channelsCount; ++channel) {
+                    projection += (texels[i * s_rgbaChannels + channel] - mean[channel]) * axis[channel];
+                }
+
+                minProjection = std::min(minProjection, projection);
+                maxProjection = std::max(maxProjection, projection);
+            }
+
+            if (axisLength > 0.0f) {
+                minProjection /= axisLength;
+                maxProjection /= axisLength;
+            }
+
+            for (size_t channel = 0; channel < channelsCount; ++channel) {
+                minEndpoint[channel] = clampByte(mean[channel] + minProjection * axis[channel]);
+                maxEndpoint[channel] = clampByte(mean[channel] + maxProjection * axis[channel]);
+            }
+        }
+
+        uint16_t packColor565(const int *color) {
+            const int red = (color[0] * 31 + 127) / 255;
+            const int green = (color[1] * 63 + 127) / 255;
+            const int blue = (color[2] * 31 + 127) / 255;
+
+            return static_cast<uint16_t>((red << 11) | (green << 5) | blue);
+        }
+
+        void unpackColor565(const uint16_t packed, int *color) {
+            const int red = (packed >> 11) & 31;
+            const int green = (packed >> 5) & 63;
+            const int blue = packed & 31;
+
+            color[0] = (red << 3) | (red >> 2);
+            color[1] = (green << 2) | (green >> 4);
+            color[2] = (blue << 3) | (blue >> 2);
+        }
+
+        class BlockBitWriter {
+        public:
+            explicit BlockBitWriter(unsigned char *block) : m_block{block} {
+                std::memset(m_block, 0, 16);
+            }
+
+            void write(const uint32_t value, const unsigned int bitsCount) {
+                for (unsigned int bit = 0; bit < bitsCount; ++bit, ++m_position) {
+                    if ((value >> bit) & 1u) {
+                        m_block[m_position / 8] |= static_cast<unsigned char>(1u << (m_position % 8));
+                    }
+                }
+            }
+
+        private:
+            unsigned char *m_block;
+            unsigned int m_position = 0;
+        };
+
+        // Quantizes an 8-bit endpoint to 7 bits plus a shared p-bit, picking the p-bit
+        // with the smaller error.
+        void quantizeEndpointBC7(const int *endpoint, int *quantized, int &pBit) {
+            int bestError = -1;
+
+            for (int candidate = 0; candidate < 2; ++candidate) {
+                int values[s_rgbaChannels];
+                int error = 0;
+
+                for (size_t channel = 0; channel < s_rgbaChannels; ++channel) {
+                    values[channel] = std::min(std::max((endpoint[channel] - candidate + 1) / 2, 0), 127);
+                    const int delta = ((values[channel] << 1) | candidate) - endpoint[channel];
+                    error += delta * delta;
+                }
+
+                if (bestError < 0 || error < bestError) {
+                    bestError = error;
+                    pBit = candidate;
+                    std::copy(values, values + s_rgbaChannels, quantized);
+                }
+            }
+        }
+
+        void gatherBlock(const unsigned char *rgba, const unsigned int width, const unsigned int height,
+                         const unsigned int blockX, const unsigned int blockY, unsigned char *texels) {
+            for (unsigned int y = 0; y < 4; ++y) {
+                const unsigned int sourceY = std::min(blockY * 4 + y, height - 1);
+
+                for (unsigned int x = 0; x < 4; ++x) {
+                    const unsigned int sourceX = std::min(blockX * 4 + x, width - 1);
+
+                    std::memcpy(texels + (y * 4 + x) * s_rgbaChannels,
+                                rgba + (size_t{sourceY} * width + sourceX) * s_rgbaChannels, s_rgbaChannels);
+                }
+            }
+        }
+
+        float srgbToLinear(const float value) {
+            return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float linearToSrgb(const float value) {
+            return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        }
+    }
+
+    void compressBlockBC1(const unsigned char *texels, unsigned char *block) {
+        int minEndpoint[3];
+        int maxEndpoint[3];
+        findEndpoints(texels, 3, minEndpoint, maxEndpoint);
+
+        uint16_t color0 = packColor565(maxEndpoint);
+        uint16_t color1 = packColor565(minEndpoint);
+        uint32_t indices = 0;
+
+        if (color0 < color1) {
+            std::swap(color0, color1);
+        }
+
+        if (color0 != color1) {
+            int palette[4][3];
+            unpackColor565(color0, palette[0]);
+            unpackColor565(color1, palette[1]);
+
+            for (size_t channel = 0; channel < 3; ++channel) {
+                palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+                palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+            }
+
+            for (size_t i = 0; i < s_blockTexelsCount; ++i) {
+                uint32_t bestIndex = 0;
+                int bestDistance = squaredDistance(texels + i * s_rgbaChannels, palette[0], 3);
+
+                for (uint32_t index = 1; index < 4; ++index) {
+                    const int distance = squaredDistance(texels + i * s_rgbaChannels, palette[index], 3);
+
+                    if (distance < bestDistance) {
+                        bestDistance = distance;
+                        bestIndex = index;
+                    }
+                }
+
+                indices |= bestIndex << (2 * i);
+            }
+        }
+
+        block[0] = static_cast<unsigned char>(color0 & 0xFF);
+        block[1] = static_cast<unsigned char>(color0 >> 8);
+        block[2] = static_cast<unsigned char>(color1 & 0xFF);
+        block[3] = static_cast<unsigned char>(color1 >> 8);
+
+        for (size_t i = 0; i < 4; ++i) {
+            block[4 + i] = static_cast<unsigned char>((indices >> (8 * i)) & 0xFF);
+        }
+    }
+
+    void compressBlockBC4(const unsigned char *texels, const size_t channel, unsigned char *block) {
+        int minValue = 255;
+        int maxValue = 0;
+
+        for (size_t i = 0; i < s_blockTexelsCount; ++i) {
+            minValue = std::min(minValue, static_cast<int>(texels[i * s_rgbaChannels + channel]));
+            maxValue = std::max(maxValue, static_cast<int>(texels[i * s_rgbaChannels + channel]));
+        }
+
+        uint64_t indices = 0;
+
+        if (maxValue != minValue) {
+            int palette[8] = { maxValue, minValue };
+
+            for (int index = 1; index < 7; ++index) {
+                palette[index + 1] = ((7 - index) * maxValue + index * minValue) / 7;
+            }
+
+            for (size_t i = 0; i < s_blockTexelsCount; ++i) {
+                const int value = texels[i * s_rgbaChannels + channel];
+                uint64_t bestIndex = 0;
+                int bestDistance = std::abs(value - palette[0]);
+
+                for (uint64_t index = 1; index < 8; ++index) {
+                    const int distance = std::abs(value - palette[index]);
+
+                    if (distance < bestDistance) {
+                        bestDistance = distance;
+                        bestIndex = index;
+                    }
+                }
+
+                indices |= bestIndex << (3 * i);
+            }
+        }
+
+        block[0] = static_cast<unsigned char>(maxValue);
+        block[1] = static_cast<unsigned char>(minValue);
+
+        for (size_t i = 0; i < 6; ++i) {
+            block[2 + i] = static_cast<unsigned char>((indices >> (8 * i)) & 0xFF);
+        }
+    }
+
+    void compressBlockBC3(const unsigned char *texels, unsigned char *block) {
+        compressBlockBC4(texels, 3, block);
+        compressBlockBC1(texels, block + 8);
+    }
+
+    void compressBlockBC5(const unsigned char *texels, unsigned char *block) {
+        compressBlockBC4(texels, 0, block);
+        compressBlockBC4(texels, 1, block + 8);
+    }
+
+    void compressBlockBC7(const unsigned char *texels, unsigned char *block) {
+        static constexpr int s_weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        int endpoints[2][s_rgbaChannels];
+        findEndpoints(texels, s_rgbaChannels, endpoints[0], endpoints[1]);
+
+        int quantized[2][s_rgbaChannels];
+        int pBits[2];
+        quantizeEndpointBC7(endpoints[0], quantized[0], pBits[0]);
+        quantizeEndpointBC7(endpoints[1], quantized[1], pBits[1]);
+
+        int palette[16][s_rgbaChannels];
+
+        for (size_t channel = 0; channel < s_rgbaChannels; ++channel) {
+            const int first = (quantized[0][channel] << 1) | pBits[0];
+            const int second = (quantized[1][channel] << 1) | pBits[1];
+
+            for (size_t index = 0; index < 16; ++index) {
+                palette[index][channel] = ((64 - s_weights[index]) * first + s_weights[index] * second + 32) >> 6;
+            }
+        }
+
+        uint32_t indices[s_blockTexelsCount];
+
+        for (size_t i = 0; i < s_blockTexelsCount; ++i) {
+            uint32_t bestIndex = 0;
+            int bestDistance = squaredDistance(texels + i * s_rgbaChannels, palette[0], s_rgbaChannels);
+
+            for (uint32_t index = 1; index < 16; ++index) {
+                const int distance = squaredDistance(texels + i * s_rgbaChannels, palette[index], s_rgbaChannels);
+
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = index;
+                }
+            }
+
+            indices[i] = bestIndex;
+        }
+
+        // The anchor index is stored with an implicit zero top bit.
+        if (indices[0] >= 8) {
+            std::swap(quantized[0], quantized[1]);
+            std::swap(pBits[0], pBits[1]);
+
+            for (uint32_t &index : indices) {
+                index = 15 - index;
+            }
+        }
+
+        BlockBitWriter writer(block);
+        writer.write(1u << 6, 7);
+
+        for (size_t channel = 0; channel < s_rgbaChannels; ++channel) {
+            writer.write(static_cast<uint32_t>(quantized[0][channel]), 7);
+            writer.write(static_cast<uint32_t>(quantized[1][channel]), 7);
+        }
+
+        writer.write(static_cast<uint32_t>(pBits[0]), 1);
+        writer.write(static_cast<uint32_t>(pBits[1]), 1);
+
+        for (size_t i = 0; i < s_blockTexelsCount; ++i) {
+            writer.write(indices[i], i == 0 ? 3 : 4);
+        }
+    }
+
+    void downsampleImage(const unsigned char *source, const unsigned int sourceWidth,
+                         const unsigned int sourceHeight, unsigned char *destination,
+                         const unsigned int width, const unsigned int height,
+                         const unsigned int channelsCount, const bool isSrgb) {
+        const unsigned int colorChannels = channelsCount == 4 ? 3 : channelsCount;
+        std::array<float, 256> toLinear{};
+
+        for (size_t value = 0; value < toLinear.size(); ++value) {
+            toLinear[value] = isSrgb ? srgbToLinear(static_cast<float>(value) / 255.0f) :
+                                       static_cast<float>(value);
+        }
+
+        for (unsigned int y = 0; y < height; ++y) {
+            const unsigned int y0 = std::min(y * 2, sourceHeight - 1);
+            const unsigned int y1 = std::min(y * 2 + 1, sourceHeight - 1);
+
+            for (unsigned int x = 0; x < width; ++x) {
+                const unsigned int x0 = std::min(x * 2, sourceWidth - 1);
+                const unsigned int x1 = std::min(x * 2 + 1, sourceWidth - 1);
+                const size_t texels[4] = {
+                    (size_t{y0} * sourceWidth + x0) * channelsCount, (size_t{y0} * sourceWidth + x1) * channelsCount,
+                    (size_t{y1} * sourceWidth + x0) * channelsCount, (size_t{y1} * sourceWidth + x1) * channelsCount
+                };
+                unsigned char *output = destination + (size_t{y} * width + x) * channelsCount;
+
+                for (unsigned int channel = 0; channel < channelsCount; ++channel) {
+                    if (isSrgb && channel < colorChannels) {
+                        const float sum = toLinear[source[texels[0] + channel]] + toLinear[source[texels[1] + channel]] +
+                                          toLinear[source[texels[2] + channel]] + toLinear[source[texels[3] + channel]];
+
+                        output[channel] = static_cast<unsigned char>(clampByte(linearToSrgb(sum * 0.25f) * 255.0f));
+                    } else {
+                        const unsigned int sum = source[texels[0] + channel] + source[texels[1] + channel] +
+                                                 source[texels[2] + channel] + source[texels[3] + channel];
+
+                        output[channel] = static_cast<unsigned char>((sum + 2) / 4);
+                    }
+                }
+            }
+        }
+    }
+
+    void encodeTextureLevel(const TextureFormat format, const unsigned char *rgba,
+                            const unsigned int width, const unsigned int height,
+                            unsigned char *destination) {
+        const TextureFormatInfo &info = getTextureFormatInfo(format);
+
+        if (!info.isCompressed) {
+            const size_t texelsCount = size_t{width} * height;
+
+            for (size_t i = 0; i < texelsCount; ++i) {
+                std::memcpy(destination + i * info.bytesPerBlock, rgba + i * s_rgbaChannels, info.bytesPerBlock);
+            }
+
+            return;
+        }
+
+        void (*compressBlock)(const unsigned char*, unsigned char*) = compressBlockBC7;
+
+        switch (format) {
+            case TextureFormat::BC1:
+            case TextureFormat::BC1_SRGB: compressBlock = compressBlockBC1; break;
+            case TextureFormat::BC3:
+            case TextureFormat::BC3_SRGB: compressBlock = compressBlockBC3; break;
+            case TextureFormat::BC4:
+                compressBlock = [](const unsigned char *texels, unsigned char *block) {
+                    compressBlockBC4(texels, 0, block);
+                };
+                break;
+            case TextureFormat::BC5: compressBlock = compressBlockBC5; break;
+            default: break;
+        }
+
+        const unsigned int blocksX = (width + 3) / 4;
+        const unsigned int blocksY = (height + 3) / 4;
+
+        JobSystem::parallelFor(blocksY, [&](const size_t begin, const size_t end) {
+            unsigned char texels[s_blockTexelsCount * s_rgbaChannels];
+
+            for (size_t blockY = begin; blockY < end; ++blockY) {
+                for (unsigned int blockX = 0; blockX < blocksX; ++blockX) {
+                    gatherBlock(rgba, width, height, blockX, static_cast<unsigned int>(blockY), texels);
+                    compressBlock(texels, destination + (blockY * blocksX + blockX) * info.bytesPerBlock);
+                }
+            }
+        });
+    }
+
+    void cookTexture(const unsigned char *rgba, const unsigned int width, const unsigned int height,
+                     const TextureFormat format, const bool generateMips, TextureData &data) {
+        PROFILE_SCOPE("cookTexture");
+
+        const bool isSrgb = getTextureFormatInfo(format).isSrgb;
+        const unsigned int levelsCount = generateMips ? computeTextureLevelsCount(width, height) : 1;
+
+        data.format = format;
+        data.width = width;
+        data.height = height;
+        data.levelOffsets.resize(levelsCount);
+
+        size_t pixelsSize = 0;
+
+        for (unsigned int level = 0; level < levelsCount; ++level) {
+            data.levelOffsets[level] = pixelsSize;
+            pixelsSize += data.getLevelMemorySize(level);
+        }
+
+        data.pixels.resize(pixelsSize);
+
+        std::vector<unsigned char> level(rgba, rgba + size_t{width} * height * s_rgbaChannels);
+        std::vector<unsigned char> nextLevel;
+
+        for (unsigned int index = 0; index < levelsCount; ++index) {
+            const unsigned int levelWidth = getTextureLevelSize(width, index);
+            const unsigned int levelHeight = getTextureLevelSize(height, index);
+
+            encodeTextureLevel(format, level.data(), levelWidth, levelHeight,
+                               data.pixels.data() + data.levelOffsets[index]);
+
+            if (index + 1 < levelsCount) {
+                const unsigned int nextWidth = getTextureLevelSize(width, index + 1);
+                const unsigned int nextHeight = getTextureLevelSize(height, index + 1);
+
+                nextLevel.resize(size_t{nextWidth} * nextHeight * s_rgbaChannels);
+                downsampleImage(level.data(), levelWidth, levelHeight, nextLevel.data(),
+                                nextWidth, nextHeight, s_rgbaChannels, isSrgb);
+                level.swap(nextLevel);
+            }
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#include "GameEngineCore/Rendering/TextureFile.hpp"
+
+#include "GameEngineCore/Log.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace GameEngine {
+    namespace {
+        constexpr char s_magic[4] = { 'G', 'E', 'T', 'X' };
+
+        struct TextureFileHeader {
+            char magic[4];
+            uint32_t version;
+            uint32_t format;
+            uint32_t width;
+            uint32_t height;
+            uint32_t levelsCount;
+        };
+    }
+
+    bool TextureFile::save(const std::string &path, const TextureData &data) {
+        TextureFileHeader header{};
+        std::memcpy(header.magic, s_magic, sizeof(s_magic));
+        header.version = s_version;
+        header.format = static_cast<uint32_t>(data.format);
+        header.width = data.width;
+        header.height = data.height;
+        header.levelsCount = data.getLevelsCount();
+
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open()) {
+            LOG_ERROR_TO(LogSubsystem::Rendering, "Failed to open texture file {} for writing", path);
+
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(data.pixels.data()),
+                   static_cast<std::streamsize>(data.pixels.size()));
+
+        return file.good();
+    }
+
+    bool TextureFile::load(const std::string &path, TextureData &data) {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+
+        if (!file.is_open()) {
+            LOG_ERROR_TO(LogSubsystem::Rendering, "Failed to open texture file {}", path);
+
+            return false;
+        }
+
+        TextureFileHeader header{};
+
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            std::memcmp(header.magic, s_magic, sizeof(s_magic)) != 0) {
+            LOG_ERROR_TO(LogSubsystem::Rendering, "{} is not a texture file", path);
+
+            return false;
+        }
+
+        if (header.version != s_version ||
+            header.format >= static_cast<uint32_t>(TextureFormat::FormatsCount) ||
+            header.width == 0 || header.height == 0 || header.levelsCount == 0 ||
+            header.levelsCount > computeTextureLevelsCount(header.width, header.height)) {
+            LOG_ERROR_TO(LogSubsystem::Rendering, "Texture file {} has an unsupported header", path);
+
+            return false;
+        }
+
+        data.format = static_cast<TextureFormat>(header.format);
+        data.width = header.width;
+        data.height = header.height;
+        data.levelOffsets.resize(header.levelsCount);
+
+        size_t pixelsSize = 0;
+
+        for (unsigned int level = 0; level < header.levelsCount; ++level) {
+            data.levelOffsets[level] = pixelsSize;
+            pixelsSize += data.getLevelMemorySize(level);
+        }
+
+        data.pixels.resize(pixelsSize);
+
+        if (!file.read(reinterpret_cast<char*>(data.pixels.data()), static_cast<std::streamsize>(pixelsSize))) {
+            LOG_ERROR_TO(LogSubsystem::Rendering, "Texture file {} is truncated", path);
+
+            return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,67 @@
+#include "GameEngineCore/Rendering/TextureFormat.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace GameEngine {
+    namespace {
+        const TextureFormatInfo s_formatInfos[] {
+            { "rgb8",         3, 1,  3, false, false },
+            { "rgba8",        4, 1,  4, false, false },
+            { "srgb8_alpha8", 4, 1,  4, false, true  },
+            { "r8",           1, 1,  1, false, false },
+            { "rg8",          2, 1,  2, false, false },
+            { "bc1",          4, 4,  8, true,  false },
+            { "bc1_srgb",     4, 4,  8, true,  true  },
+            { "bc3",          4, 4, 16, true,  false },
+            { "bc3_srgb",     4, 4, 16, true,  true  },
+            { "bc4",          1, 4,  8, true,  false },
+            { "bc5",          2, 4, 16, true,  false },
+            { "bc7",          4, 4, 16, true,  false },
+            { "bc7_srgb",     4, 4, 16, true,  true  }
+        };
+
+        static_assert(sizeof(s_formatInfos) / sizeof(s_formatInfos[0]) ==
+                      static_cast<size_t>(TextureFormat::FormatsCount));
+    }
+
+    size_t TextureData::getLevelMemorySize(const unsigned int level) const {
+        return getTextureLevelMemorySize(format, width, height, level);
+    }
+
+    const TextureFormatInfo &getTextureFormatInfo(const TextureFormat format) {
+        const size_t index = static_cast<size_t>(format);
+
+        return s_formatInfos[index < static_cast<size_t>(TextureFormat::FormatsCount) ? index : 0];
+    }
+
+    bool findTextureFormat(const char *name, TextureFormat &format) {
+        for (size_t i = 0; i < static_cast<size_t>(TextureFormat::FormatsCount); ++i) {
+            if (std::strcmp(s_formatInfos[i].name, name) == 0) {
+                format = static_cast<TextureFormat>(i);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    unsigned int computeTextureLevelsCount(const unsigned int width, const unsigned int height) {
+        return static_cast<unsigned int>(std::log2(std::max(std::max(width, height), 1u))) + 1;
+    }
+
+    unsigned int getTextureLevelSize(const unsigned int size, const unsigned int level) {
+        return std::max(size >> level, 1u);
+    }
+
+    size_t getTextureLevelMemorySize(const TextureFormat format, const unsigned int width,
+                                     const unsigned int height, const unsigned int level) {
+        const TextureFormatInfo &info = getTextureFormatInfo(format);
+        const size_t blocksX = (getTextureLevelSize(width, level) + info.blockSize - 1) / info.blockSize;
+        const size_t blocksY = (getTextureLevelSize(height, level) + info.blockSize - 1) / info.blockSize;
+
+        return blocksX * blocksY * info.bytesPerBlock;
+    }
+}
@@ -0,0 +1,36 @@
+#include "GameEngineCore/Rendering/UniformBlocks.hpp"
+
+#include <cstring>
+
+namespace GameEngine {
+    static const UniformBlockMember s_frameMembers[] {
+        { "view_matrix", offsetof(FrameUniforms, viewMatrix) },
+        { "projection_matrix", offsetof(FrameUniforms, projectionMatrix) },
+        { "view_projection_matrix", offsetof(FrameUniforms, viewProjectionMatrix) },
+        { "camera_position", offsetof(FrameUniforms, cameraPosition) },
+        { "time", offsetof(FrameUniforms, time) },
+        { "current_frame", offsetof(FrameUniforms, currentFrame) },
+        { "delta_time", offsetof(FrameUniforms, deltaTime) }
+    };
+
+    static const UniformBlockMember s_objectMembers[] {
+        { "model_matrix", offsetof(ObjectUniforms, modelMatrix) }
+    };
+
+    static const UniformBlockLayout s_blockLayouts[] {
+        { "FrameData", UniformBlockBinding::Frame, sizeof(FrameUniforms),
+          s_frameMembers, sizeof(s_frameMembers) / sizeof(UniformBlockMember) },
+        { "ObjectData", UniformBlockBinding::Object, sizeof(ObjectUniforms),
+          s_objectMembers, sizeof(s_objectMembers) / sizeof(UniformBlockMember) }
+    };
+
+    const UniformBlockLayout *findUniformBlockLayout(const char *name) {
+        for (const UniformBlockLayout &layout : s_blockLayouts) {
+            if (std::strcmp(layout.name, name) == 0) {
+                return &layout;
+            }
+        }
+
+        return nullptr;
+    }
+}
@@ -0,0 +1,575 @@
+#include "GameEngineCore/Scene/TransformHierarchy.hpp"
+
+#include "GameEngineCore/Log.hpp"
+
+#include "glm/trigonometric.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define TRANSFORM_HIERARCHY_SSE
+    #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace GameEngine {
+    constexpr uint32_t s_invalidSlot = std::numeric_limits<uint32_t>::max();
+    constexpr size_t s_prefetchDistance = 8;
+    constexpr uint32_t s_bitsPerWord = 64;
+
+    static const glm::vec3 s_zeroVector(0.0f);
+    static const glm::vec3 s_unitScale(1.0f);
+    static const glm::mat4 s_identityMatrix(1.0f);
+
+    template<typename T>
+    static void prefetch(const T &value) {
+#if defined(TRANSFORM_HIERARCHY_SSE)
+        _mm_prefetch(reinterpret_cast<const char*>(&value), _MM_HINT_T0);
+#else
+        (void)value;
+#endif
+    }
+
+    static uint32_t countTrailingZeros(const uint64_t value) {
+#if defined(_MSC_VER)
+        unsigned long index = 0;
+        _BitScanForward64(&index, value);
+
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+    }
+
+#if defined(TRANSFORM_HIERARCHY_SSE)
+    // Sines and cosines of four angles at once: the angles are reduced to [-pi/4, pi/4] around the
+    // nearest multiple of pi/2 and fed to the minimax polynomials of Cephes' sinf and cosf, which
+    // stay within a few ulp of std::sin and std::cos for the angles of a transform.
+    static void sinCos(const __m128 angles, __m128 &sines, __m128 &cosines) {
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        const __m128 absolute = _mm_andnot_ps(signMask, angles);
+        const __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(absolute, _mm_set1_ps(0.636619772f)));
+        const __m128 multiple = _mm_cvtepi32_ps(quadrant);
+
+        __m128 x = _mm_sub_ps(absolute, _mm_mul_ps(multiple, _mm_set1_ps(1.5703125f)));
+        x = _mm_sub_ps(x, _mm_mul_ps(multiple, _mm_set1_ps(4.837512969970703125e-4f)));
+        x = _mm_sub_ps(x, _mm_mul_ps(multiple, _mm_set1_ps(7.54978995489188216e-8f)));
+
+        const __m128 z = _mm_mul_ps(x, x);
+
+        __m128 sine = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(-1.9515295891e-4f)), _mm_set1_ps(8.3321608736e-3f));
+        sine = _mm_add_ps(_mm_mul_ps(sine, z), _mm_set1_ps(-1.6666654611e-1f));
+        sine = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sine, z), x), x);
+
+        __m128 cosine = _mm_add_ps(_mm_mul_ps(z, _mm_set1_ps(2.443315711809948e-5f)),
+                                   _mm_set1_ps(-1.388731625493765e-3f));
+        cosine = _mm_add_ps(_mm_mul_ps(cosine, z), _mm_set1_ps(4.166664568298827e-2f));
+        cosine = _mm_mul_ps(_mm_mul_ps(cosine, z), z);
+        cosine = _mm_add_ps(_mm_sub_ps(cosine, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+        // Odd quadrants swap the two polynomials; quadrants 2-3 negate the sine and 1-2 the cosine.
+        const __m128i one = _mm_set1_epi32(1);
+        const __m128i two = _mm_set1_epi32(2);
+        const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+        const __m128 sineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+        const __m128 cosineSign =
+            _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+
+        sines = _mm_or_ps(_mm_and_ps(swap, cosine), _mm_andnot_ps(swap, sine));
+        cosines = _mm_or_ps(_mm_and_ps(swap, sine), _mm_andnot_ps(swap, cosine));
+        sines = _mm_xor_ps(sines, _mm_xor_ps(sineSign, _mm_and_ps(angles, signMask)));
+        cosines = _mm_xor_ps(cosines, cosineSign);
+    }
+#endif
+
+    TransformHierarchy::Handle TransformHierarchy::create(const Handle parent) {
+        uint32_t parentSlot = s_invalidSlot;
+
+        if (parent != s_invalidHandle) {
+            if (!isValid(parent)) {
+                LOG_ERROR_TO(LogSubsystem::Scene, "TransformHierarchy: invalid parent handle {0}", parent.index);
+
+                return s_invalidHandle;
+            }
+
+            parentSlot = m_slots[parent.index];
+        }
+
+        Handle handle;
+
+        if (!m_freeHandles.empty()) {
+            handle.index = m_freeHandles.back();
+            m_freeHandles.pop_back();
+        } else {
+            handle.index = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back(s_invalidSlot);
+            m_generations.push_back(0);
+        }
+
+        handle.generation = m_generations[handle.index];
+
+        const uint32_t slot = static_cast<uint32_t>(m_handles.size());
+
+        // Appending keeps the order depth-first only if the parent's subtree already ends the array,
+        // in which case it and all its ancestors simply grow by one.
+        if (parentSlot != s_invalidSlot) {
+            if (m_nodes[parentSlot].subtreeEnd == slot) {
+                for (uint32_t ancestor = parentSlot; ancestor != s_invalidSlot; ancestor = m_nodes[ancestor].parent) {
+                    ++m_nodes[ancestor].subtreeEnd;
+                }
+            } else {
+                m_needsRebuild = true;
+            }
+        }
+
+        m_slots[handle.index] = slot;
+        m_handles.push_back(handle.index);
+        m_nodes.emplace_back();
+        m_nodes.back().parent = parentSlot;
+        m_nodes.back().subtreeEnd = slot + 1;
+        m_nodes.back().flags = Created;
+        m_localMatrices.emplace_back();
+        m_worldMatrices.emplace_back();
+        m_previousWorldMatrices.emplace_back();
+        m_dirtyWords.resize(m_nodes.size() / s_bitsPerWord + 1, 0);
+
+        markDirty(slot);
+
+        return handle;
+    }
+
+    void TransformHierarchy::destroy(const Handle handle) {
+        if (!isValid(handle)) {
+            return;
+        }
+
+        m_nodes[m_slots[handle.index]].flags |= Destroyed;
+        m_needsRebuild = true;
+    }
+
+    bool TransformHierarchy::isValid(const Handle handle) const {
+        return handle.index < m_slots.size() && m_generations[handle.index] == handle.generation &&
+               m_slots[handle.index] != s_invalidSlot && (m_nodes[m_slots[handle.index]].flags & Destroyed) == 0;
+    }
+
+    uint32_t TransformHierarchy::findSlot(const Handle handle, const char *function) const {
+        if (!isValid(handle)) {
+            LOG_ERROR_TO(LogSubsystem::Scene, "TransformHierarchy: invalid handle {0} passed to {1}",
+                         handle.index, function);
+
+            return s_invalidSlot;
+        }
+
+        return m_slots[handle.index];
+    }
+
+    bool TransformHierarchy::setParent(const Handle handle, const Handle parent) {
+        if (!isValid(handle) || (parent != s_invalidHandle && !isValid(parent))) {
+            LOG_ERROR_TO(LogSubsystem::Scene, "TransformHierarchy: invalid handle passed to setParent");
+
+            return false;
+        }
+
+        const uint32_t slot = m_slots[handle.index];
+        const uint32_t parentSlot = parent != s_invalidHandle ? m_slots[parent.index] : s_invalidSlot;
+
+        for (uint32_t ancestor = parentSlot; ancestor != s_invalidSlot; ancestor = m_nodes[ancestor].parent) {
+            if (ancestor == slot) {
+                LOG_ERROR_TO(LogSubsystem::Scene,
+                             "TransformHierarchy: node {0} can't be parented to its descendant {1}",
+                             handle.index, parent.index);
+
+                return false;
+            }
+        }
+
+        m_nodes[slot].parent = parentSlot;
+        m_needsRebuild = true;
+        markDirty(slot);
+
+        return true;
+    }
+
+    TransformHierarchy::Handle TransformHierarchy::getParent(const Handle handle) const {
+        const uint32_t slot = findSlot(handle, "getParent");
+
+        if (slot == s_invalidSlot || m_nodes[slot].parent == s_invalidSlot) {
+            return s_invalidHandle;
+        }
+
+        const uint32_t parentSlot = m_nodes[slot].parent;
+
+        const uint32_t parentIndex = m_handles[parentSlot];
+
+        return Handle{parentIndex, m_generations[parentIndex]};
+    }
+
+    void TransformHierarchy::setPosition(const Handle handle, const glm::vec3 &position) {
+        const uint32_t slot = findSlot(handle, "setPosition");
+
+        if (slot != s_invalidSlot) {
+            m_nodes[slot].position = position;
+            markDirty(slot);
+        }
+    }
+
+    void TransformHierarchy::setRotation(const Handle handle, const glm::vec3 &rotation) {
+        const uint32_t slot = findSlot(handle, "setRotation");
+
+        if (slot != s_invalidSlot) {
+            m_nodes[slot].rotation = rotation;
+            markDirty(slot);
+        }
+    }
+
+    void TransformHierarchy::setScale(const Handle handle, const glm::vec3 &scale) {
+        const uint32_t slot = findSlot(handle, "setScale");
+
+        if (slot != s_invalidSlot) {
+            m_nodes[slot].scale = scale;
+            markDirty(slot);
+        }
+    }
+
+    const glm::vec3 &TransformHierarchy::getPosition(const Handle handle) const {
+        const uint32_t slot = findSlot(handle, "getPosition");
+
+        return slot != s_invalidSlot ? m_nodes[slot].position : s_zeroVector;
+    }
+
+    const glm::vec3 &TransformHierarchy::getRotation(const Handle handle) const {
+        const uint32_t slot = findSlot(handle, "getRotation");
+
+        return slot != s_invalidSlot ? m_nodes[slot].rotation : s_zeroVector;
+    }
+
+    const glm::vec3 &TransformHierarchy::getScale(const Handle handle) const {
+        const uint32_t slot = findSlot(handle, "getScale");
+
+        return slot != s_invalidSlot ? m_nodes[slot].scale : s_unitScale;
+    }
+
+    const glm::mat4 &TransformHierarchy::getLocalMatrix(const Handle handle) const {
+        const uint32_t slot = findSlot(handle, "getLocalMatrix");
+
+        return slot != s_invalidSlot ? m_localMatrices[slot].value : s_identityMatrix;
+    }
+
+    const glm::mat4 &TransformHierarchy::getWorldMatrix(const Handle handle) const {
+        const uint32_t slot = findSlot(handle, "getWorldMatrix");
+
+        return slot != s_invalidSlot ? m_worldMatrices[slot].value : s_identityMatrix;
+    }
+
+    const glm::mat4 &TransformHierarchy::getPreviousWorldMatrix(const Handle handle) const {
+        const uint32_t slot = findSlot(handle, "getPreviousWorldMatrix");
+
+        return slot != s_invalidSlot ? m_previousWorldMatrices[slot].value : s_identityMatrix;
+    }
+
+    void TransformHierarchy::markDirty(const uint32_t slot) {
+        if ((m_nodes[slot].flags & LocalDirty) == 0) {
+            m_nodes[slot].flags |= LocalDirty;
+            m_dirtyWords[slot / s_bitsPerWord] |= uint64_t{1} << (slot % s_bitsPerWord);
+            ++m_dirtyCount;
+        }
+    }
+
+    void TransformHierarchy::update() {
+        if (m_needsRebuild) {
+            rebuild();
+        }
+
+        m_lastUpdatedCount = 0;
+
+        if (m_dirtyCount == 0) {
+            return;
+        }
+
+        // Each subtree is a contiguous range of slots, so recomputing a dirty node's range in order
+        // refreshes all of its descendants, and visiting dirty nodes in slot order lets nested ones ride along.
+        m_dirtySlots.clear();
+
+        for (size_t word = 0; word < m_dirtyWords.size(); ++word) {
+            uint64_t bits = m_dirtyWords[word];
+
+            if (bits == 0) {
+                continue;
+            }
+
+            m_dirtyWords[word] = 0;
+
+            for (; bits != 0; bits &= bits - 1) {
+                m_dirtySlots.push_back(static_cast<uint32_t>(word * s_bitsPerWord) + countTrailingZeros(bits));
+            }
+        }
+
+        m_dirtyCount = 0;
+
+        const size_t dirtyCount = m_dirtySlots.size();
+        uint32_t rangeEnd = 0;
+
+        for (size_t i = 0; i < dirtyCount; ++i) {
+            const uint32_t dirtySlot = m_dirtySlots[i];
+
+            // The ranges are scattered across the arrays, so start loading the upcoming ones early. The
+            // parent's world matrix needs the node loaded first, so nodes are fetched twice as far ahead.
+            if (i + 2 * s_prefetchDistance < dirtyCount) {
+                prefetch(m_nodes[m_dirtySlots[i + 2 * s_prefetchDistance]]);
+            }
+
+            if (i + s_prefetchDistance < dirtyCount) {
+                const uint32_t nextSlot = m_dirtySlots[i + s_prefetchDistance];
+                const uint32_t nextParentSlot = m_nodes[nextSlot].parent;
+
+                prefetch(m_localMatrices[nextSlot]);
+                prefetch(m_worldMatrices[nextSlot]);
+
+                if (nextParentSlot != s_invalidSlot) {
+                    prefetch(m_worldMatrices[nextParentSlot]);
+                }
+            }
+
+            if (dirtySlot < rangeEnd) {
+                continue;
+            }
+
+            rangeEnd = m_nodes[dirtySlot].subtreeEnd;
+            m_lastUpdatedCount += rangeEnd - dirtySlot;
+
+            for (uint32_t slot = dirtySlot; slot < rangeEnd; ++slot) {
+                Node &node = m_nodes[slot];
+                glm::mat4 &localMatrix = m_localMatrices[slot].value;
+                glm::mat4 &worldMatrix = m_worldMatrices[slot].value;
+
+                if ((node.flags & LocalDirty) != 0) {
+                    localMatrix = composeMatrix(node.position, node.rotation, node.scale);
+                }
+
+                if (node.parent == s_invalidSlot) {
+                    worldMatrix = localMatrix;
+                } else {
+                    multiplyMatrices(m_worldMatrices[node.parent].value, localMatrix, worldMatrix);
+                }
+
+                if ((node.flags & Created) != 0) {
+                    m_previousWorldMatrices[slot].value = worldMatrix;
+                } else if ((node.flags & Moved) == 0) {
+                    node.flags |= Moved;
+                    m_movedSlots.push_back(slot);
+                }
+
+                node.flags &= ~(LocalDirty | Created);
+            }
+        }
+
+        m_dirtySlots.clear();
+    }
+
+    void TransformHierarchy::beginSimulationStep() {
+        update();
+
+        // Only moved nodes have a previous matrix that differs from the current one.
+        for (const uint32_t slot : m_movedSlots) {
+            m_previousWorldMatrices[slot] = m_worldMatrices[slot];
+            m_nodes[slot].flags &= ~Moved;
+        }
+
+        m_movedSlots.clear();
+    }
+
+    void TransformHierarchy::rebuild() {
+        const size_t count = m_handles.size();
+        std::vector<uint8_t> removed(count, 2);
+        std::vector<uint32_t> chain;
+
+        for (uint32_t slot = 0; slot < count; ++slot) {
+            uint32_t current = slot;
+
+            while (current != s_invalidSlot && removed[current] == 2) {
+                chain.push_back(current);
+                current = m_nodes[current].parent;
+            }
+
+            uint8_t isRemoved = current != s_invalidSlot ? removed[current] : 0;
+
+            while (!chain.empty()) {
+                isRemoved |= (m_nodes[chain.back()].flags & Destroyed) != 0 ? 1 : 0;
+                removed[chain.back()] = isRemoved;
+                chain.pop_back();
+            }
+        }
+
+        std::vector<uint32_t> childrenOffsets(count + 1, 0);
+
+        for (uint32_t slot = 0; slot < count; ++slot) {
+            if (removed[slot] == 0 && m_nodes[slot].parent != s_invalidSlot) {
+                ++childrenOffsets[m_nodes[slot].parent + 1];
+            }
+        }
+
+        for (size_t i = 1; i <= count; ++i) {
+            childrenOffsets[i] += childrenOffsets[i - 1];
+        }
+
+        std::vector<uint32_t> children(childrenOffsets[count]);
+        std::vector<uint32_t> roots;
+        std::vector<uint32_t> order;
+        std::vector<uint32_t> pending;
+        order.reserve(count);
+
+        for (uint32_t slot = 0; slot < count; ++slot) {
+            if (removed[slot] != 0) {
+                m_slots[m_handles[slot]] = s_invalidSlot;
+                ++m_generations[m_handles[slot]];
+                m_freeHandles.push_back(m_handles[slot]);
+            } else if (m_nodes[slot].parent == s_invalidSlot) {
+                roots.push_back(slot);
+            } else {
+                children[childrenOffsets[m_nodes[slot].parent]++] = slot;
+            }
+        }
+
+        for (const uint32_t root : roots) {
+            pending.push_back(root);
+
+            while (!pending.empty()) {
+                const uint32_t slot = pending.back();
+                const uint32_t end = childrenOffsets[slot];
+                const uint32_t begin = slot > 0 ? childrenOffsets[slot - 1] : 0;
+                pending.pop_back();
+                order.push_back(slot);
+
+                // Pushed in reverse so that siblings keep their relative order.
+                for (uint32_t child = end; child > begin; --child) {
+                    pending.push_back(children[child - 1]);
+                }
+            }
+        }
+
+        const size_t aliveCount = order.size();
+        std::vector<uint32_t> remap(count, s_invalidSlot);
+
+        for (size_t i = 0; i < aliveCount; ++i) {
+            remap[order[i]] = static_cast<uint32_t>(i);
+        }
+
+        auto permute = [&order, aliveCount](auto &values) {
+            std::remove_reference_t<decltype(values)> permuted(aliveCount);
+
+            for (size_t i = 0; i < aliveCount; ++i) {
+                permuted[i] = values[order[i]];
+            }
+
+            values.swap(permuted);
+        };
+
+        permute(m_nodes);
+        permute(m_localMatrices);
+        permute(m_worldMatrices);
+        permute(m_previousWorldMatrices);
+        permute(m_handles);
+
+        m_dirtyWords.assign(aliveCount / s_bitsPerWord + 1, 0);
+        m_dirtyCount = 0;
+        m_movedSlots.clear();
+
+        for (uint32_t i = 0; i < aliveCount; ++i) {
+            Node &node = m_nodes[i];
+            node.parent = node.parent != s_invalidSlot ? remap[node.parent] : s_invalidSlot;
+            node.subtreeEnd = i + 1;
+            m_slots[m_handles[i]] = i;
+
+            if ((node.flags & LocalDirty) != 0) {
+                m_dirtyWords[i / s_bitsPerWord] |= uint64_t{1} << (i % s_bitsPerWord);
+                ++m_dirtyCount;
+            }
+
+            if ((node.flags & Moved) != 0) {
+                m_movedSlots.push_back(i);
+            }
+        }
+
+        // Descendants follow their ancestors, so walking backwards folds each subtree's end upwards.
+        for (uint32_t i = static_cast<uint32_t>(aliveCount); i-- > 0;) {
+            const uint32_t parent = m_nodes[i].parent;
+
+            if (parent != s_invalidSlot) {
+                m_nodes[parent].subtreeEnd = std::max(m_nodes[parent].subtreeEnd, m_nodes[i].subtreeEnd);
+            }
+        }
+
+        m_needsRebuild = false;
+    }
+
+    glm::mat4 TransformHierarchy::composeMatrix(const glm::vec3 &position, const glm::vec3 &rotation,
+                                                const glm::vec3 &scale) {
+#if defined(TRANSFORM_HIERARCHY_SSE)
+        const __m128 angles = _mm_mul_ps(_mm_set_ps(0.0f, rotation.z, rotation.y, rotation.x),
+                                         _mm_set1_ps(glm::radians(1.0f)));
+        __m128 sines;
+        __m128 cosines;
+        sinCos(angles, sines, cosines);
+
+        alignas(16) float sinValues[4];
+        alignas(16) float cosValues[4];
+        _mm_store_ps(sinValues, sines);
+        _mm_store_ps(cosValues, cosines);
+
+        const float cosX = cosValues[0];
+        const float sinX = sinValues[0];
+        const float cosY = cosValues[1];
+        const float sinY = sinValues[1];
+        const float cosZ = cosValues[2];
+        const float sinZ = sinValues[2];
+#else
+        const float cosX = std::cos(glm::radians(rotation.x));
+        const float sinX = std::sin(glm::radians(rotation.x));
+        const float cosY = std::cos(glm::radians(rotation.y));
+        const float sinY = std::sin(glm::radians(rotation.y));
+        const float cosZ = std::cos(glm::radians(rotation.z));
+        const float sinZ = std::sin(glm::radians(rotation.z));
+#endif
+
+        return glm::mat4(cosZ * cosY * scale.x, sinZ * cosY * scale.x, -sinY * scale.x, 0.0f,
+                         (cosZ * sinY * sinX - sinZ * cosX) * scale.y,
+                         (sinZ * sinY * sinX + cosZ * cosX) * scale.y,
+                         cosY * sinX * scale.y, 0.0f,
+                         (cosZ * sinY * cosX + sinZ * sinX) * scale.z,
+                         (sinZ * sinY * cosX - cosZ * sinX) * scale.z,
+                         cosY * cosX * scale.z, 0.0f,
+                         position.x, position.y, position.z, 1.0f);
+    }
+
+    void TransformHierarchy::multiplyMatrices(const glm::mat4 &left, const glm::mat4 &right,
+                                              glm::mat4 &result) {
+#if defined(TRANSFORM_HIERARCHY_SSE)
+        const float *leftData = &left[0][0];
+        const float *rightData = &right[0][0];
+        float *resultData = &result[0][0];
+
+        const __m128 column0 = _mm_loadu_ps(leftData);
+        const __m128 column1 = _mm_loadu_ps(leftData + 4);
+        const __m128 column2 = _mm_loadu_ps(leftData + 8);
+        const __m128 column3 = _mm_loadu_ps(leftData + 12);
+
+        for (size_t i = 0; i < 4; ++i) {
+            const float *rightColumn = rightData + i * 4;
+
+            __m128 value = _mm_mul_ps(column0, _mm_set1_ps(rightColumn[0]));
+            value = _mm_add_ps(value, _mm_mul_ps(column1, _mm_set1_ps(rightColumn[1])));
+            value = _mm_add_ps(value, _mm_mul_ps(column2, _mm_set1_ps(rightColumn[2])));
+            value = _mm_add_ps(value, _mm_mul_ps(column3, _mm_set1_ps(rightColumn[3])));
+
+            _mm_storeu_ps(resultData + i * 4, value);
+        }
+#else
+        result = left * right;
+#endif
+    }
+}
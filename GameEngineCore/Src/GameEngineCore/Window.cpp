@@ -1,8 +1,11 @@
 #include "GameEngineCore/Window.hpp"
 #include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Input.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
 #include "GameEngineCore/Modules/UIModule.hpp"
 
 #include "GameEngineCore/Rendering/OpenGL/RendererOpenGL.hpp"
+#include "GameEngineCore/Rendering/Headless/HeadlessContext.hpp"
 
 #include "GLFW/glfw3.h"
 
@@ -11,9 +14,10 @@
 #include "imgui/backends/imgui_impl_glfw.h"
 
 namespace GameEngine {
-    Window::Window(std::string title, const unsigned int width, const unsigned int height)
-        : m_data{{std::move(title)}, width, height} {
-        int code = init();
+    Window::Window(std::string title, const unsigned int width, const unsigned int height,
+                   const RenderBackend backend)
+        : m_backend{backend}, m_data{{std::move(title)}, width, height} {
+        int code = isHeadless() ? initHeadless() : init();
     }
 
     Window::~Window() {
@@ -21,14 +25,15 @@ namespace GameEngine {
     }
 
     int Window::init() {
-        LOG_INFO("Creating window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
+        LOG_INFO_TO(LogSubsystem::Window,
+                    "Creating window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
 
         glfwSetErrorCallback([](int errorCode, const char *description) {
-            LOG_CRITICAL("GLFW error: {0}", description);
+            LOG_CRITICAL_TO(LogSubsystem::Window, "GLFW error: {0}", description);
         });
 
         if (!glfwInit()) {
-            LOG_CRITICAL("Can't initialize GLFW!");
+            LOG_CRITICAL_TO(LogSubsystem::Window, "Can't initialize GLFW!");
 
             return -1;
         }
@@ -37,41 +42,52 @@ namespace GameEngine {
                                     nullptr, nullptr);
 
         if (!m_window) {
-            LOG_CRITICAL("Can't create window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
+            LOG_CRITICAL_TO(LogSubsystem::Window,
+                            "Can't create window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
 
             return -2;
         }
 
         if (!RendererOpenGL::init(m_window)) {
-            LOG_CRITICAL("Failed to initialize OpenGL renderer");
+            LOG_CRITICAL_TO(LogSubsystem::Window, "Failed to initialize OpenGL renderer");
 
             return -3;
         }
 
         glfwSetWindowUserPointer(m_window, &m_data);
 
+        double cursorPositionX;
+        double cursorPositionY;
+        glfwGetCursorPos(m_window, &cursorPositionX, &cursorPositionY);
+        m_data.cursorPosition = { cursorPositionX, cursorPositionY };
+
         glfwSetKeyCallback(m_window,
                            [](GLFWwindow *window, int key, int scancode, int action, int mods) {
             WindowData &data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
 
+            if (action != GLFW_REPEAT) {
+                Input::recordKey(static_cast<KeyCode>(key), action == GLFW_PRESS);
+            }
+
+            if (data.eventBus == nullptr) {
+                return;
+            }
+
             switch (action) {
                 case GLFW_PRESS: {
-                    EventKeyPressed event{static_cast<KeyCode>(key), false};
-                    data.eventCallbackFunction(event);
+                    data.eventBus->enqueue(EventKeyPressed{static_cast<KeyCode>(key), false});
 
                     break;
                 }
 
                 case GLFW_RELEASE: {
-                    EventKeyReleased event(static_cast<KeyCode>(key));
-                    data.eventCallbackFunction(event);
+                    data.eventBus->enqueue(EventKeyReleased{static_cast<KeyCode>(key)});
 
                     break;
                 }
 
                 case GLFW_REPEAT: {
-                    EventKeyPressed event(static_cast<KeyCode>(key), true);
-                    data.eventCallbackFunction(event);
+                    data.eventBus->enqueue(EventKeyPressed{static_cast<KeyCode>(key), true});
                     break;
                 }
             }
@@ -86,17 +102,24 @@ namespace GameEngine {
 
             glfwGetCursorPos(window, &positionX, &positionY);
 
+            Input::recordMouseButton(static_cast<MouseButton>(button), action == GLFW_PRESS,
+                                     positionX, positionY);
+
+            if (data.eventBus == nullptr) {
+                return;
+            }
+
             switch (action) {
                 case GLFW_PRESS: {
-                    EventMouseButtonPressed event(static_cast<MouseButton>(button), positionX, positionY);
-                    data.eventCallbackFunction(event);
+                    data.eventBus->enqueue(
+                        EventMouseButtonPressed{static_cast<MouseButton>(button), positionX, positionY});
 
                     break;
                 }
 
                 case GLFW_RELEASE: {
-                    EventMouseButtonReleased event(static_cast<MouseButton>(button), positionX, positionY);
-                    data.eventCallbackFunction(event);
+                    data.eventBus->enqueue(
+                        EventMouseButtonReleased{static_cast<MouseButton>(button), positionX, positionY});
 
                     break;
                 }
@@ -108,22 +131,29 @@ namespace GameEngine {
             data.width = width;
             data.height = height;
 
-            EventWindowResize event{width, height};
-            data.eventCallbackFunction(event);
+            if (data.eventBus != nullptr) {
+                // Published immediately so listeners can redraw while the OS resize loop blocks polling.
+                EventWindowResize event{width, height};
+                data.eventBus->publish(event);
+            }
         });
 
         glfwSetCursorPosCallback(m_window, [](GLFWwindow *window, double x, double y) {
             WindowData &data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+            data.cursorPosition = { x, y };
+            Input::recordCursorPosition(x, y);
 
-            EventMouseMoved event{x, y};
-            data.eventCallbackFunction(event);
+            if (data.eventBus != nullptr) {
+                data.eventBus->enqueue(EventMouseMoved{x, y});
+            }
         });
 
         glfwSetWindowCloseCallback(m_window, [](GLFWwindow *window) {
             WindowData &data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
 
-            EventWindowClose event;
-            data.eventCallbackFunction(event);
+            if (data.eventBus != nullptr) {
+                data.eventBus->enqueue(EventWindowClose{});
+            }
         });
 
         glfwSetFramebufferSizeCallback(m_window,
@@ -136,23 +166,52 @@ namespace GameEngine {
         return 0;
     }
 
+    int Window::initHeadless() {
+        LOG_INFO_TO(LogSubsystem::Window,
+                    "Creating headless window {0} with size {1}x{2}", m_data.title, m_data.width, m_data.height);
+
+        if (!RendererOpenGL::initHeadless(m_backend)) {
+            LOG_CRITICAL_TO(LogSubsystem::Window, "Failed to initialize headless renderer");
+
+            return -3;
+        }
+
+        RendererOpenGL::setViewport(m_data.width, m_data.height);
+
+        return 0;
+    }
+
     void Window::shutdown() {
+        if (isHeadless()) {
+            HeadlessContext::shutdown();
+
+            return;
+        }
+
         UIModule::onWindowClose();
         glfwDestroyWindow(m_window);
         glfwTerminate();
     }
 
-    void Window::onUpdate() {
+    void Window::swapBuffers() {
+        PROFILE_SCOPE("Window::swapBuffers");
+
+        if (isHeadless()) {
+            HeadlessContext::present();
+
+            return;
+        }
+
         glfwSwapBuffers(m_window);
-        glfwPollEvents();
     }
 
-    glm::vec2 Window::getCurrentCursorPosition() const {
-        double positionX;
-        double positionY;
+    void Window::pollEvents() {
+        PROFILE_SCOPE("Window::pollEvents");
 
-        glfwGetCursorPos(m_window, &positionX, &positionY);
+        if (isHeadless()) {
+            return;
+        }
 
-        return {positionX, positionY};
+        glfwPollEvents();
     }
 }
@@ -0,0 +1,20 @@
+# Records the same headless run serially and pipelined; both must issue identical command streams.
+# Usage: cmake -DEDITOR=<editor executable> -DOUTPUT_DIR=<directory> -DFRAMES=<count> -P ComparePipelined.cmake
+
+set(SERIAL_RECORDING ${OUTPUT_DIR}/serial_recording.txt)
+set(PIPELINED_RECORDING ${OUTPUT_DIR}/pipelined_recording.txt)
+
+execute_process(COMMAND ${EDITOR} --record ${SERIAL_RECORDING} --frames ${FRAMES} RESULT_VARIABLE SERIAL_RESULT)
+execute_process(COMMAND ${EDITOR} --record ${PIPELINED_RECORDING} --pipelined --frames ${FRAMES}
+                RESULT_VARIABLE PIPELINED_RESULT)
+
+if(NOT SERIAL_RESULT EQUAL 0 OR NOT PIPELINED_RESULT EQUAL 0)
+    message(FATAL_ERROR "Headless runs failed: serial ${SERIAL_RESULT}, pipelined ${PIPELINED_RESULT}")
+endif()
+
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${SERIAL_RECORDING} ${PIPELINED_RECORDING}
+                RESULT_VARIABLE COMPARE_RESULT)
+
+if(NOT COMPARE_RESULT EQUAL 0)
+    message(FATAL_ERROR "Pipelined command stream differs from the serial one")
+endif()
@@ -1,8 +1,20 @@
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <string>
 
 #include "GameEngineCore/Input.hpp"
 #include "GameEngineCore/App.hpp"
+#include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Memory/AllocationTracker.hpp"
+#include "GameEngineCore/Profiling/Profiler.hpp"
+#include "GameEngineCore/Rendering/Headless/HeadlessContext.hpp"
+#include "GameEngineCore/Rendering/OpenGL/TextureStreamer.hpp"
+#include "GameEngineCore/Jobs/JobSystem.hpp"
 
 #include "imgui/imgui.h"
 #include "imgui/imgui_internal.h"
@@ -12,37 +24,47 @@ class GameEngineEditor : public GameEngine::App {
     using Input_t = GameEngine::Input;
 
 private:
+    static constexpr float s_movementSpeed = 5.0f;
+    static constexpr float s_rotationSpeed = 45.0f;
+    static constexpr size_t s_frameTimesCount = 240;
+
     double m_initialMousePositionX = 0.0;
     double m_initialMousePositionY = 0.0;
 
-    virtual void onUpdate() override {
+    std::array<float, s_frameTimesCount> m_cpuFrameTimes{};
+    std::array<float, s_frameTimesCount> m_gpuFrameTimes{};
+    size_t m_frameTimesOffset = 0;
+
+    virtual void onUpdate(const float deltaTime) override {
         glm::vec3 movementDelta{ 0, 0, 0 };
         glm::vec3 rotationDelta{ 0, 0, 0 };
+        const float movementStep = s_movementSpeed * deltaTime;
+        const float rotationStep = s_rotationSpeed * deltaTime;
 
         if (Input_t::isKeyPressed(KeyCode_t::KEY_W)) {
-            movementDelta.x += 0.005f;
+            movementDelta.x += movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_S)) {
-            movementDelta.x -= 0.005f;
+            movementDelta.x -= movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_A)) {
-            movementDelta.y -= 0.005f;
+            movementDelta.y -= movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_D)) {
-            movementDelta.y += 0.005f;
+            movementDelta.y += movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_E)) {
-            movementDelta.z += 0.005f;
+            movementDelta.z += movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_Q)) {
-            movementDelta.z -= 0.005f;
+            movementDelta.z -= movementStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_UP)) {
-            rotationDelta.y -= 0.001f;
+            rotationDelta.y -= rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_DOWN)) {
-            rotationDelta.y += 0.001f;
+            rotationDelta.y += rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_RIGHT)) {
-            rotationDelta.z -= 0.001f;
+            rotationDelta.z -= rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_LEFT)) {
-            rotationDelta.z += 0.001f;
+            rotationDelta.z += rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_P)) {
-            rotationDelta.x += 0.001f;
+            rotationDelta.x += rotationStep;
         } else if (Input_t::isKeyPressed(KeyCode_t::KEY_O)) {
-            rotationDelta.x -= 0.001f;
+            rotationDelta.x -= rotationStep;
         }
 
         if (GameEngine::Input::isMouseButtonPressed(GameEngine::MouseButton::MOUSE_BUTTON_RIGHT)) {
@@ -158,13 +180,167 @@ private:
         }
 
         ImGui::End();
+
+        drawFrameStatisticsPanel();
+    }
+
+    static void plotFrameTimes(const char *label, const std::array<float, s_frameTimesCount> &frameTimes,
+                               const size_t offset) {
+        float sum = 0.0f;
+        float minimum = frameTimes[0];
+        float maximum = frameTimes[0];
+
+        for (const float frameTime : frameTimes) {
+            sum += frameTime;
+            minimum = std::min(minimum, frameTime);
+            maximum = std::max(maximum, frameTime);
+        }
+
+        char overlay[64];
+        snprintf(overlay, sizeof(overlay), "avg %.2f  min %.2f  max %.2f ms",
+                 sum / static_cast<float>(s_frameTimesCount), minimum, maximum);
+
+        ImGui::PlotHistogram(label, frameTimes.data(), static_cast<int>(s_frameTimesCount),
+                             static_cast<int>(offset), overlay, 0.0f, std::max(maximum, 16.7f) * 1.2f,
+                             ImVec2(0.0f, 80.0f));
+    }
+
+    void drawFrameStatisticsPanel() {
+        const GameEngine::FrameStatistics statistics = getFrameStatistics();
+
+        m_cpuFrameTimes[m_frameTimesOffset] = static_cast<float>(getFrameClock().getDeltaTime() * 1000.0);
+        m_gpuFrameTimes[m_frameTimesOffset] = static_cast<float>(statistics.gpuFrameMilliseconds);
+        m_frameTimesOffset = (m_frameTimesOffset + 1) % s_frameTimesCount;
+
+        ImGui::Begin("Frame statistics");
+
+        plotFrameTimes("CPU frame", m_cpuFrameTimes, m_frameTimesOffset);
+        plotFrameTimes("GPU frame", m_gpuFrameTimes, m_frameTimesOffset);
+
+        ImGui::Text("Draw calls: %zu, instances: %zu", statistics.drawCalls, statistics.instances);
+        ImGui::Text("State changes: %zu issued, %zu filtered", statistics.stateChangesIssued,
+                    statistics.stateChangesFiltered);
+        ImGui::Text("Buffers: %zu, %.2f MiB", statistics.buffersCount,
+                    static_cast<double>(statistics.bufferBytes) / (1024.0 * 1024.0));
+        ImGui::Text("Textures: %zu, %.2f MiB", statistics.texturesCount,
+                    static_cast<double>(statistics.textureBytes) / (1024.0 * 1024.0));
+
+        const GameEngine::TextureStreamer::Statistics &streaming = statistics.textureStreaming;
+        ImGui::Text("Texture streaming: %.2f / %.2f MiB, %zu/%zu fully resident, %zu decoding",
+                    static_cast<double>(streaming.residentBytes) / (1024.0 * 1024.0),
+                    static_cast<double>(streaming.memoryBudget) / (1024.0 * 1024.0),
+                    streaming.fullyResidentCount, streaming.texturesCount, streaming.pendingDecodesCount);
+        ImGui::Text("Mip uploads: %zu, %.2f MiB, evictions: %zu", streaming.uploadsCount,
+                    static_cast<double>(streaming.uploadedBytes) / (1024.0 * 1024.0), streaming.evictionsCount);
+
+        const GameEngine::StartupStatistics &startup = getStartupStatistics();
+        ImGui::Text("Startup: %.1f ms, program cache: %zu hits, %zu misses, %.1f ms saved", startup.milliseconds,
+                    startup.programCacheHits, startup.programCacheMisses, startup.programCacheSavedMilliseconds);
+
+        const GameEngine::InputLatencyStats inputLatency = GameEngine::Input::getLatencyStats();
+        ImGui::Text("Input latency: %.2f ms (avg %.2f ms, max %.2f ms)", inputLatency.lastMilliseconds,
+                    inputLatency.averageMilliseconds, inputLatency.maxMilliseconds);
+
+        if (ImGui::CollapsingHeader("GPU scopes", ImGuiTreeNodeFlags_DefaultOpen)) {
+            for (const GameEngine::GpuProfiler::Timing &timing : getGpuTimings()) {
+                ImGui::Text("%*s%s: %.3f ms", static_cast<int>(timing.depth * 2), "",
+                            timing.name, timing.milliseconds);
+            }
+
+            ImGui::Text("Dropped GPU frames: %zu", statistics.gpuDroppedFramesCount);
+        }
+
+        if (ImGui::CollapsingHeader("CPU scopes")) {
+            for (const GameEngine::ProfileNode &node : GameEngine::Profiler::getFrameNodes()) {
+                ImGui::Text("%*s%s: %.3f ms (%u calls)", static_cast<int>(node.depth * 2), "",
+                            node.name != nullptr ? node.name : "?", node.totalMilliseconds,
+                            node.callsCount);
+            }
+        }
+
+        if (ImGui::Button(GameEngine::Profiler::isCapturing() ? "Stop profiler capture" : "Start profiler capture")) {
+            if (GameEngine::Profiler::isCapturing()) {
+                GameEngine::Profiler::stopCapture("profile.json");
+            } else {
+                GameEngine::Profiler::startCapture();
+            }
+        }
+
+        ImGui::End();
     }
 };
 
-int main() {
+static void printAllocationReport() {
+    if (!GameEngine::AllocationTracker::isEnabled()) {
+        std::cout << "Allocation tracking is disabled, configure with GAME_ENGINE_TRACK_ALLOCATIONS=ON\n";
+
+        return;
+    }
+
+    std::cout << "Heap allocations over " << GameEngine::AllocationTracker::getTotalFramesCount()
+              << " steady-state frames, " << GameEngine::AllocationTracker::getFramesWithAllocationsCount()
+              << " of them allocating:\n";
+
+    for (size_t i = 0; i < static_cast<size_t>(GameEngine::MemoryTag::TagsCount); ++i) {
+        const GameEngine::MemoryTag tag = static_cast<GameEngine::MemoryTag>(i);
+        const GameEngine::AllocationTracker::Counters counters =
+            GameEngine::AllocationTracker::getTotalCounters(tag);
+
+        std::cout << GameEngine::AllocationTracker::getTagName(tag) << ": " << counters.allocations
+                  << " allocations, " << counters.bytes << " bytes\n";
+    }
+}
+
+int main(int argc, char **argv) {
     auto gameEngineEditor = std::make_unique<GameEngineEditor>();
+    std::string recordingPath;
+    bool allocationReport = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            gameEngineEditor->renderBackend = GameEngine::RenderBackend::Null;
+        } else if (std::strcmp(argv[i], "--pipelined") == 0) {
+            gameEngineEditor->pipelinedRendering = true;
+        } else if (std::strcmp(argv[i], "--allocation-report") == 0) {
+            allocationReport = true;
+        } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            gameEngineEditor->renderBackend = GameEngine::RenderBackend::Recording;
+            recordingPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            gameEngineEditor->framesLimit = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--texture") == 0 && i + 1 < argc) {
+            gameEngineEditor->texturePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--texture-budget") == 0 && i + 1 < argc) {
+            gameEngineEditor->textureMemoryBudget = std::strtoull(argv[++i], nullptr, 10) * 1024 * 1024;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--headless] [--pipelined] [--record <path>] [--frames <count>]"
+                      << " [--texture <cooked file>] [--texture-budget <MiB>]"
+                      << " [--allocation-report]\n";
+
+            return 1;
+        }
+    }
+
+    if (GameEngine::isHeadless(gameEngineEditor->renderBackend) && gameEngineEditor->framesLimit == 0) {
+        gameEngineEditor->framesLimit = 100;
+    }
 
     int returnCode = gameEngineEditor->start(1800, 1000, "GameEngine Editor");
 
+    if (allocationReport) {
+        printAllocationReport();
+    }
+
+    if (!recordingPath.empty()) {
+        const GameEngine::CommandRecorder &recorder = GameEngine::HeadlessContext::getRecorder();
+        recorder.writeSummary(std::cout);
+
+        if (!recorder.saveToFile(recordingPath)) {
+            std::cerr << "Failed to write command stream to " << recordingPath << "\n";
+
+            return 1;
+        }
+    }
+
     return returnCode;
 }
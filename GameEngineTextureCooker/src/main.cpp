@@ -0,0 +1,169 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "GameEngineCore/Jobs/JobSystem.hpp"
+#include "GameEngineCore/Log.hpp"
+#include "GameEngineCore/Rendering/TextureCompression.hpp"
+#include "GameEngineCore/Rendering/TextureFile.hpp"
+
+// Reads binary PNM images (P5 grayscale, P6 RGB, P7 PAM with 1-4 channels) with 8-bit
+// samples and expands them to RGBA8; two-channel PAM is grayscale with alpha.
+static bool loadPnm(const std::string &path, std::vector<unsigned char> &rgba,
+                    unsigned int &width, unsigned int &height) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    if (!file.is_open()) {
+        std::cerr << "Failed to open " << path << "\n";
+
+        return false;
+    }
+
+    std::string magic;
+    file >> magic;
+
+    unsigned int channelsCount = 0;
+    unsigned int maxValue = 0;
+
+    if (magic == "P5" || magic == "P6") {
+        channelsCount = magic == "P5" ? 1 : 3;
+
+        for (unsigned int *value : { &width, &height, &maxValue }) {
+            while (file >> std::ws && file.peek() == '#') {
+                file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            }
+
+            file >> *value;
+        }
+    } else if (magic == "P7") {
+        std::string token;
+
+        while (file >> token && token != "ENDHDR") {
+            if (token == "WIDTH") {
+                file >> width;
+            } else if (token == "HEIGHT") {
+                file >> height;
+            } else if (token == "DEPTH") {
+                file >> channelsCount;
+            } else if (token == "MAXVAL") {
+                file >> maxValue;
+            } else {
+                file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            }
+        }
+    }
+
+    file.get();
+
+    if (!file || width == 0 || height == 0 || channelsCount == 0 || channelsCount > 4 || maxValue != 255) {
+        std::cerr << path << " is not a supported PNM image (P5, P6 or P7 with 8-bit samples)\n";
+
+        return false;
+    }
+
+    const size_t texelsCount = size_t{width} * height;
+    std::vector<unsigned char> samples(texelsCount * channelsCount);
+
+    if (!file.read(reinterpret_cast<char*>(samples.data()), static_cast<std::streamsize>(samples.size()))) {
+        std::cerr << path << " is truncated\n";
+
+        return false;
+    }
+
+    rgba.resize(texelsCount * 4);
+
+    for (size_t i = 0; i < texelsCount; ++i) {
+        const unsigned char *sample = samples.data() + i * channelsCount;
+        unsigned char *texel = rgba.data() + i * 4;
+
+        texel[0] = sample[0];
+        texel[1] = channelsCount >= 3 ? sample[1] : sample[0];
+        texel[2] = channelsCount >= 3 ? sample[2] : sample[0];
+        texel[3] = channelsCount % 2 == 0 ? sample[channelsCount - 1] : 255;
+    }
+
+    return true;
+}
+
+int main(int argc, char **argv) {
+    std::string inputPath;
+    std::string outputPath;
+    GameEngine::TextureFormat format = GameEngine::TextureFormat::BC7;
+    bool generateMips = true;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc) {
+            if (!GameEngine::findTextureFormat(argv[++i], format)) {
+                std::cerr << "Unknown texture format " << argv[i] << "\n";
+
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--no-mips") == 0) {
+            generateMips = false;
+        } else if (inputPath.empty()) {
+            inputPath = argv[i];
+        } else if (outputPath.empty()) {
+            outputPath = argv[i];
+        } else {
+            inputPath.clear();
+            break;
+        }
+    }
+
+    if (inputPath.empty() || outputPath.empty()) {
+        std::cerr << "Usage: " << argv[0] << " <input.pnm> <output> [--format <name>] [--no-mips]\n"
+                  << "Formats: ";
+
+        for (size_t i = 0; i < static_cast<size_t>(GameEngine::TextureFormat::FormatsCount); ++i) {
+            std::cerr << GameEngine::getTextureFormatInfo(static_cast<GameEngine::TextureFormat>(i)).name << " ";
+        }
+
+        std::cerr << "\n";
+
+        return 1;
+    }
+
+    std::vector<unsigned char> rgba;
+    unsigned int width = 0;
+    unsigned int height = 0;
+
+    if (!loadPnm(inputPath, rgba, width, height)) {
+        return 1;
+    }
+
+    GameEngine::LogConfig logConfig;
+    logConfig.asynchronous = false;
+    GameEngine::Log::init(logConfig);
+    GameEngine::JobSystem::init();
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    GameEngine::TextureData data;
+    GameEngine::cookTexture(rgba.data(), width, height, format, generateMips, data);
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    GameEngine::JobSystem::shutdown();
+
+    const bool isSaved = GameEngine::TextureFile::save(outputPath, data);
+
+    GameEngine::Log::shutdown();
+
+    if (!isSaved) {
+        std::cerr << "Failed to write " << outputPath << "\n";
+
+        return 1;
+    }
+
+    std::cout << "Cooked " << inputPath << " (" << width << "x" << height << ") to "
+              << GameEngine::getTextureFormatInfo(format).name << " with " << data.getLevelsCount()
+              << " levels: " << data.pixels.size() << " bytes (source " << rgba.size() << " bytes) in "
+              << seconds << " s\n";
+
+    return 0;
+}